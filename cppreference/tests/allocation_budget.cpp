@@ -0,0 +1,104 @@
+#include "allocation_budget.hpp"
+#include "arena.hpp"
+#include "small_vector.hpp"
+#include "string_hash.hpp"
+#include "gtest/gtest-spi.h"
+#include "gtest/gtest.h"
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+
+// 全ての TEST の確保を記録する (gtest_main が RUN_ALL_TESTS を呼ぶ前に登録する)
+[[maybe_unused]] const bool listener_installed = cppreference::AllocationListener::Install();
+
+TEST(
+    allocation_budget, Budget
+)
+{
+    using namespace std::string_view_literals;
+
+    // reserve した std::vector への push_back は 1 回だけ確保する
+    {
+        const auto budget = cppreference::AllocationBudget(1, 100 * sizeof(int));
+        auto       vec1 = std::vector<int>();
+        vec1.reserve(100); // NOLINT
+        for (int i = 0; i < 100; ++i) // NOLINT
+        {
+            vec1.push_back(i);
+        }
+    }
+
+    // SmallVector はオブジェクト内の容量までは確保しない
+    {
+        const auto budget = cppreference::AllocationBudget(0);
+        auto       vec1 = cppreference::SmallVector<int, 8>{1, 2, 3};
+        vec1.emplace_back(4); // NOLINT
+    }
+
+    // 透過的なハッシュは std::string_view で探しても std::string を作らない
+    auto um1 = cppreference::StringMap<int>({{"/usr/share/cppreference/one", 1}, {"/usr/share/cppreference/two", 2}});
+    {
+        const auto budget = cppreference::AllocationBudget(0);
+        EXPECT_EQ(2, um1.find("/usr/share/cppreference/two"sv)->second);
+    }
+
+    // バッファから切り出す Arena はヒープを使わない
+    alignas(std::max_align_t) auto buffer = std::array<std::byte, 4096>(); // NOLINT
+    {
+        const auto budget = cppreference::AllocationBudget(0);
+        auto       arena = cppreference::Arena(buffer, std::pmr::null_memory_resource());
+        auto       vec1 = std::pmr::vector<int>({1, 2, 3, 4, 5}, &arena); // NOLINT
+    }
+}
+
+TEST(
+    allocation_budget, Exceeded
+)
+{
+    // 上限を超えたらスコープを抜けるときに失敗する (数には EXPECT_NONFATAL_FAILURE 自身の確保も入る)
+    auto sink = std::vector<int>();
+    EXPECT_NONFATAL_FAILURE(
+        {
+            const auto budget = cppreference::AllocationBudget(0);
+            sink = std::vector<int>(10); // NOLINT
+        },
+        "allocation budget exceeded"
+    );
+    EXPECT_NONFATAL_FAILURE(
+        {
+            const auto budget = cppreference::AllocationBudget(1, 4);
+            sink = std::vector<int>(10); // NOLINT
+        },
+        "bytes (budget 4)"
+    );
+}
+
+TEST(
+    allocation_budget, Listener
+)
+{
+    // 他のテストの実行に頼らないように、このテストの中でリスナの開始・終了を呼ぶ
+    const auto& info = *::testing::UnitTest::GetInstance()->current_test_info();
+    auto        listener = cppreference::AllocationListener();
+    listener.OnTestStart(info);
+    auto p1 = std::make_unique<int>(1);
+    auto p2 = std::make_unique<int>(2);
+    auto p3 = std::make_unique<int>(3);
+    listener.OnTestEnd(info);
+    EXPECT_EQ(6, *p1 + *p2 + *p3);
+
+    const auto stats = cppreference::AllocationListener::Find("allocation_budget.Listener");
+    ASSERT_TRUE(stats.has_value());
+    EXPECT_EQ(3U, stats->count);
+    EXPECT_EQ(3 * sizeof(int), stats->bytes);
+    EXPECT_FALSE(cppreference::AllocationListener::Find("allocation_budget.Missing").has_value());
+}
+
+} // namespace
@@ -0,0 +1,81 @@
+#include "batch_search.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace
+{
+
+TEST(
+    batch_search, BinarySearch_Bound
+)
+{
+    const std::vector<int> vec1 = {1, 2, 3, 4, 4, 5, 6, 7, 8, 9}; // NOLINT
+    const std::vector<int> keys = {4, 0, 10, 5};                 // NOLINT
+
+    using std::begin, std::end;
+
+    auto lower = std::vector<std::vector<int>::const_iterator>();
+    cppreference::batch_lower_bound(begin(vec1), end(vec1), keys, std::back_inserter(lower));
+    ASSERT_EQ(4, lower.size());           // NOLINT
+    EXPECT_EQ(begin(vec1) + 3, lower[0]); // NOLINT
+    EXPECT_EQ(begin(vec1), lower[1]);
+    EXPECT_EQ(end(vec1), lower[2]);
+    EXPECT_EQ(begin(vec1) + 5, lower[3]); // NOLINT
+
+    auto upper = std::vector<std::vector<int>::const_iterator>(keys.size());
+    EXPECT_EQ(end(upper), cppreference::batch_upper_bound(begin(vec1), end(vec1), std::span(keys), begin(upper)));
+    EXPECT_EQ(begin(vec1) + 5, upper[0]); // NOLINT
+    EXPECT_EQ(begin(vec1) + 6, upper[3]); // NOLINT
+
+    // 空の列
+    const auto empty = std::vector<int>();
+    auto       none = std::vector<std::vector<int>::const_iterator>();
+    cppreference::batch_lower_bound(begin(empty), end(empty), keys, std::back_inserter(none));
+    EXPECT_EQ(std::vector(keys.size(), end(empty)), none);
+}
+
+TEST(
+    batch_search, AgainstStd
+)
+{
+    auto gen = std::mt19937{42}; // NOLINT
+
+    for (const int n : {1, 2, 3, 15, 16, 17, 100, 1'000, 65'537}) // NOLINT
+    {
+        auto dist = std::uniform_int_distribution<int>(0, n);
+        auto v = std::deque<int>(n);
+        std::ranges::generate(v, [&]() { return dist(gen); });
+        std::ranges::sort(v, std::greater{});
+
+        auto keys = std::vector<int>(100); // NOLINT
+        std::ranges::generate(keys, [&]() { return dist(gen) - 1; });
+
+        auto lower = std::vector<std::deque<int>::iterator>();
+        auto upper = std::vector<std::deque<int>::iterator>();
+        cppreference::batch_lower_bound(v.begin(), v.end(), keys, std::back_inserter(lower), std::greater{});
+        cppreference::batch_upper_bound(v.begin(), v.end(), keys, std::back_inserter(upper), std::greater{});
+        for (std::size_t i = 0; i < keys.size(); ++i)
+        {
+            EXPECT_EQ(std::lower_bound(v.begin(), v.end(), keys[i], std::greater{}), lower[i]);
+            EXPECT_EQ(std::upper_bound(v.begin(), v.end(), keys[i], std::greater{}), upper[i]);
+        }
+
+        // 連続したメモリならプリフェッチする
+        const auto w = std::vector<int>(v.rbegin(), v.rend());
+        auto       found = std::vector<std::vector<int>::const_iterator>();
+        cppreference::batch_lower_bound(w.begin(), w.end(), keys, std::back_inserter(found));
+        for (std::size_t i = 0; i < keys.size(); ++i)
+        {
+            EXPECT_EQ(std::ranges::lower_bound(w, keys[i]), found[i]);
+        }
+    }
+}
+
+} // namespace
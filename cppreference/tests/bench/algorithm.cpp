@@ -0,0 +1,1334 @@
+#include "bench_common.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace cppreference::bench
+{
+namespace
+{
+
+// algorithm.cpp の TEST(algorithm, Xxx) と 1:1 で対応させる
+// 各ベンチマークは対応するテストと同じ呼び出し列を n 要素に対して実行する
+
+template <typename C>
+void BM_batch_foreach(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r);
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        std::for_each(begin(r), end(r), Flip());
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_batch_foreach);
+
+template <typename C>
+void BM_batch_foreachN(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r);
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        std::for_each_n(begin(r), n, Flip());
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_batch_foreachN);
+
+template <typename C>
+void BM_Search_AllAnyNone(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r, 1);
+
+    using std::begin, std::end;
+
+    // いずれも全要素を走査する条件にする
+    const auto last = static_cast<int>(n);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::all_of(begin(r), end(r), [](const auto& v) { return v > 0; }));
+        benchmark::DoNotOptimize(std::any_of(begin(r), end(r), [&](const auto& v) { return v == last; }));
+        benchmark::DoNotOptimize(std::none_of(begin(r), end(r), [](const auto& v) { return v < 0; }));
+    }
+    SetThroughput(state, 3 * n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Search_AllAnyNone);
+
+template <typename C>
+void BM_Search_FindEnd(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r, 1);
+
+    const auto test1 = std::array<int, 2>{static_cast<int>(n / 2), static_cast<int>(n / 2) + 1};
+    const auto test2 = std::array<int, 2>{-1, -2};
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::find_end(begin(r), end(r), begin(test1), end(test1)));
+        benchmark::DoNotOptimize(std::find_end(begin(r), end(r), begin(test2), end(test2)));
+    }
+    SetThroughput(state, 2 * n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Search_FindEnd);
+
+template <typename C>
+void BM_Search_FindFirstOf(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r, 1);
+
+    const auto test1 = std::array<int, 2>{static_cast<int>(n), static_cast<int>(n) + 1};
+    const auto test2 = std::array<int, 2>{-1, -2};
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::find_first_of(begin(r), end(r), begin(test1), end(test1)));
+        benchmark::DoNotOptimize(std::find_first_of(begin(r), end(r), begin(test2), end(test2)));
+    }
+    SetThroughput(state, 2 * n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Search_FindFirstOf);
+
+template <typename C>
+void BM_Search_AdjacentFind(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r);
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::adjacent_find(begin(r), end(r)));
+    }
+    SetThroughput(state, n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Search_AdjacentFind);
+
+template <typename C>
+void BM_Search_Count(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillRandom(r, 16); // NOLINT
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::count(begin(r), end(r), 2));
+        benchmark::DoNotOptimize(std::count_if(begin(r), end(r), [](const auto& v) { return (v % 2) == 1; }));
+    }
+    SetThroughput(state, 2 * n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Search_Count);
+
+template <typename C>
+void BM_Search_Mismatch(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r);
+    const auto other = std::vector<int>(std::ranges::begin(r), std::ranges::end(r));
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::mismatch(begin(r), end(r), begin(other)));
+    }
+    SetThroughput(state, n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Search_Mismatch);
+
+template <typename C>
+void BM_Search_equal(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r);
+    const auto other = std::vector<int>(std::ranges::begin(r), std::ranges::end(r));
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::equal(begin(r), end(r), begin(other)));
+    }
+    SetThroughput(state, n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Search_equal);
+
+template <typename C>
+void BM_Search_search(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r, 1);
+
+    // 末尾にだけ一致する
+    const auto last = static_cast<int>(n);
+    const auto test = std::array<int, 3>{last - 2, last - 1, last};
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::search(begin(r), end(r), begin(test), end(test)));
+    }
+    SetThroughput(state, n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Search_search);
+
+template <typename C>
+void BM_Search_searchN(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r, 1);
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::search_n(begin(r), end(r), 2, 9)); // NOLINT
+    }
+    SetThroughput(state, n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Search_searchN);
+
+template <typename C>
+void BM_Copy_copy(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r);
+
+    auto d_vec = std::vector<int>(n);
+    auto d_ins = std::vector<int>();
+    d_ins.reserve(n);
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        std::copy(begin(r), end(r), begin(d_vec));
+        d_ins.clear();
+        std::copy_if(begin(r), end(r), std::back_inserter(d_ins), [](const int& v) { return v % 2 == 0; });
+        std::copy_n(begin(r), n, begin(d_vec));
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, 3 * n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Copy_copy);
+
+template <typename C>
+void BM_Copy_copyBackward(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r);
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        std::copy_backward(begin(r), std::next(begin(r), n / 2), end(r));
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, n / 2);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Copy_copyBackward);
+
+template <typename C>
+void BM_Transformation_transform(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillRandom(r, 1 << 10); // NOLINT
+    const auto other = std::vector<int>(std::ranges::begin(r), std::ranges::end(r));
+
+    auto d_vec = std::vector<int>(n);
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        std::transform(begin(r), end(r), begin(d_vec), [](const auto& v) { return v * 2; });
+        std::transform(begin(r), end(r), begin(other), begin(d_vec), [](const auto& v1, const auto& v2) {
+            return v1 * v2;
+        });
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, 2 * n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Transformation_transform);
+
+template <typename C>
+void BM_Transformation_replace(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillRandom(r, 16); // NOLINT
+    const auto pristine = std::vector<int>(std::ranges::begin(r), std::ranges::end(r));
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        Restore(state, r, pristine);
+        std::replace(begin(r), end(r), 3, 9);                                           // NOLINT
+        std::replace_if(begin(r), end(r), [](const int& v) { return v % 2 == 0; }, -1); // NOLINT
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, 2 * n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Transformation_replace);
+
+template <typename C>
+void BM_Transformation_replaceCopy(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillRandom(r, 16); // NOLINT
+
+    auto d_vec = std::vector<int>();
+    d_vec.reserve(n);
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        d_vec.clear();
+        std::replace_copy(begin(r), end(r), std::back_inserter(d_vec), 3, 9); // NOLINT
+        d_vec.clear();
+        std::replace_copy_if(
+            begin(r),
+            end(r),
+            std::back_inserter(d_vec),
+            [](const int& v) { return v % 2 == 0; },
+            -1
+        );
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, 2 * n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Transformation_replaceCopy);
+
+template <typename C>
+void BM_Generation_fill(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+
+    auto d_vec = std::vector<int>();
+    d_vec.reserve(n);
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        std::fill(begin(r), end(r), 0xF); // NOLINT
+        d_vec.clear();
+        std::fill_n(std::back_inserter(d_vec), n, 0xF); // NOLINT
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, 2 * n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Generation_fill);
+
+template <typename C>
+void BM_Generation_generate(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+
+    auto d_vec = std::vector<int>();
+    d_vec.reserve(n);
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        std::generate(begin(r), end(r), [i = 0]() mutable { return i++; });
+        d_vec.clear();
+        std::generate_n(std::back_inserter(d_vec), n, [i = 0xF]() mutable { return i++; }); // NOLINT
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, 2 * n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Generation_generate);
+
+template <typename C>
+void BM_Removing_remove(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillRandom(r, 16); // NOLINT
+    const auto pristine = std::vector<int>(std::ranges::begin(r), std::ranges::end(r));
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        Restore(state, r, pristine);
+        benchmark::DoNotOptimize(std::remove(begin(r), end(r), 3));
+        Restore(state, r, pristine);
+        benchmark::DoNotOptimize(std::remove_if(begin(r), end(r), [](const int& v) { return v % 2 == 0; }));
+    }
+    SetThroughput(state, 2 * n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Removing_remove);
+
+template <typename C>
+void BM_Removing_removeCopy(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillRandom(r, 16); // NOLINT
+
+    auto d_vec = std::vector<int>();
+    d_vec.reserve(n);
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        d_vec.clear();
+        std::remove_copy(begin(r), end(r), std::back_inserter(d_vec), 3);
+        d_vec.clear();
+        std::remove_copy_if(begin(r), end(r), std::back_inserter(d_vec), [](const int& v) { return v % 2 == 0; });
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, 2 * n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Removing_removeCopy);
+
+template <typename C>
+void BM_Removing_unique(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillRandom(r, 4); // NOLINT
+    const auto pristine = std::vector<int>(std::ranges::begin(r), std::ranges::end(r));
+
+    auto d_vec = std::vector<int>();
+    d_vec.reserve(n);
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        Restore(state, r, pristine);
+        benchmark::DoNotOptimize(std::unique(begin(r), end(r)));
+        d_vec.clear();
+        std::unique_copy(begin(pristine), end(pristine), std::back_inserter(d_vec));
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, 2 * n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Removing_unique);
+
+template <typename C>
+void BM_Order_reverse(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r);
+
+    auto d_vec = std::vector<int>();
+    d_vec.reserve(n);
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        std::reverse(begin(r), end(r));
+        d_vec.clear();
+        std::reverse_copy(begin(r), end(r), std::back_inserter(d_vec));
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, 2 * n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Order_reverse);
+
+template <typename C>
+void BM_Order_rotate(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r);
+
+    auto d_vec = std::vector<int>();
+    d_vec.reserve(n);
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        std::rotate(begin(r), std::next(begin(r), n / 2), end(r));
+        d_vec.clear();
+        std::rotate_copy(begin(r), std::next(begin(r), n / 2), end(r), std::back_inserter(d_vec));
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, 2 * n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Order_rotate);
+
+template <typename C>
+void BM_Order_shift(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r);
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::shift_left(begin(r), end(r), n / 2));
+        benchmark::DoNotOptimize(std::shift_right(begin(r), end(r), n / 2));
+    }
+    SetThroughput(state, n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Order_shift);
+
+template <typename C>
+void BM_Order_shuffle(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r);
+
+    auto gen = std::mt19937{SEED};
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        std::shuffle(begin(r), end(r), gen);
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, n);
+}
+CPPREFERENCE_BENCHMARK_RANDOM_ACCESS(BM_Order_shuffle);
+
+template <typename C>
+void BM_Sampling_sample(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r);
+
+    auto gen = std::mt19937{SEED};
+    auto d_vec = std::vector<int>();
+    d_vec.reserve(n / 10); // NOLINT
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        d_vec.clear();
+        std::sample(begin(r), end(r), std::back_inserter(d_vec), n / 10, gen); // NOLINT
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Sampling_sample);
+
+template <typename C>
+void BM_Partitioning_partition(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillRandom(r, 1 << 10); // NOLINT
+    const auto pristine = std::vector<int>(std::ranges::begin(r), std::ranges::end(r));
+
+    auto is_even = [](const int& v) { return v % 2 == 0; };
+    auto d_vec_x = std::vector<int>();
+    auto d_vec_y = std::vector<int>();
+    d_vec_x.reserve(n);
+    d_vec_y.reserve(n);
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        Restore(state, r, pristine);
+        benchmark::DoNotOptimize(std::is_partitioned(begin(r), end(r), is_even));
+        benchmark::DoNotOptimize(std::partition(begin(r), end(r), is_even));
+        benchmark::DoNotOptimize(std::partition_point(begin(r), end(r), is_even));
+
+        d_vec_x.clear();
+        d_vec_y.clear();
+        std::partition_copy(
+            begin(pristine),
+            end(pristine),
+            std::back_inserter(d_vec_x),
+            std::back_inserter(d_vec_y),
+            is_even
+        );
+
+        Restore(state, r, pristine);
+        benchmark::DoNotOptimize(std::stable_partition(begin(r), end(r), is_even));
+    }
+    SetThroughput(state, 5 * n); // NOLINT
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Partitioning_partition);
+
+template <typename C>
+void BM_Sorting_sort(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r);
+    std::shuffle(std::ranges::begin(r), std::ranges::end(r), std::mt19937{SEED});
+    const auto pristine = std::vector<int>(std::ranges::begin(r), std::ranges::end(r));
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        Restore(state, r, pristine);
+        std::sort(begin(r), end(r));
+        Restore(state, r, pristine);
+        std::sort(begin(r), end(r), std::greater{});
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, 2 * n);
+}
+CPPREFERENCE_BENCHMARK_RANDOM_ACCESS(BM_Sorting_sort);
+
+template <typename C>
+void BM_Sorting_partialSort(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r);
+    std::shuffle(std::ranges::begin(r), std::ranges::end(r), std::mt19937{SEED});
+    const auto pristine = std::vector<int>(std::ranges::begin(r), std::ranges::end(r));
+
+    auto d_vec = std::vector<int>(n / 10); // NOLINT
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        Restore(state, r, pristine);
+        std::partial_sort(begin(r), std::next(begin(r), n / 10), end(r)); // NOLINT
+        std::partial_sort_copy(begin(pristine), end(pristine), begin(d_vec), end(d_vec));
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, 2 * n);
+}
+CPPREFERENCE_BENCHMARK_RANDOM_ACCESS(BM_Sorting_partialSort);
+
+template <typename C>
+void BM_Sorting_IsSortedUntil(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r);
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::is_sorted_until(begin(r), end(r)));
+    }
+    SetThroughput(state, n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Sorting_IsSortedUntil);
+
+template <typename C>
+void BM_Sorting_NthElement(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r);
+    std::shuffle(std::ranges::begin(r), std::ranges::end(r), std::mt19937{SEED});
+    const auto pristine = std::vector<int>(std::ranges::begin(r), std::ranges::end(r));
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        Restore(state, r, pristine);
+        std::nth_element(begin(r), std::next(begin(r), n / 2), end(r));
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, n);
+}
+CPPREFERENCE_BENCHMARK_RANDOM_ACCESS(BM_Sorting_NthElement);
+
+template <typename C>
+void BM_BinarySearch_Bound(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r);
+
+    auto gen = std::mt19937{SEED};
+    auto dist = std::uniform_int_distribution<int>(0, static_cast<int>(n) - 1);
+
+    using std::begin, std::end;
+
+    // 1 iteration = 4 クエリ
+    for (auto _ : state)
+    {
+        const int key = dist(gen);
+        benchmark::DoNotOptimize(std::lower_bound(begin(r), end(r), key));
+        benchmark::DoNotOptimize(std::upper_bound(begin(r), end(r), key));
+        benchmark::DoNotOptimize(std::equal_range(begin(r), end(r), key));
+        benchmark::DoNotOptimize(std::binary_search(begin(r), end(r), key));
+    }
+    state.SetItemsProcessed(state.iterations() * 4);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_BinarySearch_Bound);
+
+template <typename C>
+void BM_Set_includes(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r);
+
+    // 偶数だけの部分集合
+    auto sub = std::vector<int>(n / 2);
+    std::ranges::generate(sub, [i = 0]() mutable { return 2 * i++; });
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::includes(begin(r), end(r), begin(sub), end(sub)));
+    }
+    SetThroughput(state, n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Set_includes);
+
+template <typename C>
+void BM_Set_Set(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r);
+
+    // 3 の倍数
+    auto other = std::vector<int>(n);
+    std::ranges::generate(other, [i = 0]() mutable { return 3 * i++; });
+
+    auto d_vec = std::vector<int>();
+    d_vec.reserve(2 * n);
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        d_vec.clear();
+        std::set_union(begin(r), end(r), begin(other), end(other), std::back_inserter(d_vec));
+        d_vec.clear();
+        std::set_intersection(begin(r), end(r), begin(other), end(other), std::back_inserter(d_vec));
+        d_vec.clear();
+        std::set_difference(begin(r), end(r), begin(other), end(other), std::back_inserter(d_vec));
+        d_vec.clear();
+        std::set_symmetric_difference(begin(r), end(r), begin(other), end(other), std::back_inserter(d_vec));
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, 8 * n); // NOLINT
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Set_Set);
+
+template <typename C>
+void BM_Merge_Merge(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+
+    // 前半は奇数、後半は偶数のソート済み列
+    const auto half = n / 2;
+    std::ranges::generate(r, [i = std::int64_t{0}, half]() mutable {
+        const auto k = i++;
+        return static_cast<int>(k < half ? (2 * k) + 1 : 2 * (k - half));
+    });
+    const auto pristine = std::vector<int>(std::ranges::begin(r), std::ranges::end(r));
+
+    auto d_vec = std::vector<int>();
+    d_vec.reserve(n);
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        d_vec.clear();
+        const auto mid = std::next(begin(pristine), half);
+        std::merge(begin(pristine), mid, mid, end(pristine), std::back_inserter(d_vec));
+
+        Restore(state, r, pristine);
+        std::inplace_merge(begin(r), std::next(begin(r), half), end(r));
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, 2 * n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Merge_Merge);
+
+template <typename C>
+void BM_Heap_Heap(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r);
+    std::shuffle(std::ranges::begin(r), std::ranges::end(r), std::mt19937{SEED});
+    const auto pristine = std::vector<int>(std::ranges::begin(r), std::ranges::end(r));
+
+    using std::begin, std::end;
+
+    // push_heap/pop_heap は末尾 1 要素の出し入れで、make_heap/sort_heap が支配的
+    for (auto _ : state)
+    {
+        Restore(state, r, pristine);
+        std::make_heap(begin(r), std::prev(end(r)));
+        std::push_heap(begin(r), end(r));
+        std::pop_heap(begin(r), end(r));
+        benchmark::DoNotOptimize(std::is_heap_until(begin(r), end(r)));
+        std::sort_heap(begin(r), std::prev(end(r)));
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, 3 * n);
+}
+CPPREFERENCE_BENCHMARK_RANDOM_ACCESS(BM_Heap_Heap);
+
+template <typename C>
+void BM_MinMax_MinMax(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillRandom(r, 1 << 20); // NOLINT
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::max_element(begin(r), end(r)));
+        benchmark::DoNotOptimize(std::minmax_element(begin(r), end(r)));
+    }
+    SetThroughput(state, 2 * n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_MinMax_MinMax);
+
+template <typename C>
+void BM_MinMax_Clamp(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillRandom(r, 1 << 10); // NOLINT
+
+    auto d_vec = std::vector<int>(n);
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        std::transform(begin(r), end(r), begin(d_vec), [](const int& v) { return std::clamp(v, 256, 768); }); // NOLINT
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_MinMax_Clamp);
+
+template <typename C>
+void BM_Lexicographical(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r);
+    const auto other = std::vector<int>(std::ranges::begin(r), std::ranges::end(r));
+
+    using std::begin, std::end;
+
+    // 等しい列同士なので最後まで比較する
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::lexicographical_compare(begin(r), end(r), begin(other), end(other)));
+    }
+    SetThroughput(state, n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Lexicographical);
+
+template <typename C>
+void BM_Permutation(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r);
+
+    using std::begin, std::end;
+
+    // 昇順 -> prev で降順 -> next で昇順、といずれも全体を反転する最悪ケース
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::prev_permutation(begin(r), end(r)));
+        benchmark::DoNotOptimize(std::next_permutation(begin(r), end(r)));
+    }
+    SetThroughput(state, 2 * n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Permutation);
+
+template <typename C>
+void BM_Numeric_iota(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        std::iota(begin(r), end(r), 1);
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Numeric_iota);
+
+// 以下 Numeric_* は 100M 要素の総和でも int に収まるよう [0, 8) の値を使う
+
+template <typename C>
+void BM_Numeric_accumulate(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillRandom(r, 8); // NOLINT
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::accumulate(begin(r), end(r), 0));
+        benchmark::DoNotOptimize(std::accumulate(begin(r), end(r), 1U, std::multiplies{}));
+    }
+    SetThroughput(state, 2 * n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Numeric_accumulate);
+
+template <typename C>
+void BM_Numeric_innerProduct(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillRandom(r, 8); // NOLINT
+    const auto other = std::vector<int>(std::ranges::begin(r), std::ranges::end(r));
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::inner_product(begin(r), end(r), begin(other), std::int64_t{0}));
+        benchmark::DoNotOptimize(
+            std::inner_product(begin(r), end(r), begin(other), 1U, std::multiplies{}, std::plus{})
+        );
+    }
+    SetThroughput(state, 2 * n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Numeric_innerProduct);
+
+template <typename C>
+void BM_Numeric_adjacentDifference(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillRandom(r, 8); // NOLINT
+
+    auto d_vec = std::vector<int>();
+    d_vec.reserve(n);
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        d_vec.clear();
+        std::adjacent_difference(begin(r), end(r), std::back_inserter(d_vec));
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Numeric_adjacentDifference);
+
+template <typename C>
+void BM_Numeric_partialSum(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillRandom(r, 8); // NOLINT
+
+    auto d_vec = std::vector<int>();
+    d_vec.reserve(n);
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        d_vec.clear();
+        std::partial_sum(begin(r), end(r), std::back_inserter(d_vec));
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Numeric_partialSum);
+
+template <typename C>
+void BM_Numeric_reduce(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillRandom(r, 8); // NOLINT
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::reduce(begin(r), end(r)));
+        benchmark::DoNotOptimize(std::reduce(begin(r), end(r), 100)); // NOLINT
+        benchmark::DoNotOptimize(std::reduce(begin(r), end(r), 1U, std::multiplies{}));
+    }
+    SetThroughput(state, 3 * n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Numeric_reduce);
+
+template <typename C>
+void BM_Numeric_scan(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillRandom(r, 8); // NOLINT
+
+    auto d_vec = std::vector<int>();
+    d_vec.reserve(n);
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        d_vec.clear();
+        std::partial_sum(begin(r), end(r), std::back_inserter(d_vec));
+        d_vec.clear();
+        std::exclusive_scan(begin(r), end(r), std::back_inserter(d_vec), -100); // NOLINT
+        d_vec.clear();
+        std::inclusive_scan(begin(r), end(r), std::back_inserter(d_vec));
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, 3 * n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Numeric_scan);
+
+template <typename C>
+void BM_Numeric_transformReduce(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillRandom(r, 8); // NOLINT
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            std::transform_reduce(begin(r), end(r), begin(r), std::int64_t{0}, std::plus{}, std::multiplies{})
+        );
+    }
+    SetThroughput(state, n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Numeric_transformReduce);
+
+template <typename C>
+void BM_Numeric_transformScan(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillRandom(r, 8); // NOLINT
+
+    auto d_vec = std::vector<int>();
+    d_vec.reserve(n);
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        d_vec.clear();
+        std::transform_exclusive_scan(
+            begin(r),
+            end(r),
+            std::back_inserter(d_vec),
+            -100, // NOLINT
+            std::plus{},
+            [](const auto& x) { return x * 2; }
+        );
+        d_vec.clear();
+        std::transform_inclusive_scan(begin(r), end(r), std::back_inserter(d_vec), std::plus{}, [](const auto& x) {
+            return x * 2;
+        });
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, 2 * n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Numeric_transformScan);
+
+template <typename C>
+void BM_Uninitialized_Copy(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+    FillIota(r);
+
+    auto  alloc = std::allocator<int>();
+    auto* p = alloc.allocate(n);
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        std::uninitialized_copy(begin(r), end(r), p);
+        std::uninitialized_copy_n(begin(r), n, p);
+        benchmark::ClobberMemory();
+    }
+    alloc.deallocate(p, n);
+    SetThroughput(state, 2 * n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Uninitialized_Copy);
+
+template <typename C>
+void BM_Uninitialized_Fill(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       input = Input<C>(n);
+    auto&      r = input.range();
+
+    using std::begin, std::end;
+
+    for (auto _ : state)
+    {
+        std::uninitialized_fill(begin(r), end(r), 0xFF);  // NOLINT
+        std::uninitialized_fill_n(begin(r), n, 0xAA);     // NOLINT
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, 2 * n);
+}
+CPPREFERENCE_BENCHMARK_CONTAINERS(BM_Uninitialized_Fill);
+
+struct S // NOLINT
+{
+    int x;
+
+    S() : x(0) {}
+    S(int v) : x(v) {} // NOLINT
+
+    ~S() { x = -1; } // NOLINT
+};
+
+// コンテナに依存しないので生のメモリ上で計測する
+void BM_Destroy(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+
+    auto  alloc = std::allocator<S>();
+    auto* p = alloc.allocate(n);
+
+    for (auto _ : state)
+    {
+        for (std::int64_t i = 0; i < n; ++i)
+        {
+            std::construct_at(&p[i], static_cast<int>(i)); // NOLINT
+        }
+        std::destroy_at(&p[0]);
+        std::destroy_n(p + 1, (n / 2) - 1);   // NOLINT
+        std::destroy(p + (n / 2), p + n);     // NOLINT
+        benchmark::ClobberMemory();
+    }
+    alloc.deallocate(p, n);
+    SetThroughput(state, 2 * n, sizeof(S));
+}
+BENCHMARK(BM_Destroy)->Apply(Sizes);
+
+} // namespace
+} // namespace cppreference::bench
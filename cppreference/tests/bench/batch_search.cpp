@@ -0,0 +1,58 @@
+#include "batch_search.hpp"
+#include "bench_common.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace cppreference::bench
+{
+namespace
+{
+
+// 多数のクエリの lower_bound (items_per_second がクエリ/秒)
+// 1 iteration = QUERIES 個のランダムなキー
+
+constexpr std::int64_t QUERIES = 4'096;
+
+void BM_BatchLowerBound_Loop(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       sorted = std::vector<int>(n);
+    FillIota(sorted);
+    auto keys = std::vector<int>(QUERIES);
+    FillRandom(keys, static_cast<int>(n));
+    auto out = std::vector<std::vector<int>::const_iterator>(QUERIES);
+
+    for (auto _ : state)
+    {
+        std::ranges::transform(keys, out.begin(), [&](int key) { return std::ranges::lower_bound(sorted, key); });
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, QUERIES);
+}
+BENCHMARK(BM_BatchLowerBound_Loop)->Apply(Sizes);
+
+void BM_BatchLowerBound_Batch(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       sorted = std::vector<int>(n);
+    FillIota(sorted);
+    auto keys = std::vector<int>(QUERIES);
+    FillRandom(keys, static_cast<int>(n));
+    auto out = std::vector<std::vector<int>::const_iterator>(QUERIES);
+
+    for (auto _ : state)
+    {
+        cppreference::batch_lower_bound(sorted.cbegin(), sorted.cend(), keys, out.begin());
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, QUERIES);
+}
+BENCHMARK(BM_BatchLowerBound_Batch)->Apply(Sizes);
+
+} // namespace
+} // namespace cppreference::bench
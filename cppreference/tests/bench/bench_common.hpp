@@ -0,0 +1,206 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <vector>
+
+namespace cppreference::bench
+{
+
+using RefView = std::ranges::ref_view<std::vector<int>>;
+
+using Array1K = std::array<int, 1'000>;
+using Array10K = std::array<int, 10'000>;
+using Array100K = std::array<int, 100'000>;
+using Array1M = std::array<int, 1'000'000>;
+using Array10M = std::array<int, 10'000'000>;
+using Array100M = std::array<int, 100'000'000>;
+
+constexpr std::int64_t MIN_SIZE = 1'000;
+constexpr std::int64_t MAX_SIZE = 100'000'000;
+
+// std::list はノード 1 つで 24 byte 以上消費するため 10M で打ち切る
+constexpr std::int64_t MAX_NODE_SIZE = 10'000'000;
+
+constexpr std::uint32_t SEED = 0x5EED;
+
+/**
+ * @brief 計測対象のコンテナを所有する
+ *
+ * std::array は巨大になりうるのでヒープに置き、ref_view は参照先の vector ごと保持する
+ */
+template <typename C>
+class Input
+{
+public:
+    explicit Input(
+        std::size_t n
+    )
+        : data_(n)
+    {
+    }
+
+    auto range() -> C& { return data_; }
+
+private:
+    C data_;
+};
+
+template <typename T, std::size_t N>
+class Input<std::array<T, N>>
+{
+public:
+    explicit Input(
+        std::size_t /* n */
+    )
+        : data_(std::make_unique<std::array<T, N>>())
+    {
+    }
+
+    auto range() -> std::array<T, N>& { return *data_; }
+
+private:
+    std::unique_ptr<std::array<T, N>> data_;
+};
+
+template <>
+class Input<RefView>
+{
+public:
+    explicit Input(
+        std::size_t n
+    )
+        : base_(n), view_(base_)
+    {
+    }
+
+    // view_ が base_ を指しているので移動・コピー不可
+    Input(const Input&) = delete;
+    Input(Input&&) = delete;
+    auto operator=(const Input&) -> Input& = delete;
+    auto operator=(Input&&) -> Input& = delete;
+    ~Input() = default;
+
+    auto range() -> RefView& { return view_; }
+
+private:
+    std::vector<int> base_;
+    RefView          view_;
+};
+
+/**
+ * @brief 0, 1, 2, ... で埋める
+ */
+template <typename R>
+void FillIota(
+    R&  r,
+    int first = 0
+)
+{
+    std::iota(std::ranges::begin(r), std::ranges::end(r), first);
+}
+
+/**
+ * @brief [0, bound) の一様乱数で埋める
+ */
+template <typename R>
+void FillRandom(
+    R&            r,
+    int           bound,
+    std::uint32_t seed = SEED
+)
+{
+    auto gen = std::mt19937{seed};
+    auto dist = std::uniform_int_distribution<int>(0, bound - 1);
+    std::ranges::generate(r, [&]() { return dist(gen); });
+}
+
+/**
+ * @brief for_each 系のベンチマークで要素を書き換える関数
+ *
+ * 同じデータを繰り返し書き換えるので、何回繰り返してもオーバーフローしない演算にする
+ */
+struct Flip
+{
+    template <typename T>
+    void operator()(
+        T& v
+    ) const
+    {
+        v ^= 1;
+    }
+};
+
+/**
+ * @brief 破壊的なアルゴリズムの計測前に入力を元に戻す (計測時間からは除外)
+ */
+template <typename R, typename S>
+void Restore(
+    benchmark::State& state,
+    R&                r,
+    const S&          src
+)
+{
+    state.PauseTiming();
+    std::ranges::copy(src, std::ranges::begin(r));
+    state.ResumeTiming();
+}
+
+/**
+ * @brief 処理した要素数とバイト数を JSON 出力に載せる
+ */
+inline void SetThroughput(
+    benchmark::State& state,
+    std::int64_t      n,
+    std::int64_t      element_size = sizeof(int)
+)
+{
+    state.SetItemsProcessed(state.iterations() * n);
+    state.SetBytesProcessed(state.iterations() * n * element_size);
+}
+
+inline void Sizes(
+    benchmark::internal::Benchmark* b
+)
+{
+    b->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE); // NOLINT
+}
+
+inline void NodeSizes(
+    benchmark::internal::Benchmark* b
+)
+{
+    b->RangeMultiplier(10)->Range(MIN_SIZE, MAX_NODE_SIZE); // NOLINT
+}
+
+} // namespace cppreference::bench
+
+// std::array は型ごとにサイズが決まるので個別に登録する
+#define CPPREFERENCE_BENCHMARK_ARRAY(fn)                                       \
+    BENCHMARK_TEMPLATE(fn, ::cppreference::bench::Array1K)->Arg(1'000);        \
+    BENCHMARK_TEMPLATE(fn, ::cppreference::bench::Array10K)->Arg(10'000);      \
+    BENCHMARK_TEMPLATE(fn, ::cppreference::bench::Array100K)->Arg(100'000);    \
+    BENCHMARK_TEMPLATE(fn, ::cppreference::bench::Array1M)->Arg(1'000'000);    \
+    BENCHMARK_TEMPLATE(fn, ::cppreference::bench::Array10M)->Arg(10'000'000); \
+    BENCHMARK_TEMPLATE(fn, ::cppreference::bench::Array100M)->Arg(100'000'000)
+
+// RandomAccessIterator を要求するアルゴリズム用 (std::list を除く)
+#define CPPREFERENCE_BENCHMARK_RANDOM_ACCESS(fn)                                             \
+    CPPREFERENCE_BENCHMARK_ARRAY(fn);                                                        \
+    BENCHMARK_TEMPLATE(fn, std::vector<int>)->Apply(::cppreference::bench::Sizes);           \
+    BENCHMARK_TEMPLATE(fn, std::deque<int>)->Apply(::cppreference::bench::Sizes);            \
+    BENCHMARK_TEMPLATE(fn, ::cppreference::bench::RefView)->Apply(::cppreference::bench::Sizes)
+
+// algorithm.cpp のテストが回している全コンテナ
+#define CPPREFERENCE_BENCHMARK_CONTAINERS(fn) \
+    CPPREFERENCE_BENCHMARK_RANDOM_ACCESS(fn); \
+    BENCHMARK_TEMPLATE(fn, std::list<int>)->Apply(::cppreference::bench::NodeSizes)
@@ -0,0 +1,138 @@
+#include "bench_common.hpp"
+#include "concurrent_hash_map.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace cppreference::bench
+{
+namespace
+{
+
+// 複数スレッドでキーの出現回数を数える (4M 回の upsert をスレッドで等分)
+// Args: {キーの分布 (0: 一様, 1: Zipf), スレッド数}
+
+constexpr std::int64_t OPS = 4'000'000;
+constexpr int          KEY_SPACE = 1'000'000;
+constexpr double       ZIPF_S = 0.99;
+
+/**
+ * @brief 操作するキーの列 (Zipf では少数のキーに操作が集中し、同じシャードのロックを奪い合う)
+ */
+auto OpKeys(
+    bool zipf
+) -> const std::vector<int>&
+{
+    static const auto make = [](bool skewed) {
+        auto gen = std::mt19937{SEED};
+        auto keys = std::vector<int>(OPS);
+        if (skewed)
+        {
+            auto weights = std::vector<double>(KEY_SPACE);
+            for (int k = 0; k < KEY_SPACE; ++k)
+            {
+                weights[k] = 1.0 / std::pow(k + 1, ZIPF_S);
+            }
+            auto dist = std::discrete_distribution<int>(weights.begin(), weights.end());
+            std::ranges::generate(keys, [&]() { return dist(gen); });
+        }
+        else
+        {
+            auto dist = std::uniform_int_distribution<int>(0, KEY_SPACE - 1);
+            std::ranges::generate(keys, [&]() { return dist(gen); });
+        }
+        return keys;
+    };
+    static const auto uniform = make(false);
+    static const auto skewed = make(true);
+    return zipf ? skewed : uniform;
+}
+
+void CountArgs(
+    benchmark::internal::Benchmark* b
+)
+{
+    const auto max_threads = static_cast<std::int64_t>(std::max(1U, std::thread::hardware_concurrency()));
+    for (const std::int64_t zipf : {0, 1})
+    {
+        for (std::int64_t t = 1; t <= max_threads; t *= 2)
+        {
+            b->Args({zipf, t});
+        }
+        if ((max_threads & (max_threads - 1)) != 0)
+        {
+            b->Args({zipf, max_threads});
+        }
+    }
+    b->UseRealTime()->Unit(benchmark::kMillisecond);
+}
+
+template <typename Fn>
+void RunThreads(
+    std::int64_t t,
+    Fn&&         fn
+)
+{
+    auto threads = std::vector<std::jthread>();
+    for (std::int64_t i = 0; i < t; ++i)
+    {
+        threads.emplace_back(fn, i);
+    }
+}
+
+/**
+ * @brief 比較用: 1 つの std::mutex で std::unordered_map を守る
+ */
+void BM_ConcurrentCount_Locked(
+    benchmark::State& state
+)
+{
+    const auto& keys = OpKeys(state.range(0) != 0);
+    const auto  t = state.range(1);
+
+    for (auto _ : state)
+    {
+        auto mutex = std::mutex();
+        auto counts = std::unordered_map<int, std::int64_t>();
+        RunThreads(t, [&](std::int64_t i) {
+            for (auto j = OPS * i / t; j < OPS * (i + 1) / t; ++j)
+            {
+                const auto lock = std::scoped_lock(mutex);
+                ++counts[keys[j]];
+            }
+        });
+        benchmark::DoNotOptimize(counts.size());
+    }
+    SetThroughput(state, OPS);
+}
+BENCHMARK(BM_ConcurrentCount_Locked)->Apply(CountArgs);
+
+void BM_ConcurrentCount_Sharded(
+    benchmark::State& state
+)
+{
+    const auto& keys = OpKeys(state.range(0) != 0);
+    const auto  t = state.range(1);
+
+    for (auto _ : state)
+    {
+        auto counts = ConcurrentHashMap<int, std::int64_t>();
+        RunThreads(t, [&](std::int64_t i) {
+            for (auto j = OPS * i / t; j < OPS * (i + 1) / t; ++j)
+            {
+                counts.upsert(keys[j], [](std::int64_t& c) { ++c; });
+            }
+        });
+        benchmark::DoNotOptimize(counts.size());
+    }
+    SetThroughput(state, OPS);
+}
+BENCHMARK(BM_ConcurrentCount_Sharded)->Apply(CountArgs);
+
+} // namespace
+} // namespace cppreference::bench
@@ -0,0 +1,228 @@
+#include "bench_common.hpp"
+#include "concurrent_queue.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace cppreference::bench
+{
+namespace
+{
+
+/**
+ * @brief 比較用: std::queue を std::mutex で守っただけの有界キュー
+ */
+template <typename T>
+class LockedQueue
+{
+public:
+    explicit LockedQueue(
+        std::size_t capacity
+    )
+        : capacity_(capacity)
+    {
+    }
+
+    auto try_push(
+        const T& value
+    ) -> bool
+    {
+        const auto lock = std::scoped_lock(mutex_);
+        if (queue_.size() == capacity_)
+        {
+            return false;
+        }
+        queue_.push(value);
+        return true;
+    }
+
+    template <typename It>
+    auto try_push(
+        It first,
+        It last
+    ) -> It
+    {
+        const auto lock = std::scoped_lock(mutex_);
+        for (; first != last && queue_.size() < capacity_; ++first)
+        {
+            queue_.push(*first);
+        }
+        return first;
+    }
+
+    auto try_pop() -> std::optional<T>
+    {
+        const auto lock = std::scoped_lock(mutex_);
+        if (queue_.empty())
+        {
+            return std::nullopt;
+        }
+        auto value = std::optional<T>(queue_.front());
+        queue_.pop();
+        return value;
+    }
+
+    template <typename Out>
+    auto try_pop(
+        Out         out,
+        std::size_t n
+    ) -> Out
+    {
+        const auto lock = std::scoped_lock(mutex_);
+        for (; n > 0 && !queue_.empty(); --n, ++out)
+        {
+            *out = queue_.front();
+            queue_.pop();
+        }
+        return out;
+    }
+
+private:
+    std::size_t   capacity_;
+    std::mutex    mutex_;
+    std::queue<T> queue_;
+};
+
+constexpr std::size_t  CAPACITY = 1'024;
+constexpr std::int64_t MESSAGES = 1'000'000;
+
+// スループット: 生産者 t スレッドから消費者 t スレッドへ計 1M 個を渡す (BATCH 個ずつ push / pop)
+// Args: {スレッド数 t}
+
+template <typename Q, std::size_t BATCH>
+void BM_Queue_Throughput(
+    benchmark::State& state
+)
+{
+    const auto t = state.range(0);
+    const auto per_producer = MESSAGES / t;
+
+    for (auto _ : state)
+    {
+        auto que = Q(CAPACITY);
+        auto remaining = std::atomic<std::int64_t>(per_producer * t);
+        auto sum = std::atomic<std::int64_t>(0);
+        {
+            auto threads = std::vector<std::jthread>();
+            for (std::int64_t p = 0; p < t; ++p)
+            {
+                threads.emplace_back([&]() {
+                    auto batch = std::array<std::int64_t, BATCH>();
+                    for (std::int64_t i = 0; i < per_producer; i += BATCH)
+                    {
+                        const auto n = std::min<std::int64_t>(BATCH, per_producer - i);
+                        std::iota(batch.begin(), batch.begin() + n, i);
+                        for (auto it = batch.begin(); it != batch.begin() + n;)
+                        {
+                            const auto next = que.try_push(it, batch.begin() + n);
+                            if (next == it)
+                            {
+                                std::this_thread::yield();
+                            }
+                            it = next;
+                        }
+                    }
+                });
+            }
+            for (std::int64_t c = 0; c < t; ++c)
+            {
+                threads.emplace_back([&]() {
+                    auto         batch = std::array<std::int64_t, BATCH>();
+                    std::int64_t local = 0;
+                    while (remaining.load(std::memory_order_relaxed) > 0)
+                    {
+                        auto* end = que.try_pop(batch.data(), BATCH);
+                        if (end == batch.data())
+                        {
+                            std::this_thread::yield();
+                            continue;
+                        }
+                        local = std::accumulate(batch.data(), end, local);
+                        remaining.fetch_sub(end - batch.data(), std::memory_order_relaxed);
+                    }
+                    sum += local;
+                });
+            }
+        }
+        benchmark::DoNotOptimize(sum.load());
+    }
+    state.SetItemsProcessed(state.iterations() * per_producer * t);
+}
+
+void ThreadCounts(
+    benchmark::internal::Benchmark* b
+)
+{
+    for (const std::int64_t t : {1, 2, 4})
+    {
+        b->Arg(t);
+    }
+    b->UseRealTime()->Unit(benchmark::kMillisecond);
+}
+
+BENCHMARK(BM_Queue_Throughput<LockedQueue<std::int64_t>, 1>)->Apply(ThreadCounts);
+BENCHMARK(BM_Queue_Throughput<LockedQueue<std::int64_t>, 64>)->Apply(ThreadCounts);
+BENCHMARK(BM_Queue_Throughput<SpscQueue<std::int64_t>, 1>)->Arg(1)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Queue_Throughput<SpscQueue<std::int64_t>, 64>)->Arg(1)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Queue_Throughput<MpmcQueue<std::int64_t>, 1>)->Apply(ThreadCounts);
+BENCHMARK(BM_Queue_Throughput<MpmcQueue<std::int64_t>, 64>)->Apply(ThreadCounts);
+
+// レイテンシ: 2 スレッドで 1 個ずつ往復させ、1 往復の時間を測る
+
+template <typename Q>
+void BM_Queue_PingPong(
+    benchmark::State& state
+)
+{
+    constexpr std::int64_t ROUND_TRIPS = 10'000;
+
+    for (auto _ : state)
+    {
+        auto ping = Q(CAPACITY);
+        auto pong = Q(CAPACITY);
+        auto echo = std::jthread([&]() {
+            for (std::int64_t i = 0; i < ROUND_TRIPS; ++i)
+            {
+                auto v = ping.try_pop();
+                for (; !v; v = ping.try_pop())
+                {
+                    std::this_thread::yield();
+                }
+                while (!pong.try_push(*v))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        for (std::int64_t i = 0; i < ROUND_TRIPS; ++i)
+        {
+            while (!ping.try_push(i))
+            {
+                std::this_thread::yield();
+            }
+            auto v = pong.try_pop();
+            for (; !v; v = pong.try_pop())
+            {
+                std::this_thread::yield();
+            }
+            benchmark::DoNotOptimize(*v);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * ROUND_TRIPS);
+}
+BENCHMARK(BM_Queue_PingPong<LockedQueue<std::int64_t>>)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Queue_PingPong<SpscQueue<std::int64_t>>)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Queue_PingPong<MpmcQueue<std::int64_t>>)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+} // namespace
+} // namespace cppreference::bench
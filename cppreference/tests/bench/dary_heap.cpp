@@ -0,0 +1,192 @@
+#include "bench_common.hpp"
+#include "dary_heap.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace cppreference::bench
+{
+namespace
+{
+
+// 優先度付きキュー: n 個 push してから全て pop
+
+void BM_PriorityQueue_Std(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       values = std::vector<int>(n);
+    FillRandom(values, std::numeric_limits<int>::max());
+
+    for (auto _ : state)
+    {
+        auto pq = std::priority_queue<int>();
+        for (const auto x : values)
+        {
+            pq.push(x);
+        }
+        while (!pq.empty())
+        {
+            benchmark::DoNotOptimize(pq.top());
+            pq.pop();
+        }
+    }
+    SetThroughput(state, n);
+}
+BENCHMARK(BM_PriorityQueue_Std)->Arg(1'000'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+
+template <std::size_t D>
+void BM_PriorityQueue_Dary(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       values = std::vector<int>(n);
+    FillRandom(values, std::numeric_limits<int>::max());
+
+    for (auto _ : state)
+    {
+        auto pq = DaryHeap<int, std::less<int>, D>();
+        for (const auto x : values)
+        {
+            pq.push(x);
+        }
+        while (!pq.empty())
+        {
+            benchmark::DoNotOptimize(pq.top());
+            pq.pop();
+        }
+    }
+    SetThroughput(state, n);
+}
+BENCHMARK(BM_PriorityQueue_Dary<2>)->Arg(1'000'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_PriorityQueue_Dary<4>)->Arg(1'000'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_PriorityQueue_Dary<8>)->Arg(1'000'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+
+// Dijkstra 法: ランダムなグラフ (頂点 n, 各頂点から 4 本の辺) の単一始点最短路
+
+constexpr std::int64_t OUT_DEGREE = 4;
+
+struct Graph
+{
+    std::vector<std::int64_t>        offset; // 頂点 u の辺は [offset[u], offset[u + 1])
+    std::vector<std::pair<int, int>> edges;  // {行き先, 重み}
+};
+
+auto RandomGraph(
+    std::int64_t n
+) -> Graph
+{
+    auto gen = std::mt19937{SEED};
+    auto node = std::uniform_int_distribution<int>(0, static_cast<int>(n) - 1);
+    auto weight = std::uniform_int_distribution<int>(1, 1'000); // NOLINT
+
+    auto g = Graph();
+    for (std::int64_t u = 0; u <= n; ++u)
+    {
+        g.offset.push_back(u * OUT_DEGREE);
+    }
+    for (std::int64_t i = 0; i < n * OUT_DEGREE; ++i)
+    {
+        g.edges.emplace_back(node(gen), weight(gen));
+    }
+    return g;
+}
+
+/**
+ * @brief std::priority_queue は decrease_key がないので、同じ頂点を何度も push して古いものは pop で読み捨てる
+ */
+void BM_Dijkstra_Std(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    const auto g = RandomGraph(n);
+
+    using Item = std::pair<std::int64_t, int>; // {距離, 頂点}
+    for (auto _ : state)
+    {
+        auto dist = std::vector<std::int64_t>(n, std::numeric_limits<std::int64_t>::max());
+        auto pq = std::priority_queue<Item, std::vector<Item>, std::greater<>>();
+        dist[0] = 0;
+        pq.emplace(0, 0);
+        while (!pq.empty())
+        {
+            const auto [d, u] = pq.top();
+            pq.pop();
+            if (d != dist[u])
+            {
+                continue;
+            }
+            for (auto e = g.offset[u]; e < g.offset[u + 1]; ++e)
+            {
+                const auto [v, w] = g.edges[e];
+                if (d + w < dist[v])
+                {
+                    dist[v] = d + w;
+                    pq.emplace(dist[v], v);
+                }
+            }
+        }
+        benchmark::DoNotOptimize(dist.data());
+    }
+    SetThroughput(state, n * OUT_DEGREE);
+}
+BENCHMARK(BM_Dijkstra_Std)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+
+template <std::size_t D>
+void BM_Dijkstra_Dary(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    const auto g = RandomGraph(n);
+
+    using Item = std::pair<std::int64_t, int>;
+    using Heap = DaryHeap<Item, std::greater<>, D>;
+    constexpr auto NONE = std::numeric_limits<typename Heap::handle_type>::max();
+    for (auto _ : state)
+    {
+        auto dist = std::vector<std::int64_t>(n, std::numeric_limits<std::int64_t>::max());
+        auto handle = std::vector<typename Heap::handle_type>(n, NONE);
+        auto pq = Heap();
+        dist[0] = 0;
+        handle[0] = pq.emplace(0, 0);
+        while (!pq.empty())
+        {
+            const auto [d, u] = pq.top();
+            handle[u] = NONE;
+            pq.pop();
+            for (auto e = g.offset[u]; e < g.offset[u + 1]; ++e)
+            {
+                const auto [v, w] = g.edges[e];
+                if (d + w < dist[v])
+                {
+                    dist[v] = d + w;
+                    if (handle[v] == NONE)
+                    {
+                        handle[v] = pq.emplace(dist[v], v);
+                    }
+                    else
+                    {
+                        pq.decrease_key(handle[v], {dist[v], v});
+                    }
+                }
+            }
+        }
+        benchmark::DoNotOptimize(dist.data());
+    }
+    SetThroughput(state, n * OUT_DEGREE);
+}
+BENCHMARK(BM_Dijkstra_Dary<2>)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Dijkstra_Dary<4>)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Dijkstra_Dary<8>)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+
+} // namespace
+} // namespace cppreference::bench
@@ -0,0 +1,154 @@
+#include "bench_common.hpp"
+#include "deterministic_reduce.hpp"
+#include "execution.hpp"
+#include "simd_search.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace cppreference::bench
+{
+namespace
+{
+
+// double の総和: スループットと誤差
+
+auto RandomDoubles(
+    std::int64_t n
+) -> std::vector<double>
+{
+    // 桁の揃わない正負の値で打ち消しを起こす
+    auto gen = std::mt19937_64{SEED};
+    auto mantissa = std::uniform_real_distribution<double>(-1.0, 1.0);
+    auto exponent = std::uniform_int_distribution<int>(-20, 20); // NOLINT
+    auto v = std::vector<double>(n);
+    std::ranges::generate(v, [&]() { return std::ldexp(mantissa(gen), exponent(gen)); });
+    return v;
+}
+
+/**
+ * @brief 真値に近い参照値 (long double で補正付き加算)
+ */
+auto Reference(
+    const std::vector<double>& v
+) -> long double
+{
+    long double sum = 0;
+    long double compensation = 0;
+    for (const auto x : v)
+    {
+        const auto t = sum + x;
+        compensation += (std::abs(sum) >= std::abs(x)) ? ((sum - t) + x) : ((x - t) + sum);
+        sum = t;
+    }
+    return sum + compensation;
+}
+
+void SetError(
+    benchmark::State&          state,
+    const std::vector<double>& v,
+    double                     result
+)
+{
+    const auto reference = Reference(v);
+    state.counters["rel_error"] = static_cast<double>(std::abs((result - reference) / reference));
+}
+
+void BM_SumDouble_Accumulate(
+    benchmark::State& state
+)
+{
+    const auto v = RandomDoubles(state.range(0));
+    double     result = 0;
+    for (auto _ : state)
+    {
+        result = std::accumulate(v.begin(), v.end(), 0.0);
+        benchmark::DoNotOptimize(result);
+    }
+    SetThroughput(state, state.range(0), sizeof(double));
+    SetError(state, v, result);
+}
+BENCHMARK(BM_SumDouble_Accumulate)->Arg(1'000'000)->Arg(100'000'000);
+
+void BM_SumDouble_Reduce(
+    benchmark::State& state
+)
+{
+    const auto v = RandomDoubles(state.range(0));
+    double     result = 0;
+    for (auto _ : state)
+    {
+        result = std::reduce(v.begin(), v.end(), 0.0);
+        benchmark::DoNotOptimize(result);
+    }
+    SetThroughput(state, state.range(0), sizeof(double));
+    SetError(state, v, result);
+}
+BENCHMARK(BM_SumDouble_Reduce)->Arg(1'000'000)->Arg(100'000'000);
+
+// Args: {要素数, 0: Pairwise / 1: Neumaier, 命令セット (0: Scalar, 2: AVX2)}
+void BM_SumDouble_Deterministic(
+    benchmark::State& state
+)
+{
+    const auto v = RandomDoubles(state.range(0));
+    const auto mode = static_cast<Summation>(state.range(1));
+    simd::SetIsa(static_cast<simd::Isa>(state.range(2)));
+
+    double result = 0;
+    for (auto _ : state)
+    {
+        result = cppreference::deterministic_reduce(v.begin(), v.end(), 0.0, mode);
+        benchmark::DoNotOptimize(result);
+    }
+    simd::SetIsa(simd::Isa::Avx2);
+    SetThroughput(state, state.range(0), sizeof(double));
+    SetError(state, v, result);
+}
+BENCHMARK(BM_SumDouble_Deterministic)
+    ->ArgsProduct({{1'000'000, 100'000'000}, {0, 1}, {static_cast<std::int64_t>(simd::Isa::Scalar), static_cast<std::int64_t>(simd::Isa::Avx2)}});
+
+// Args: {要素数, 0: Pairwise / 1: Neumaier, スレッド数}
+void BM_SumDouble_DeterministicPool(
+    benchmark::State& state
+)
+{
+    const auto v = RandomDoubles(state.range(0));
+    const auto mode = static_cast<Summation>(state.range(1));
+    auto       pool = ThreadPool(state.range(2));
+    const auto par = execution::par.on(pool);
+
+    double result = 0;
+    for (auto _ : state)
+    {
+        result = cppreference::deterministic_reduce(par, v.begin(), v.end(), 0.0, mode);
+        benchmark::DoNotOptimize(result);
+    }
+    SetThroughput(state, state.range(0), sizeof(double));
+    SetError(state, v, result);
+}
+
+void PoolArgs(
+    benchmark::internal::Benchmark* b
+)
+{
+    const auto max_threads = static_cast<std::int64_t>(std::max(1U, std::thread::hardware_concurrency()));
+    for (const std::int64_t mode : {0, 1})
+    {
+        for (std::int64_t t = 1; t <= max_threads; t *= 2)
+        {
+            b->Args({100'000'000, mode, t});
+        }
+    }
+    b->UseRealTime();
+}
+BENCHMARK(BM_SumDouble_DeterministicPool)->Apply(PoolArgs);
+
+} // namespace
+} // namespace cppreference::bench
@@ -0,0 +1,198 @@
+#include "bench_common.hpp"
+#include "execution.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+namespace cppreference::bench
+{
+namespace
+{
+
+// ThreadPool 版アルゴリズムのスケーリング
+// Args: {要素数, スレッド数}
+
+void ThreadArgs(
+    benchmark::internal::Benchmark* b
+)
+{
+    const auto max_threads = static_cast<std::int64_t>(std::max(1U, std::thread::hardware_concurrency()));
+    for (const std::int64_t n : {1'000'000, 100'000'000})
+    {
+        for (std::int64_t t = 1; t <= max_threads; t *= 2)
+        {
+            b->Args({n, t});
+        }
+        if ((max_threads & (max_threads - 1)) != 0)
+        {
+            b->Args({n, max_threads});
+        }
+    }
+    b->UseRealTime();
+}
+
+template <typename C>
+void BM_ForEach_Serial(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       r = C(n, 1);
+
+    for (auto _ : state)
+    {
+        std::for_each(r.begin(), r.end(), Flip());
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, n);
+}
+BENCHMARK_TEMPLATE(BM_ForEach_Serial, std::vector<int>)->Arg(1'000'000)->Arg(100'000'000);
+BENCHMARK_TEMPLATE(BM_ForEach_Serial, std::deque<int>)->Arg(1'000'000)->Arg(100'000'000);
+
+template <typename C>
+void BM_ForEach_Pool(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       r = C(n, 1);
+    auto       pool = ThreadPool(state.range(1));
+    const auto par = execution::par.on(pool);
+
+    for (auto _ : state)
+    {
+        cppreference::for_each(par, r.begin(), r.end(), Flip());
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, n);
+}
+BENCHMARK_TEMPLATE(BM_ForEach_Pool, std::vector<int>)->Apply(ThreadArgs);
+BENCHMARK_TEMPLATE(BM_ForEach_Pool, std::deque<int>)->Apply(ThreadArgs);
+
+template <typename C>
+void BM_Transform_Pool(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       r = C(n, 1);
+    auto       d = C(n);
+    auto       pool = ThreadPool(state.range(1));
+    const auto par = execution::par.on(pool);
+
+    for (auto _ : state)
+    {
+        cppreference::transform(par, r.begin(), r.end(), d.begin(), [](const auto& v) { return v * 3; }); // NOLINT
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, n);
+}
+BENCHMARK_TEMPLATE(BM_Transform_Pool, std::vector<int>)->Apply(ThreadArgs);
+BENCHMARK_TEMPLATE(BM_Transform_Pool, std::deque<int>)->Apply(ThreadArgs);
+
+template <typename C>
+void BM_Reduce_Pool(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       r = C(n, 1);
+    auto       pool = ThreadPool(state.range(1));
+    const auto par = execution::par.on(pool);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(cppreference::reduce(par, r.begin(), r.end(), std::int64_t{0}));
+    }
+    SetThroughput(state, n);
+}
+BENCHMARK_TEMPLATE(BM_Reduce_Pool, std::vector<int>)->Apply(ThreadArgs);
+BENCHMARK_TEMPLATE(BM_Reduce_Pool, std::deque<int>)->Apply(ThreadArgs);
+
+// scan は読み書きで要素あたり 2 * sizeof(int) byte 動かす
+
+template <typename C>
+void BM_InclusiveScan_Serial(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       r = C(n, 1);
+    auto       d = C(n);
+
+    for (auto _ : state)
+    {
+        std::inclusive_scan(r.begin(), r.end(), d.begin());
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, n, 2 * sizeof(int));
+}
+BENCHMARK_TEMPLATE(BM_InclusiveScan_Serial, std::vector<int>)->Arg(1'000'000)->Arg(100'000'000);
+BENCHMARK_TEMPLATE(BM_InclusiveScan_Serial, std::deque<int>)->Arg(1'000'000)->Arg(100'000'000);
+
+template <typename C>
+void BM_InclusiveScan_Pool(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       r = C(n, 1);
+    auto       d = C(n);
+    auto       pool = ThreadPool(state.range(1));
+    const auto par = execution::par.on(pool);
+
+    for (auto _ : state)
+    {
+        cppreference::inclusive_scan(par, r.begin(), r.end(), d.begin());
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, n, 2 * sizeof(int));
+}
+BENCHMARK_TEMPLATE(BM_InclusiveScan_Pool, std::vector<int>)->Apply(ThreadArgs);
+BENCHMARK_TEMPLATE(BM_InclusiveScan_Pool, std::deque<int>)->Apply(ThreadArgs);
+
+template <typename C>
+void BM_ExclusiveScan_Serial(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       r = C(n, 1);
+    auto       d = C(n);
+
+    for (auto _ : state)
+    {
+        std::exclusive_scan(r.begin(), r.end(), d.begin(), 0);
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, n, 2 * sizeof(int));
+}
+BENCHMARK_TEMPLATE(BM_ExclusiveScan_Serial, std::vector<int>)->Arg(1'000'000)->Arg(100'000'000);
+
+template <typename C>
+void BM_ExclusiveScan_Pool(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       r = C(n, 1);
+    auto       d = C(n);
+    auto       pool = ThreadPool(state.range(1));
+    const auto par = execution::par.on(pool);
+
+    for (auto _ : state)
+    {
+        cppreference::exclusive_scan(par, r.begin(), r.end(), d.begin(), 0);
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, n, 2 * sizeof(int));
+}
+BENCHMARK_TEMPLATE(BM_ExclusiveScan_Pool, std::vector<int>)->Apply(ThreadArgs);
+
+} // namespace
+} // namespace cppreference::bench
@@ -0,0 +1,69 @@
+#include "bench_common.hpp"
+#include "eytzinger_index.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace cppreference::bench
+{
+namespace
+{
+
+// 読み取り専用のソート済み配列への lower_bound
+// 1 iteration = QUERIES 個のランダムなキー
+
+constexpr std::int64_t QUERIES = 1'024;
+
+auto RandomKeys(
+    std::int64_t n
+) -> std::vector<int>
+{
+    auto keys = std::vector<int>(QUERIES);
+    FillRandom(keys, static_cast<int>(n));
+    return keys;
+}
+
+void BM_LowerBound_Std(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       sorted = std::vector<int>(n);
+    FillIota(sorted);
+    const auto keys = RandomKeys(n);
+
+    for (auto _ : state)
+    {
+        for (const auto key : keys)
+        {
+            benchmark::DoNotOptimize(std::ranges::lower_bound(sorted, key));
+        }
+    }
+    SetThroughput(state, QUERIES);
+}
+BENCHMARK(BM_LowerBound_Std)->Apply(Sizes);
+
+void BM_LowerBound_Eytzinger(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       sorted = std::vector<int>(n);
+    FillIota(sorted);
+    const auto index = EytzingerIndex(sorted);
+    sorted = {};
+    const auto keys = RandomKeys(n);
+
+    for (auto _ : state)
+    {
+        for (const auto key : keys)
+        {
+            benchmark::DoNotOptimize(index.lower_bound(key));
+        }
+    }
+    SetThroughput(state, QUERIES);
+}
+BENCHMARK(BM_LowerBound_Eytzinger)->Apply(Sizes);
+
+} // namespace
+} // namespace cppreference::bench
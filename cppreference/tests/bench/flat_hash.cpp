@@ -0,0 +1,155 @@
+#include "bench_common.hpp"
+#include "flat_hash.hpp"
+#include "hash_diagnostics.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <unordered_set>
+#include <vector>
+
+namespace cppreference::bench
+{
+namespace
+{
+
+// ハッシュ集合の insert / find / erase
+// キーは [0, 2^31) の乱数 n 個 (重複は少ない)。find の失敗は別の系列の乱数
+
+auto RandomKeys(
+    std::int64_t  n,
+    std::uint32_t seed
+) -> std::vector<int>
+{
+    auto keys = std::vector<int>(n);
+    FillRandom(keys, std::numeric_limits<int>::max(), seed);
+    return keys;
+}
+
+/**
+ * @brief ハッシュ表の統計をカウンタに載せ、偏ったハッシュならラベルで知らせる
+ */
+void ReportHashStats(
+    benchmark::State& state,
+    const HashStats&  stats
+)
+{
+    state.counters["load_factor"] = stats.load_factor;
+    state.counters["max_probe"] = static_cast<double>(stats.max_probe);
+    state.counters["mean_probe"] = stats.mean_probe;
+    if (stats.pathological())
+    {
+        state.SetLabel("PATHOLOGICAL HASH");
+    }
+}
+
+void HashSizes(
+    benchmark::internal::Benchmark* b
+)
+{
+    for (const std::int64_t n : {1'000, 100'000, 1'000'000, 10'000'000})
+    {
+        b->Arg(n);
+    }
+}
+
+template <typename Set>
+void BM_HashSet_Insert(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    const auto keys = RandomKeys(n, SEED);
+
+    for (auto _ : state)
+    {
+        auto set = Set();
+        for (const auto k : keys)
+        {
+            set.insert(k);
+        }
+        benchmark::DoNotOptimize(set.size());
+    }
+    SetThroughput(state, n);
+}
+BENCHMARK_TEMPLATE(BM_HashSet_Insert, std::unordered_set<int>)->Apply(HashSizes);
+BENCHMARK_TEMPLATE(BM_HashSet_Insert, FlatHashSet<int>)->Apply(HashSizes);
+
+template <typename Set>
+void BM_HashSet_FindHit(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    const auto keys = RandomKeys(n, SEED);
+    const auto set = Set(keys.begin(), keys.end());
+
+    for (auto _ : state)
+    {
+        for (const auto k : keys)
+        {
+            benchmark::DoNotOptimize(set.find(k));
+        }
+    }
+    SetThroughput(state, n);
+    ReportHashStats(state, AnalyzeHash(set));
+}
+BENCHMARK_TEMPLATE(BM_HashSet_FindHit, std::unordered_set<int>)->Apply(HashSizes);
+BENCHMARK_TEMPLATE(BM_HashSet_FindHit, FlatHashSet<int>)->Apply(HashSizes);
+
+// 下位 8 bit しか使わないハッシュ: ハッシュ値が 256 種類しかなく、どちらの表でも探索が長くなる (ラベルで検出される)
+struct NarrowHash
+{
+    auto operator()(int key) const -> std::size_t { return static_cast<std::size_t>(key) & 0xFFU; } // NOLINT
+};
+BENCHMARK_TEMPLATE(BM_HashSet_FindHit, std::unordered_set<int, NarrowHash>)->Arg(1'000)->Arg(100'000);
+BENCHMARK_TEMPLATE(BM_HashSet_FindHit, FlatHashSet<int, NarrowHash>)->Arg(1'000)->Arg(100'000);
+
+template <typename Set>
+void BM_HashSet_FindMiss(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    const auto keys = RandomKeys(n, SEED);
+    const auto misses = RandomKeys(n, SEED + 1);
+    const auto set = Set(keys.begin(), keys.end());
+
+    for (auto _ : state)
+    {
+        for (const auto k : misses)
+        {
+            benchmark::DoNotOptimize(set.find(k));
+        }
+    }
+    SetThroughput(state, n);
+    ReportHashStats(state, AnalyzeHash(set));
+}
+BENCHMARK_TEMPLATE(BM_HashSet_FindMiss, std::unordered_set<int>)->Apply(HashSizes);
+BENCHMARK_TEMPLATE(BM_HashSet_FindMiss, FlatHashSet<int>)->Apply(HashSizes);
+
+template <typename Set>
+void BM_HashSet_Erase(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    const auto keys = RandomKeys(n, SEED);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto set = Set(keys.begin(), keys.end());
+        state.ResumeTiming();
+        for (const auto k : keys)
+        {
+            set.erase(k);
+        }
+        benchmark::DoNotOptimize(set.size());
+    }
+    SetThroughput(state, n);
+}
+BENCHMARK_TEMPLATE(BM_HashSet_Erase, std::unordered_set<int>)->Apply(HashSizes);
+BENCHMARK_TEMPLATE(BM_HashSet_Erase, FlatHashSet<int>)->Apply(HashSizes);
+
+} // namespace
+} // namespace cppreference::bench
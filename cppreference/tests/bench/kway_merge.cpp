@@ -0,0 +1,159 @@
+#include "bench_common.hpp"
+#include "kway_merge.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace cppreference::bench
+{
+namespace
+{
+
+// k 本のソート済み列のマージ
+// Args: {全要素数, 列の数 k}
+
+auto SortedRuns(
+    std::int64_t n,
+    std::int64_t k
+) -> std::vector<std::vector<int>>
+{
+    auto all = std::vector<int>(n);
+    FillRandom(all, 1'000'000'000); // NOLINT
+
+    auto runs = std::vector<std::vector<int>>(k);
+    for (std::int64_t i = 0; i < k; ++i)
+    {
+        runs[i].assign(all.begin() + (n * i / k), all.begin() + (n * (i + 1) / k));
+        std::ranges::sort(runs[i]);
+    }
+    return runs;
+}
+
+void MergeArgs(
+    benchmark::internal::Benchmark* b
+)
+{
+    b->ArgsProduct({{10'000'000}, {2, 16, 256, 1'024}});
+    b->Unit(benchmark::kMillisecond);
+}
+
+/**
+ * @brief 2 本ずつ std::merge するのを 1 本になるまで繰り返す (log2(k) パス)
+ *
+ * LoserTree と同じく計測中に確保しない: 1 パス目は入力の列から直接 buf に書き、
+ * 以降は確保済みの buf と tmp を交互に使う (列の境界は bounds に持つ)
+ */
+void BM_KWayMerge_Pairwise(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    const auto runs = SortedRuns(n, state.range(1));
+    const auto k = runs.size();
+    auto       buf = std::vector<int>(n);
+    auto       tmp = std::vector<int>(n);
+    auto       bounds = std::vector<std::size_t>();
+    bounds.reserve(k + 1);
+
+    for (auto _ : state)
+    {
+        bounds.assign(1, 0);
+        auto out = buf.begin();
+        for (std::size_t i = 0; i < k; i += 2)
+        {
+            if (i + 1 < k)
+            {
+                out = std::ranges::merge(runs[i], runs[i + 1], out).out;
+            }
+            else
+            {
+                out = std::ranges::copy(runs[i], out).out;
+            }
+            bounds.push_back(static_cast<std::size_t>(out - buf.begin()));
+        }
+
+        auto*      src = &buf;
+        auto*      dst = &tmp;
+        const auto at = [](std::vector<int>* v, std::size_t i) { return v->begin() + static_cast<std::ptrdiff_t>(i); };
+        while (bounds.size() > 2)
+        {
+            // 列 i と i + 1 を併合して列 i / 2 にする (奇数本なら最後の列はそのまま写す)
+            std::size_t m = 0;
+            for (std::size_t i = 0; i + 1 < bounds.size(); i += 2)
+            {
+                const auto lo = bounds[i];
+                const auto mid = bounds[i + 1];
+                const auto hi = (i + 2 < bounds.size()) ? bounds[i + 2] : mid;
+                std::merge(at(src, lo), at(src, mid), at(src, mid), at(src, hi), at(dst, lo));
+                bounds[++m] = hi;
+            }
+            bounds.resize(m + 1);
+            std::swap(src, dst);
+        }
+        benchmark::DoNotOptimize(src->data());
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, n);
+}
+BENCHMARK(BM_KWayMerge_Pairwise)->Apply(MergeArgs);
+
+void BM_KWayMerge_LoserTree(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    const auto runs = SortedRuns(n, state.range(1));
+    auto       out = std::vector<int>(n);
+
+    for (auto _ : state)
+    {
+        cppreference::kway_merge(runs, out.begin());
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, n);
+}
+BENCHMARK(BM_KWayMerge_LoserTree)->Apply(MergeArgs);
+
+// Args: {全要素数, 列の数 k, スレッド数}
+void BM_KWayMerge_Pool(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    const auto runs = SortedRuns(n, state.range(1));
+    auto       out = std::vector<int>(n);
+    auto       pool = ThreadPool(state.range(2));
+    const auto par = execution::par.on(pool);
+
+    for (auto _ : state)
+    {
+        cppreference::kway_merge(par, runs, out.begin());
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, n);
+}
+
+void PoolArgs(
+    benchmark::internal::Benchmark* b
+)
+{
+    const auto max_threads = static_cast<std::int64_t>(std::max(1U, std::thread::hardware_concurrency()));
+    for (const std::int64_t k : {16, 256, 1'024})
+    {
+        for (std::int64_t t = 1; t <= max_threads; t *= 2)
+        {
+            b->Args({10'000'000, k, t});
+        }
+    }
+    b->UseRealTime();
+    b->Unit(benchmark::kMillisecond);
+}
+BENCHMARK(BM_KWayMerge_Pool)->Apply(PoolArgs);
+
+} // namespace
+} // namespace cppreference::bench
@@ -0,0 +1,115 @@
+#include "bench_common.hpp"
+#include "node_pool.hpp"
+#include <cstdint>
+#include <forward_list>
+#include <functional>
+#include <list>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <utility>
+
+namespace cppreference::bench
+{
+namespace
+{
+
+// ノードの確保と解放を繰り返す: Arg 個の要素を入れておき、1 つ消して 1 つ入れるのを CHURN 回繰り返す
+
+constexpr std::int64_t CHURN = 1'000'000;
+
+void ChurnArgs(
+    benchmark::internal::Benchmark* b
+)
+{
+    b->Arg(1 << 10)->Arg(1 << 18)->Unit(benchmark::kMillisecond); // NOLINT
+}
+
+template <template <typename> typename Alloc>
+void BM_NodeChurn_List(
+    benchmark::State& state
+)
+{
+    const auto live = state.range(0);
+    auto       l = std::list<std::int64_t, Alloc<std::int64_t>>();
+    for (std::int64_t i = 0; i < live; ++i)
+    {
+        l.push_back(i);
+    }
+
+    for (auto _ : state)
+    {
+        for (std::int64_t i = 0; i < CHURN; ++i)
+        {
+            l.pop_front();
+            l.push_back(i);
+        }
+        benchmark::DoNotOptimize(l.back());
+    }
+    SetThroughput(state, CHURN);
+}
+BENCHMARK_TEMPLATE(BM_NodeChurn_List, std::allocator)->Apply(ChurnArgs);
+BENCHMARK_TEMPLATE(BM_NodeChurn_List, NodePoolAllocator)->Apply(ChurnArgs);
+
+template <template <typename> typename Alloc>
+void BM_NodeChurn_ForwardList(
+    benchmark::State& state
+)
+{
+    const auto live = state.range(0);
+    auto       l = std::forward_list<std::int64_t, Alloc<std::int64_t>>();
+    for (std::int64_t i = 0; i < live; ++i)
+    {
+        l.push_front(i);
+    }
+
+    for (auto _ : state)
+    {
+        for (std::int64_t i = 0; i < CHURN; ++i)
+        {
+            l.pop_front();
+            l.push_front(i);
+        }
+        benchmark::DoNotOptimize(l.front());
+    }
+    SetThroughput(state, CHURN);
+}
+BENCHMARK_TEMPLATE(BM_NodeChurn_ForwardList, std::allocator)->Apply(ChurnArgs);
+BENCHMARK_TEMPLATE(BM_NodeChurn_ForwardList, NodePoolAllocator)->Apply(ChurnArgs);
+
+/**
+ * @brief 乱数のキーを消して入れ直す
+ */
+template <template <typename> typename Alloc>
+void BM_NodeChurn_UnorderedMap(
+    benchmark::State& state
+)
+{
+    using Map = std::unordered_map<int, int, std::hash<int>, std::equal_to<int>, Alloc<std::pair<const int, int>>>;
+
+    const auto live = static_cast<int>(state.range(0));
+    auto       gen = std::mt19937{SEED};
+    auto       pick = std::uniform_int_distribution<int>(0, live - 1);
+    auto       map = Map();
+    for (int i = 0; i < live; ++i)
+    {
+        map.emplace(i, i);
+    }
+
+    for (auto _ : state)
+    {
+        for (std::int64_t i = 0; i < CHURN; ++i)
+        {
+            const auto k = pick(gen);
+            map.erase(k);
+            map.emplace(k, static_cast<int>(i));
+        }
+        benchmark::DoNotOptimize(map.size());
+    }
+    SetThroughput(state, CHURN);
+}
+BENCHMARK_TEMPLATE(BM_NodeChurn_UnorderedMap, std::allocator)->Apply(ChurnArgs);
+BENCHMARK_TEMPLATE(BM_NodeChurn_UnorderedMap, NodePoolAllocator)->Apply(ChurnArgs);
+
+} // namespace
+} // namespace cppreference::bench
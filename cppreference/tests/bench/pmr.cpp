@@ -0,0 +1,202 @@
+#include "allocation_counter.hpp"
+#include "arena.hpp"
+#include "bench_common.hpp"
+#include <cstdint>
+#include <forward_list>
+#include <memory_resource>
+#include <optional>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace cppreference::bench
+{
+namespace
+{
+
+// 比較の基準は std::pmr::new_delete_resource() (既定のアロケータと同じく operator new で確保する)
+
+constexpr int REQUEST_SIZE = 1'000;
+
+/**
+ * @brief 1 回のリクエストで作っては捨てる一時的なコンテナ
+ */
+auto Request(
+    std::pmr::memory_resource* resource
+) -> std::int64_t
+{
+    auto vec = std::pmr::vector<int>(resource);
+    auto map = std::pmr::unordered_map<int, int>(resource);
+    auto list = std::pmr::forward_list<int>(resource);
+    for (int i = 0; i < REQUEST_SIZE; ++i)
+    {
+        vec.push_back(i);
+        map.emplace(i * 7, i); // NOLINT
+        list.push_front(i);
+    }
+    return static_cast<std::int64_t>(vec.size() + map.size()) + list.front();
+}
+
+void ReportAllocations(
+    benchmark::State&      state,
+    const AllocationScope& scope
+)
+{
+    state.counters["allocs_per_request"] =
+        static_cast<double>(scope.count()) / static_cast<double>(state.iterations());
+}
+
+void BM_PmrRequest_NewDelete(
+    benchmark::State& state
+)
+{
+    const auto scope = AllocationScope();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Request(std::pmr::new_delete_resource()));
+    }
+    ReportAllocations(state, scope);
+    SetThroughput(state, REQUEST_SIZE);
+}
+BENCHMARK(BM_PmrRequest_NewDelete);
+
+/**
+ * @brief リクエストごとに monotonic_buffer_resource を作り、捨てるときにチャンクを全て返す
+ */
+void BM_PmrRequest_Monotonic(
+    benchmark::State& state
+)
+{
+    const auto scope = AllocationScope();
+    for (auto _ : state)
+    {
+        auto resource = std::pmr::monotonic_buffer_resource();
+        benchmark::DoNotOptimize(Request(&resource));
+    }
+    ReportAllocations(state, scope);
+    SetThroughput(state, REQUEST_SIZE);
+}
+BENCHMARK(BM_PmrRequest_Monotonic);
+
+/**
+ * @brief 1 つの Arena をリクエストごとに reset() して使い回す
+ */
+void BM_PmrRequest_Arena(
+    benchmark::State& state
+)
+{
+    auto       arena = Arena();
+    const auto scope = AllocationScope();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Request(&arena));
+        arena.reset();
+    }
+    ReportAllocations(state, scope);
+    SetThroughput(state, REQUEST_SIZE);
+}
+BENCHMARK(BM_PmrRequest_Arena);
+
+// Arg: 表に常に入っているキーの数。乱数のキーを 1 つ消して 1 つ入れるのを CHURN 回繰り返す
+
+constexpr std::int64_t CHURN = 1'000'000;
+
+void Churn(
+    benchmark::State&          state,
+    std::pmr::memory_resource* resource
+)
+{
+    const auto live = static_cast<int>(state.range(0));
+    auto       gen = std::mt19937{SEED};
+    auto       pick = std::uniform_int_distribution<int>(0, live - 1);
+    auto       map = std::pmr::unordered_map<int, int>(resource);
+    for (int i = 0; i < live; ++i)
+    {
+        map.emplace(i, i);
+    }
+
+    const auto scope = AllocationScope();
+    for (auto _ : state)
+    {
+        for (std::int64_t i = 0; i < CHURN; ++i)
+        {
+            const auto k = pick(gen);
+            map.erase(k);
+            map.emplace(k, static_cast<int>(i));
+        }
+        benchmark::DoNotOptimize(map.size());
+    }
+    state.counters["allocs_per_op"] =
+        static_cast<double>(scope.count()) / static_cast<double>(state.iterations() * CHURN);
+    SetThroughput(state, CHURN);
+}
+
+void BM_PmrChurn_NewDelete(
+    benchmark::State& state
+)
+{
+    Churn(state, std::pmr::new_delete_resource());
+}
+BENCHMARK(BM_PmrChurn_NewDelete)->Arg(1 << 10)->Arg(1 << 16)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief 消したノードを unsynchronized_pool_resource が使い回し、pool のチャンクは Arena から切り出す
+ */
+void BM_PmrChurn_PoolArena(
+    benchmark::State& state
+)
+{
+    auto arena = Arena();
+    auto pool = std::pmr::unsynchronized_pool_resource(&arena);
+    Churn(state, &pool);
+}
+BENCHMARK(BM_PmrChurn_PoolArena)->Arg(1 << 10)->Arg(1 << 16)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief 消したノードは使い回さず Arena から切り出し続け、CHURN 回ごとに表を捨てて reset() する
+ *
+ * 他と揃えるため、表を作って live 個のキーを入れるのと、表を捨てて reset() するのは計測から除く
+ */
+void BM_PmrChurn_Arena(
+    benchmark::State& state
+)
+{
+    const auto    live = static_cast<int>(state.range(0));
+    auto          gen = std::mt19937{SEED};
+    auto          pick = std::uniform_int_distribution<int>(0, live - 1);
+    auto          arena = Arena();
+    auto          map = std::optional<std::pmr::unordered_map<int, int>>();
+    std::uint64_t allocs = 0;
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        map.emplace(&arena);
+        for (int i = 0; i < live; ++i)
+        {
+            map->emplace(i, i);
+        }
+        state.ResumeTiming();
+
+        const auto scope = AllocationScope();
+        for (std::int64_t i = 0; i < CHURN; ++i)
+        {
+            const auto k = pick(gen);
+            map->erase(k);
+            map->emplace(k, static_cast<int>(i));
+        }
+        benchmark::DoNotOptimize(map->size());
+        allocs += scope.count();
+
+        state.PauseTiming();
+        map.reset();
+        arena.reset();
+        state.ResumeTiming();
+    }
+    state.counters["allocs_per_op"] = static_cast<double>(allocs) / static_cast<double>(state.iterations() * CHURN);
+    SetThroughput(state, CHURN);
+}
+BENCHMARK(BM_PmrChurn_Arena)->Arg(1 << 10)->Arg(1 << 16)->Unit(benchmark::kMillisecond);
+
+} // namespace
+} // namespace cppreference::bench
@@ -0,0 +1,138 @@
+#include "bench_common.hpp"
+#include "radix_heap.hpp"
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace cppreference::bench
+{
+namespace
+{
+
+using Item = std::pair<std::uint32_t, std::uint32_t>; // {キー, 値}
+using StdHeap = std::priority_queue<Item, std::vector<Item>, std::greater<>>;
+
+// n 個 push してから全て pop
+
+void BM_RadixHeap_PushPop_Std(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       keys = std::vector<int>(n);
+    FillRandom(keys, std::numeric_limits<int>::max());
+
+    for (auto _ : state)
+    {
+        auto pq = StdHeap();
+        for (const auto k : keys)
+        {
+            pq.emplace(k, 0);
+        }
+        while (!pq.empty())
+        {
+            benchmark::DoNotOptimize(pq.top());
+            pq.pop();
+        }
+    }
+    SetThroughput(state, n);
+}
+BENCHMARK(BM_RadixHeap_PushPop_Std)->Arg(1'000'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+
+void BM_RadixHeap_PushPop_Radix(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       keys = std::vector<int>(n);
+    FillRandom(keys, std::numeric_limits<int>::max());
+
+    for (auto _ : state)
+    {
+        auto pq = RadixHeap<std::uint32_t, std::uint32_t>();
+        for (const auto k : keys)
+        {
+            pq.push(k, 0);
+        }
+        while (!pq.empty())
+        {
+            benchmark::DoNotOptimize(pq.top());
+            pq.pop();
+        }
+    }
+    SetThroughput(state, n);
+}
+BENCHMARK(BM_RadixHeap_PushPop_Radix)->Arg(1'000'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+
+// タイマー: 1M 個を保ったまま、最小を取り出して「取り出したキー + 遅延」を push する操作を n 回
+
+constexpr std::int64_t LIVE = 1'000'000;
+constexpr int          MAX_DELAY = 1'000'000;
+
+auto Delays(
+    std::int64_t n
+) -> std::vector<int>
+{
+    auto delays = std::vector<int>(n);
+    FillRandom(delays, MAX_DELAY);
+    return delays;
+}
+
+void BM_RadixHeap_Hold_Std(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    const auto delays = Delays(n + LIVE);
+
+    for (auto _ : state)
+    {
+        auto pq = StdHeap();
+        for (std::int64_t i = 0; i < LIVE; ++i)
+        {
+            pq.emplace(delays[n + i], 0);
+        }
+        for (std::int64_t i = 0; i < n; ++i)
+        {
+            const auto [now, v] = pq.top();
+            pq.pop();
+            pq.emplace(now + delays[i], v + 1);
+        }
+        benchmark::DoNotOptimize(pq.top());
+    }
+    SetThroughput(state, n);
+}
+BENCHMARK(BM_RadixHeap_Hold_Std)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+
+void BM_RadixHeap_Hold_Radix(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    const auto delays = Delays(n + LIVE);
+
+    for (auto _ : state)
+    {
+        auto pq = RadixHeap<std::uint32_t, std::uint32_t>();
+        for (std::int64_t i = 0; i < LIVE; ++i)
+        {
+            pq.push(delays[n + i], 0);
+        }
+        for (std::int64_t i = 0; i < n; ++i)
+        {
+            const auto [now, v] = pq.top();
+            pq.pop();
+            pq.push(now + delays[i], v + 1);
+        }
+        benchmark::DoNotOptimize(pq.top());
+    }
+    SetThroughput(state, n);
+}
+BENCHMARK(BM_RadixHeap_Hold_Radix)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+
+} // namespace
+} // namespace cppreference::bench
@@ -0,0 +1,82 @@
+#include "bench_common.hpp"
+#include "radix_sort.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace cppreference::bench
+{
+namespace
+{
+
+// std::sort と radix_sort の比較 (キーは型の全域から一様に取る)
+
+template <typename T>
+auto RandomKeys(
+    std::int64_t n
+) -> std::vector<T>
+{
+    auto gen = std::mt19937_64{SEED};
+    auto v = std::vector<T>(n);
+    if constexpr (std::floating_point<T>)
+    {
+        auto dist = std::uniform_real_distribution<T>(-1e9, 1e9); // NOLINT
+        std::ranges::generate(v, [&]() { return dist(gen); });
+    }
+    else
+    {
+        auto dist = std::uniform_int_distribution<T>(std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+        std::ranges::generate(v, [&]() { return dist(gen); });
+    }
+    return v;
+}
+
+template <typename T, typename Comp>
+void BM_Sort_Std(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    const auto pristine = RandomKeys<T>(n);
+    auto       v = pristine;
+
+    for (auto _ : state)
+    {
+        Restore(state, v, pristine);
+        std::sort(v.begin(), v.end(), Comp{});
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, n, sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_Sort_Std, std::uint32_t, std::less<>)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_Sort_Std, std::int64_t, std::less<>)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_Sort_Std, float, std::less<>)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_Sort_Std, std::uint32_t, std::greater<>)->Apply(Sizes);
+
+template <typename T, typename Comp>
+void BM_Sort_Radix(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    const auto pristine = RandomKeys<T>(n);
+    auto       v = pristine;
+
+    for (auto _ : state)
+    {
+        Restore(state, v, pristine);
+        cppreference::radix_sort(v.begin(), v.end(), Comp{});
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, n, sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_Sort_Radix, std::uint32_t, std::less<>)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_Sort_Radix, std::int64_t, std::less<>)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_Sort_Radix, float, std::less<>)->Apply(Sizes);
+BENCHMARK_TEMPLATE(BM_Sort_Radix, std::uint32_t, std::greater<>)->Apply(Sizes);
+
+} // namespace
+} // namespace cppreference::bench
@@ -0,0 +1,122 @@
+#include "bench_common.hpp"
+#include "relocatable_vector.hpp"
+#include <cstdint>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cppreference::bench
+{
+namespace
+{
+
+/**
+ * @brief ムーブで元を空にする所有権付きのハンドル (std::unique_ptr と同じ形で、確保はしない)
+ *
+ * ムーブ構築子とデストラクタはトリビアルでないので std::vector は要素ごとに呼ぶが、
+ * 再配置はバイト列のコピーで良いと宣言する
+ */
+struct Handle
+{
+    using is_trivially_relocatable = std::true_type;
+
+    explicit Handle(
+        std::intptr_t v
+    )
+        : id(v)
+    {
+    }
+
+    Handle(
+        Handle&& other
+    ) noexcept
+        : id(std::exchange(other.id, 0))
+    {
+    }
+
+    auto operator=(
+        Handle&& other
+    ) noexcept -> Handle&
+    {
+        id = std::exchange(other.id, 0);
+        return *this;
+    }
+
+    ~Handle()
+    {
+        if (id != 0)
+        {
+            benchmark::DoNotOptimize(id);
+        }
+    }
+
+    Handle(const Handle&) = delete;
+    auto operator=(const Handle&) -> Handle& = delete;
+
+    std::intptr_t id;
+};
+
+/**
+ * @brief reserve せずに push_back で n 要素まで伸ばす
+ */
+template <typename V>
+void BM_VectorGrow(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    for (auto _ : state)
+    {
+        auto v = V();
+        for (std::int64_t i = 1; i <= n; ++i)
+        {
+            v.emplace_back(i);
+        }
+        benchmark::DoNotOptimize(v.data());
+    }
+    SetThroughput(state, n, sizeof(typename V::value_type));
+}
+BENCHMARK_TEMPLATE(BM_VectorGrow, std::vector<std::int64_t>)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(BM_VectorGrow, RelocatableVector<std::int64_t>)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(BM_VectorGrow, std::vector<Handle>)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(BM_VectorGrow, RelocatableVector<Handle>)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+
+/**
+ * @brief n 要素になるまで乱数の位置に insert し、その後乱数の位置から erase して空にする
+ */
+template <typename V>
+void BM_VectorInsertErase(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       positions = std::vector<int>(static_cast<std::size_t>(n));
+    auto       gen = std::mt19937{SEED};
+    for (std::int64_t i = 0; i < n; ++i)
+    {
+        positions[i] = std::uniform_int_distribution<int>(0, static_cast<int>(i))(gen);
+    }
+
+    for (auto _ : state)
+    {
+        auto v = V();
+        for (std::int64_t i = 0; i < n; ++i)
+        {
+            v.emplace(v.begin() + positions[i], i + 1);
+        }
+        for (std::int64_t i = n - 1; i >= 0; --i)
+        {
+            v.erase(v.begin() + positions[i]);
+        }
+        benchmark::DoNotOptimize(v.data());
+    }
+    SetThroughput(state, 2 * n, sizeof(typename V::value_type));
+}
+BENCHMARK_TEMPLATE(BM_VectorInsertErase, std::vector<std::int64_t>)->Arg(1 << 12)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_VectorInsertErase, RelocatableVector<std::int64_t>)->Arg(1 << 12)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_VectorInsertErase, std::vector<Handle>)->Arg(1 << 12)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(BM_VectorInsertErase, RelocatableVector<Handle>)->Arg(1 << 12)->Arg(1 << 14);
+
+} // namespace
+} // namespace cppreference::bench
@@ -0,0 +1,84 @@
+#include "bench_common.hpp"
+#include "sample_sort.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace cppreference::bench
+{
+namespace
+{
+
+// サンプルソートのスケーリング
+// Args: {要素数, スレッド数, 作業領域の上限 (要素数に対する %)}
+
+void SortArgs(
+    benchmark::internal::Benchmark* b
+)
+{
+    const auto max_threads = static_cast<std::int64_t>(std::max(1U, std::thread::hardware_concurrency()));
+    for (const std::int64_t n : {10'000'000, 100'000'000})
+    {
+        for (const std::int64_t scratch : {100, 10, 0})
+        {
+            for (std::int64_t t = 1; t <= max_threads; t *= 2)
+            {
+                b->Args({n, t, scratch});
+            }
+            if ((max_threads & (max_threads - 1)) != 0)
+            {
+                b->Args({n, max_threads, scratch});
+            }
+        }
+    }
+    b->UseRealTime();
+    b->Unit(benchmark::kMillisecond);
+}
+
+void BM_Sort_Serial(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       pristine = std::vector<int>(n);
+    FillRandom(pristine, 1'000'000'000); // NOLINT
+    auto v = pristine;
+
+    for (auto _ : state)
+    {
+        Restore(state, v, pristine);
+        std::sort(v.begin(), v.end(), std::greater{});
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, n);
+}
+BENCHMARK(BM_Sort_Serial)->Arg(10'000'000)->Arg(100'000'000)->Unit(benchmark::kMillisecond);
+
+void BM_Sort_Pool(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       pristine = std::vector<int>(n);
+    FillRandom(pristine, 1'000'000'000); // NOLINT
+    auto v = pristine;
+
+    auto       pool = ThreadPool(state.range(1));
+    const auto par = execution::par.on(pool);
+    const auto scratch = static_cast<std::size_t>(n * state.range(2) / 100) * sizeof(int); // NOLINT
+
+    for (auto _ : state)
+    {
+        Restore(state, v, pristine);
+        cppreference::sort(par, v.begin(), v.end(), std::greater{}, scratch);
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, n);
+}
+BENCHMARK(BM_Sort_Pool)->Apply(SortArgs);
+
+} // namespace
+} // namespace cppreference::bench
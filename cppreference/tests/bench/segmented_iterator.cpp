@@ -0,0 +1,130 @@
+#include "bench_common.hpp"
+#include "segmented_iterator.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <numeric>
+
+namespace cppreference::bench
+{
+namespace
+{
+
+// std::deque<int> に対する std の版 (反復子の ++ ごとにブロックの境界を確かめる) と、
+// ブロックごとの内側のループに分けた cppreference の版の比較 (どちらも逐次)
+
+void DequeArgs(
+    benchmark::internal::Benchmark* b
+)
+{
+    b->Arg(1'000'000)->Arg(MAX_NODE_SIZE); // NOLINT
+}
+
+template <bool Segmented>
+void BM_Deque_ForEach(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       r = std::deque<int>(n, 1);
+
+    for (auto _ : state)
+    {
+        if constexpr (Segmented)
+        {
+            cppreference::for_each(r.begin(), r.end(), Flip());
+        }
+        else
+        {
+            std::for_each(r.begin(), r.end(), Flip());
+        }
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, n);
+}
+BENCHMARK_TEMPLATE(BM_Deque_ForEach, false)->Apply(DequeArgs);
+BENCHMARK_TEMPLATE(BM_Deque_ForEach, true)->Apply(DequeArgs);
+
+template <bool Segmented>
+void BM_Deque_Reduce(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       r = std::deque<int>(n);
+    FillRandom(r, 1'000); // NOLINT
+
+    for (auto _ : state)
+    {
+        if constexpr (Segmented)
+        {
+            benchmark::DoNotOptimize(cppreference::reduce(r.begin(), r.end(), std::int64_t{0}));
+        }
+        else
+        {
+            benchmark::DoNotOptimize(std::reduce(r.begin(), r.end(), std::int64_t{0}));
+        }
+    }
+    SetThroughput(state, n);
+}
+BENCHMARK_TEMPLATE(BM_Deque_Reduce, false)->Apply(DequeArgs);
+BENCHMARK_TEMPLATE(BM_Deque_Reduce, true)->Apply(DequeArgs);
+
+/**
+ * @brief 存在しない値を探す (全要素を読む)
+ */
+template <bool Segmented>
+void BM_Deque_Find(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       r = std::deque<int>(n);
+    FillRandom(r, 1'000); // NOLINT
+
+    for (auto _ : state)
+    {
+        if constexpr (Segmented)
+        {
+            benchmark::DoNotOptimize(cppreference::find(r.begin(), r.end(), -1));
+        }
+        else
+        {
+            benchmark::DoNotOptimize(std::find(r.begin(), r.end(), -1));
+        }
+    }
+    SetThroughput(state, n);
+}
+BENCHMARK_TEMPLATE(BM_Deque_Find, false)->Apply(DequeArgs);
+BENCHMARK_TEMPLATE(BM_Deque_Find, true)->Apply(DequeArgs);
+
+// libstdc++ の std::fill / std::copy は deque の反復子をブロックごとに処理するよう多重定義されている
+
+template <bool Segmented>
+void BM_Deque_Copy(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       r = std::deque<int>(n, 1);
+    auto       d = std::deque<int>(n + 7); // 出力のブロックの境界をずらす
+
+    for (auto _ : state)
+    {
+        if constexpr (Segmented)
+        {
+            cppreference::copy(r.begin(), r.end(), d.begin() + 7);
+        }
+        else
+        {
+            std::copy(r.begin(), r.end(), d.begin() + 7);
+        }
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, n, 2 * sizeof(int));
+}
+BENCHMARK_TEMPLATE(BM_Deque_Copy, false)->Apply(DequeArgs);
+BENCHMARK_TEMPLATE(BM_Deque_Copy, true)->Apply(DequeArgs);
+
+} // namespace
+} // namespace cppreference::bench
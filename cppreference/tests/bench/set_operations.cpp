@@ -0,0 +1,138 @@
+#include "bench_common.hpp"
+#include "set_operations.hpp"
+#include "simd_search.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace cppreference::bench
+{
+namespace
+{
+
+// ポスティングリストの共通部分・和集合
+// Args: {長い方の要素数, 長さの比}
+
+constexpr std::int64_t LARGE_SIZE = 1'000'000;
+
+/**
+ * @brief 重複のないソート済みの uint32_t 列を 2 本作る (値の範囲は長い方の 4 倍なので、短い方の約 1/4 が一致する)
+ */
+auto PostingLists(
+    std::int64_t n,
+    std::int64_t ratio
+) -> std::pair<std::vector<std::uint32_t>, std::vector<std::uint32_t>>
+{
+    const auto bound = static_cast<int>(4 * n);
+    const auto make = [&](std::int64_t size, std::uint32_t seed) {
+        auto v = std::vector<int>(size);
+        FillRandom(v, bound, seed);
+        std::ranges::sort(v);
+        v.erase(std::ranges::unique(v).begin(), v.end());
+        return std::vector<std::uint32_t>(v.begin(), v.end());
+    };
+    return {make(n / ratio, SEED), make(n, SEED + 1)};
+}
+
+void RatioArgs(
+    benchmark::internal::Benchmark* b
+)
+{
+    b->ArgsProduct({{LARGE_SIZE}, {1, 4, 16, 64, 256, 1'024, 16'384}});
+}
+
+void BM_SetIntersection_Std(
+    benchmark::State& state
+)
+{
+    const auto [small, large] = PostingLists(state.range(0), state.range(1));
+    auto       out = std::vector<std::uint32_t>(small.size());
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            std::set_intersection(small.begin(), small.end(), large.begin(), large.end(), out.begin())
+        );
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, static_cast<std::int64_t>(small.size() + large.size()), sizeof(std::uint32_t));
+}
+BENCHMARK(BM_SetIntersection_Std)->Apply(RatioArgs);
+
+void BM_SetIntersection_Gallop(
+    benchmark::State& state
+)
+{
+    const auto [small, large] = PostingLists(state.range(0), state.range(1));
+    auto       out = std::vector<std::uint32_t>(small.size());
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            cppreference::set_intersection(small.begin(), small.end(), large.begin(), large.end(), out.begin())
+        );
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, static_cast<std::int64_t>(small.size() + large.size()), sizeof(std::uint32_t));
+}
+BENCHMARK(BM_SetIntersection_Gallop)->Apply(RatioArgs);
+
+// Args: {長い方の要素数, 長さの比, 命令セット (0: Scalar, 1: SSE4.2, 2: AVX2)}
+void BM_SetIntersection_SortedUnique(
+    benchmark::State& state
+)
+{
+    const auto [small, large] = PostingLists(state.range(0), state.range(1));
+    auto       out = std::vector<std::uint32_t>(small.size());
+    simd::SetIsa(static_cast<simd::Isa>(state.range(2)));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(cppreference::set_intersection(
+            sorted_unique, small.begin(), small.end(), large.begin(), large.end(), out.begin()
+        ));
+        benchmark::ClobberMemory();
+    }
+    simd::SetIsa(simd::Isa::Avx2);
+    SetThroughput(state, static_cast<std::int64_t>(small.size() + large.size()), sizeof(std::uint32_t));
+}
+BENCHMARK(BM_SetIntersection_SortedUnique)->ArgsProduct({{LARGE_SIZE}, {1, 4, 16, 64, 256, 1'024, 16'384}, {0, 1, 2}});
+
+void BM_SetUnion_Std(
+    benchmark::State& state
+)
+{
+    const auto [small, large] = PostingLists(state.range(0), state.range(1));
+    auto       out = std::vector<std::uint32_t>(small.size() + large.size());
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::set_union(small.begin(), small.end(), large.begin(), large.end(), out.begin()));
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, static_cast<std::int64_t>(small.size() + large.size()), sizeof(std::uint32_t));
+}
+BENCHMARK(BM_SetUnion_Std)->Apply(RatioArgs);
+
+void BM_SetUnion_Gallop(
+    benchmark::State& state
+)
+{
+    const auto [small, large] = PostingLists(state.range(0), state.range(1));
+    auto       out = std::vector<std::uint32_t>(small.size() + large.size());
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            cppreference::set_union(small.begin(), small.end(), large.begin(), large.end(), out.begin())
+        );
+        benchmark::ClobberMemory();
+    }
+    SetThroughput(state, static_cast<std::int64_t>(small.size() + large.size()), sizeof(std::uint32_t));
+}
+BENCHMARK(BM_SetUnion_Gallop)->Apply(RatioArgs);
+
+} // namespace
+} // namespace cppreference::bench
@@ -0,0 +1,159 @@
+#include "bench_common.hpp"
+#include "simd_search.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace cppreference::bench
+{
+namespace
+{
+
+// std の線形探索と simd:: 版の比較
+// Args: {要素数, 命令セット (0: std, 1: Scalar, 2: SSE4.2, 3: AVX2)}
+// 見つからない値を探すので、全要素を走査する
+
+constexpr int STD = 0;
+
+void IsaArgs(
+    benchmark::internal::Benchmark* b
+)
+{
+    for (const std::int64_t n : {1 << 18, 1 << 22}) // 1 MiB, 16 MiB (int)
+    {
+        for (std::int64_t isa = STD; isa <= static_cast<std::int64_t>(simd::Isa::Avx2) + 1; ++isa)
+        {
+            b->Args({n, isa});
+        }
+    }
+}
+
+/**
+ * @brief ベンチマーク対象の命令セットを設定する。std を測るなら true
+ */
+auto UseStd(
+    benchmark::State& state
+) -> bool
+{
+    const auto isa = state.range(1);
+    if (isa == STD)
+    {
+        state.SetLabel("std");
+        return true;
+    }
+
+    simd::SetIsa(static_cast<simd::Isa>(isa - 1));
+    state.SetLabel(
+        (simd::CurrentIsa() == simd::Isa::Avx2)    ? "avx2"
+        : (simd::CurrentIsa() == simd::Isa::Sse42) ? "sse4.2"
+                                                   : "scalar"
+    );
+    return false;
+}
+
+void BM_Find(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       v = std::vector<int>(n);
+    FillRandom(v, 1'000'000); // NOLINT
+    const auto use_std = UseStd(state);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            use_std ? std::find(v.begin(), v.end(), -1) : simd::find(v.begin(), v.end(), -1)
+        );
+    }
+    simd::SetIsa(simd::Isa::Avx2);
+    SetThroughput(state, n);
+}
+BENCHMARK(BM_Find)->Apply(IsaArgs);
+
+void BM_Count(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       v = std::vector<int>(n);
+    FillRandom(v, 1'000); // NOLINT
+    const auto use_std = UseStd(state);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            use_std ? std::count(v.begin(), v.end(), 500) : simd::count(v.begin(), v.end(), 500) // NOLINT
+        );
+    }
+    simd::SetIsa(simd::Isa::Avx2);
+    SetThroughput(state, n);
+}
+BENCHMARK(BM_Count)->Apply(IsaArgs);
+
+void BM_AllOf(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       v = std::vector<int>(n);
+    FillRandom(v, 1'000'000); // NOLINT
+    const auto use_std = UseStd(state);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            use_std ? std::all_of(v.begin(), v.end(), [](const int& x) { return x >= 0; })
+                    : simd::all_of(v.begin(), v.end(), simd::ge(0))
+        );
+    }
+    simd::SetIsa(simd::Isa::Avx2);
+    SetThroughput(state, n);
+}
+BENCHMARK(BM_AllOf)->Apply(IsaArgs);
+
+void BM_AnyOf(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       v = std::vector<int>(n);
+    FillRandom(v, 1'000'000); // NOLINT
+    const auto use_std = UseStd(state);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            use_std ? std::any_of(v.begin(), v.end(), [](const int& x) { return x < 0; })
+                    : simd::any_of(v.begin(), v.end(), simd::lt(0))
+        );
+    }
+    simd::SetIsa(simd::Isa::Avx2);
+    SetThroughput(state, n);
+}
+BENCHMARK(BM_AnyOf)->Apply(IsaArgs);
+
+void BM_Mismatch(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       v1 = std::vector<int>(n);
+    FillRandom(v1, 1'000'000); // NOLINT
+    const auto v2 = v1;
+    const auto use_std = UseStd(state);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            use_std ? std::mismatch(v1.begin(), v1.end(), v2.begin())
+                    : simd::mismatch(v1.begin(), v1.end(), v2.begin())
+        );
+    }
+    simd::SetIsa(simd::Isa::Avx2);
+    SetThroughput(state, n, 2 * sizeof(int));
+}
+BENCHMARK(BM_Mismatch)->Apply(IsaArgs);
+
+} // namespace
+} // namespace cppreference::bench
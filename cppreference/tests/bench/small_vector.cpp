@@ -0,0 +1,48 @@
+#include "allocation_counter.hpp"
+#include "bench_common.hpp"
+#include "small_vector.hpp"
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace cppreference::bench
+{
+namespace
+{
+
+// 短命な小さい配列を VECTORS 個作っては捨てる (関数内の一時的なリストを想定)
+// Arg: 1 つの配列の要素数 (SmallVector のオブジェクト内の容量は 8)
+
+constexpr std::int64_t VECTORS = 100'000;
+
+template <typename V>
+void BM_ShortLivedVector(
+    benchmark::State& state
+)
+{
+    const auto len = static_cast<int>(state.range(0));
+
+    const auto scope = AllocationScope();
+    for (auto _ : state)
+    {
+        std::int64_t sum = 0;
+        for (std::int64_t i = 0; i < VECTORS; ++i)
+        {
+            auto v = V();
+            for (int j = 0; j < len; ++j)
+            {
+                v.push_back(static_cast<int>(i) + j);
+            }
+            sum += std::accumulate(v.begin(), v.end(), std::int64_t{0});
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    const auto vectors = static_cast<double>(state.iterations() * VECTORS);
+    state.counters["allocs_per_vector"] = static_cast<double>(scope.count()) / vectors;
+    SetThroughput(state, VECTORS * len);
+}
+BENCHMARK_TEMPLATE(BM_ShortLivedVector, std::vector<int>)->Arg(3)->Arg(8)->Arg(32);    // NOLINT
+BENCHMARK_TEMPLATE(BM_ShortLivedVector, SmallVector<int, 8>)->Arg(3)->Arg(8)->Arg(32); // NOLINT
+
+} // namespace
+} // namespace cppreference::bench
@@ -0,0 +1,99 @@
+#include "allocation_counter.hpp"
+#include "bench_common.hpp"
+#include "flat_hash.hpp"
+#include "string_hash.hpp"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace cppreference::bench
+{
+namespace
+{
+
+// std::string_view で文字列キーの表を引く
+// キーは SSO (libstdc++ で 15 文字) に収まらない長さにして、一時的な std::string が確保を伴うようにする
+
+constexpr std::int64_t KEYS = 100'000;
+
+auto Keys() -> std::vector<std::string>
+{
+    auto ids = std::vector<int>(KEYS);
+    FillIota(ids);
+    auto keys = std::vector<std::string>();
+    keys.reserve(ids.size());
+    for (const auto id : ids)
+    {
+        keys.push_back("/usr/share/cppreference/" + std::to_string(id));
+    }
+    return keys;
+}
+
+void ReportAllocations(
+    benchmark::State&      state,
+    const AllocationScope& scope
+)
+{
+    const auto lookups = static_cast<double>(state.iterations() * KEYS);
+    state.counters["allocs_per_lookup"] = static_cast<double>(scope.count()) / lookups;
+}
+
+/**
+ * @brief 透過的でないハッシュでは std::string を作ってから探す
+ */
+void BM_StringLookup_Std(
+    benchmark::State& state
+)
+{
+    const auto keys = Keys();
+    const auto views = std::vector<std::string_view>(keys.begin(), keys.end());
+    auto       map = std::unordered_map<std::string, int>();
+    for (const auto& k : keys)
+    {
+        map.emplace(k, 0);
+    }
+
+    const auto scope = AllocationScope();
+    for (auto _ : state)
+    {
+        for (const auto v : views)
+        {
+            benchmark::DoNotOptimize(map.find(std::string(v)));
+        }
+    }
+    ReportAllocations(state, scope);
+    SetThroughput(state, KEYS);
+}
+BENCHMARK(BM_StringLookup_Std);
+
+template <typename Map>
+void BM_StringLookup_Transparent(
+    benchmark::State& state
+)
+{
+    const auto keys = Keys();
+    const auto views = std::vector<std::string_view>(keys.begin(), keys.end());
+    auto       map = Map();
+    for (const auto& k : keys)
+    {
+        map.emplace(k, 0);
+    }
+
+    const auto scope = AllocationScope();
+    for (auto _ : state)
+    {
+        for (const auto v : views)
+        {
+            benchmark::DoNotOptimize(map.find(v));
+        }
+    }
+    ReportAllocations(state, scope);
+    SetThroughput(state, KEYS);
+}
+BENCHMARK_TEMPLATE(BM_StringLookup_Transparent, StringMap<int>);
+BENCHMARK_TEMPLATE(BM_StringLookup_Transparent, FlatHashMap<std::string, int, StringHash, StringEqual>);
+
+} // namespace
+} // namespace cppreference::bench
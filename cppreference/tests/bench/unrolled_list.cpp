@@ -0,0 +1,108 @@
+#include "bench_common.hpp"
+#include "unrolled_list.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <forward_list>
+#include <numeric>
+#include <vector>
+
+namespace cppreference::bench
+{
+namespace
+{
+
+// std::forward_list<int> (ノード 1 つに 1 要素) と UnrolledForwardList<int> (キャッシュライン 1 本に 12 要素) の比較
+
+void ListArgs(
+    benchmark::internal::Benchmark* b
+)
+{
+    b->Arg(1'000'000)->Arg(MAX_NODE_SIZE)->Unit(benchmark::kMillisecond); // NOLINT
+}
+
+template <typename L>
+auto RandomList(
+    std::int64_t  n,
+    std::uint32_t seed = SEED
+) -> L
+{
+    auto src = std::vector<int>(static_cast<std::size_t>(n));
+    FillRandom(src, static_cast<int>(n), seed);
+    return L(src.begin(), src.end());
+}
+
+/**
+ * @brief ソート後の走査 (std::forward_list はソートでノードの並びがアドレス順でなくなる)
+ */
+template <typename L>
+void BM_ForwardListTraverse(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+    auto       l = RandomList<L>(n);
+    l.sort();
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::accumulate(l.begin(), l.end(), std::int64_t{0}));
+    }
+    SetThroughput(state, n);
+}
+BENCHMARK_TEMPLATE(BM_ForwardListTraverse, std::forward_list<int>)->Apply(ListArgs);
+BENCHMARK_TEMPLATE(BM_ForwardListTraverse, UnrolledForwardList<int>)->Apply(ListArgs);
+
+template <typename L>
+void BM_ForwardListSort(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto l = RandomList<L>(n);
+        state.ResumeTiming();
+        l.sort();
+        benchmark::DoNotOptimize(l.front());
+        state.PauseTiming();
+        l = L();
+        state.ResumeTiming();
+    }
+    SetThroughput(state, n);
+}
+BENCHMARK_TEMPLATE(BM_ForwardListSort, std::forward_list<int>)->Apply(ListArgs);
+BENCHMARK_TEMPLATE(BM_ForwardListSort, UnrolledForwardList<int>)->Apply(ListArgs);
+
+/**
+ * @brief n / 2 要素ずつのソート済みのリストの併合
+ */
+template <typename L>
+void BM_ForwardListMerge(
+    benchmark::State& state
+)
+{
+    const auto n = state.range(0);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto l1 = RandomList<L>(n / 2);
+        auto l2 = RandomList<L>(n / 2, SEED + 1);
+        l1.sort();
+        l2.sort();
+        state.ResumeTiming();
+        l1.merge(l2);
+        benchmark::DoNotOptimize(l1.front());
+        state.PauseTiming();
+        l1 = L();
+        state.ResumeTiming();
+    }
+    SetThroughput(state, n);
+}
+BENCHMARK_TEMPLATE(BM_ForwardListMerge, std::forward_list<int>)->Apply(ListArgs);
+BENCHMARK_TEMPLATE(BM_ForwardListMerge, UnrolledForwardList<int>)->Apply(ListArgs);
+
+} // namespace
+} // namespace cppreference::bench
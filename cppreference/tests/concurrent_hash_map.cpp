@@ -0,0 +1,84 @@
+#include "concurrent_hash_map.hpp"
+#include "gtest/gtest.h"
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+TEST(
+    concurrent_hash_map, Basics
+)
+{
+    auto cm = cppreference::ConcurrentHashMap<std::string, int>(3); // NOLINT
+    EXPECT_EQ(4, cm.shard_count());
+    EXPECT_TRUE(cm.empty());
+
+    // insert_or_assign, upsert, find
+    EXPECT_TRUE(cm.insert_or_assign("one", 1));
+    EXPECT_FALSE(cm.insert_or_assign("one", 10)); // NOLINT
+    EXPECT_EQ(10, cm.find("one"));
+    EXPECT_EQ(std::nullopt, cm.find("two"));
+
+    EXPECT_TRUE(cm.upsert("two", [](int& v) { v += 2; }));
+    EXPECT_FALSE(cm.upsert("two", [](int& v) { v += 2; }));
+    EXPECT_EQ(4, cm.find("two"));
+    EXPECT_TRUE(cm.contains("two"));
+    EXPECT_EQ(2, cm.size());
+
+    // erase, for_each
+    EXPECT_TRUE(cm.erase("one"));
+    EXPECT_FALSE(cm.erase("one"));
+    auto all = std::map<std::string, int>();
+    cm.for_each([&](const std::string& k, int v) { all.emplace(k, v); });
+    EXPECT_EQ((std::map<std::string, int>{{"two", 4}}), all);
+}
+
+TEST(
+    concurrent_hash_map, Threads
+)
+{
+    constexpr int THREADS = 4;
+    constexpr int KEYS = 1'000;
+    constexpr int ROUNDS = 20;
+
+    // 全スレッドが同じキーの集合を数え上げる
+    auto counts = cppreference::ConcurrentHashMap<int, int>();
+    auto last = cppreference::ConcurrentHashMap<int, int>(2); // 最小の 2 シャード (全員が 2 つのロックを取り合う)
+    {
+        auto threads = std::vector<std::jthread>();
+        for (int t = 0; t < THREADS; ++t)
+        {
+            threads.emplace_back([&, t]() {
+                for (int r = 0; r < ROUNDS; ++r)
+                {
+                    for (int k = 0; k < KEYS; ++k)
+                    {
+                        counts.upsert(k, [](int& v) { ++v; });
+                        last.insert_or_assign(k, t);
+                        EXPECT_TRUE(counts.find(k).has_value());
+                    }
+                }
+            });
+        }
+    }
+
+    EXPECT_EQ(2zU, last.shard_count());
+    EXPECT_EQ(KEYS, counts.size());
+    std::size_t visited = 0;
+    counts.for_each([&](int /* k */, int v) {
+        EXPECT_EQ(THREADS * ROUNDS, v);
+        ++visited;
+    });
+    EXPECT_EQ(KEYS, visited);
+    last.for_each([&](int /* k */, int t) {
+        EXPECT_LE(0, t);
+        EXPECT_GT(THREADS, t);
+    });
+}
+
+} // namespace
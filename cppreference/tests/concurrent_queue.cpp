@@ -0,0 +1,216 @@
+#include "concurrent_queue.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+
+TEST(
+    concurrent_queue, SpscQueue
+)
+{
+    // 容量は 2 の冪に切り上げ
+    auto que = cppreference::SpscQueue<std::string>(3); // NOLINT
+    EXPECT_EQ(4, que.capacity());
+    EXPECT_TRUE(que.empty());
+    EXPECT_EQ(nullptr, que.front());
+    EXPECT_FALSE(que.try_pop());
+
+    // push, emplace, front, pop
+    que.push("a");
+    que.emplace(3, 'b'); // NOLINT
+    EXPECT_TRUE(que.try_push("c"));
+    EXPECT_TRUE(que.try_emplace("d"));
+    EXPECT_FALSE(que.try_push("e"));
+    EXPECT_EQ(4, que.size());
+
+    static_assert(std::is_same_v<decltype(que.front()), std::string*>);
+    EXPECT_EQ("a", *que.front());
+    que.pop();
+    EXPECT_EQ("bbb", que.try_pop());
+    EXPECT_EQ(2, que.size());
+
+    // まとめて push / pop (空いている 2 個だけ入る)
+    const auto words = std::vector<std::string>({"e", "f", "g"});
+    EXPECT_EQ(words.begin() + 2, que.try_push(words.begin(), words.end()));
+
+    auto out = std::vector<std::string>();
+    que.try_pop(std::back_inserter(out), 3); // NOLINT
+    EXPECT_EQ(std::vector<std::string>({"c", "d", "e"}), out);
+    EXPECT_EQ("f", que.try_pop());
+    EXPECT_TRUE(que.empty());
+
+    // 残った要素はデストラクタで破棄
+    auto owner = std::make_shared<int>(0);
+    {
+        auto ptrs = cppreference::SpscQueue<std::shared_ptr<int>>(2);
+        ptrs.push(owner);
+        ptrs.push(owner);
+        EXPECT_EQ(3, owner.use_count());
+    }
+    EXPECT_EQ(1, owner.use_count());
+}
+
+TEST(
+    concurrent_queue, SpscQueue_Threads
+)
+{
+    constexpr int N = 200'000;
+
+    auto que = cppreference::SpscQueue<int>(64); // NOLINT
+    auto producer = std::jthread([&]() {
+        auto batch = std::vector<int>(8); // NOLINT
+        for (int i = 0; i < N;)
+        {
+            // 1 個ずつとまとめてを交互に
+            if (i % 2 == 0)
+            {
+                que.push(i++);
+                continue;
+            }
+            const auto n = std::min<int>(batch.size(), N - i);
+            std::iota(batch.begin(), batch.begin() + n, i);
+            auto it = batch.begin();
+            while (it != batch.begin() + n)
+            {
+                it = que.try_push(it, batch.begin() + n);
+                std::this_thread::yield();
+            }
+            i += n;
+        }
+    });
+
+    // 受け取る順序は push した順序
+    int expected = 0;
+    while (expected < N)
+    {
+        if (auto* p = que.front())
+        {
+            ASSERT_EQ(expected++, *p);
+            que.pop();
+        }
+        auto buf = std::array<int, 5>(); // NOLINT
+        const auto* end = que.try_pop(buf.data(), buf.size());
+        for (const auto* p = buf.data(); p != end; ++p)
+        {
+            ASSERT_EQ(expected++, *p);
+        }
+        if (end == buf.data())
+        {
+            std::this_thread::yield();
+        }
+    }
+    EXPECT_TRUE(que.empty());
+}
+
+TEST(
+    concurrent_queue, MpmcQueue
+)
+{
+    auto que = cppreference::MpmcQueue<std::unique_ptr<int>>(2);
+    EXPECT_EQ(2, que.capacity());
+    EXPECT_FALSE(que.try_pop());
+
+    que.push(std::make_unique<int>(1));
+    que.emplace(new int(2)); // NOLINT
+    EXPECT_FALSE(que.try_push(std::make_unique<int>(3)));
+    EXPECT_EQ(2, que.size());
+    EXPECT_EQ(1, **que.try_pop());
+    EXPECT_EQ(2, **que.try_pop());
+    EXPECT_TRUE(que.empty());
+
+    // まとめて push / pop
+    auto ints = cppreference::MpmcQueue<int>(4);
+    const auto vec1 = std::vector<int>({1, 2, 3, 4, 5}); // NOLINT
+    EXPECT_EQ(vec1.begin() + 4, ints.try_push(vec1.begin(), vec1.end()));
+    auto out = std::vector<int>();
+    ints.try_pop(std::back_inserter(out), 3); // NOLINT
+    EXPECT_EQ(std::vector<int>({1, 2, 3}), out);
+    EXPECT_EQ(vec1.begin() + 3, ints.try_push(vec1.begin(), vec1.begin() + 3));
+    ints.try_pop(std::back_inserter(out), 10); // NOLINT
+    EXPECT_EQ(std::vector<int>({1, 2, 3, 4, 1, 2, 3}), out);
+}
+
+TEST(
+    concurrent_queue, MpmcQueue_Threads
+)
+{
+    constexpr int PRODUCERS = 4;
+    constexpr int CONSUMERS = 3;
+    constexpr int N = 20'000; // 生産者 1 つあたり
+
+    auto que = cppreference::MpmcQueue<int>(128); // NOLINT
+    auto received = std::vector<std::vector<int>>(CONSUMERS);
+    {
+        auto threads = std::vector<std::jthread>();
+        for (int p = 0; p < PRODUCERS; ++p)
+        {
+            threads.emplace_back([&, p]() {
+                for (int i = 0; i < N; i += 2)
+                {
+                    const auto pair = std::array<int, 2>({(p * N) + i, (p * N) + i + 1});
+                    auto       it = pair.begin();
+                    que.push(*it++);
+                    while (it != pair.end())
+                    {
+                        it = que.try_push(it, pair.end());
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        auto remaining = std::atomic<int>(PRODUCERS * N);
+        for (int c = 0; c < CONSUMERS; ++c)
+        {
+            threads.emplace_back([&, c]() {
+                auto& mine = received[c];
+                while (remaining.load() > 0)
+                {
+                    if (auto v = que.try_pop())
+                    {
+                        mine.push_back(*v);
+                        --remaining;
+                    }
+                    const auto n = mine.size();
+                    que.try_pop(std::back_inserter(mine), 4); // NOLINT
+                    if (mine.size() == n)
+                    {
+                        std::this_thread::yield();
+                    }
+                    remaining -= static_cast<int>(mine.size() - n);
+                }
+            });
+        }
+    }
+
+    // 全ての値をちょうど 1 回ずつ受け取り、同じ生産者の値は push した順に届く
+    auto all = std::vector<int>();
+    for (const auto& mine : received)
+    {
+        for (int p = 0; p < PRODUCERS; ++p)
+        {
+            auto from = std::vector<int>();
+            std::ranges::copy_if(mine, std::back_inserter(from), [&](int v) { return v / N == p; });
+            EXPECT_TRUE(std::ranges::is_sorted(from));
+        }
+        all.insert(all.end(), mine.begin(), mine.end());
+    }
+    std::ranges::sort(all);
+    auto expected = std::vector<int>(PRODUCERS * N);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(expected, all);
+    EXPECT_TRUE(que.empty());
+}
+
+} // namespace
@@ -0,0 +1,164 @@
+#include "dary_heap.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+TEST(
+    dary_heap, priority_queue
+)
+{
+    auto vec1 = std::vector<int>({1, 2, 3, 4, 5}); // NOLINT
+
+    auto pq1 = cppreference::DaryHeap<int>();                                    // NOLINT
+    auto pq2 = cppreference::DaryHeap<int>(vec1.begin(), vec1.end());            // NOLINT
+    auto pq3 = cppreference::DaryHeap<int, std::greater<>, 2>(std::greater<>()); // NOLINT
+    EXPECT_TRUE(pq1.empty());
+
+    // top, push, emplace, top
+    static_assert(std::is_same_v<decltype(pq2.top()), const int&>);
+    EXPECT_EQ(pq2.top(), 5);
+    EXPECT_EQ(pq2.size(), 5);
+    pq2.pop();
+    EXPECT_EQ(pq2.top(), 4);
+    EXPECT_EQ(pq2.size(), 4);
+
+    pq2.push(6); // NOLINT
+    EXPECT_EQ(pq2.top(), 6);
+    EXPECT_EQ(pq2.size(), 5);
+
+    pq2.emplace(7); // NOLINT
+    EXPECT_EQ(pq2.top(), 7);
+    EXPECT_EQ(pq2.size(), 6);
+
+    // std::greater なら最小が top
+    for (const auto x : {3, 1, 2})
+    {
+        pq3.push(x);
+    }
+    EXPECT_EQ(pq3.top(), 1);
+
+    auto words = cppreference::DaryHeap<std::string, std::less<>, 8>(); // NOLINT
+    words.emplace(3, 'b');
+    words.emplace("abc");
+    EXPECT_EQ("bbb", words.top());
+}
+
+TEST(
+    dary_heap, Handle
+)
+{
+    // Dijkstra 風: 最小ヒープで値を小さくする
+    auto pq = cppreference::DaryHeap<std::pair<int, char>, std::greater<>>();
+    const auto a = pq.push({10, 'a'}); // NOLINT
+    const auto b = pq.push({20, 'b'}); // NOLINT
+    const auto c = pq.push({30, 'c'}); // NOLINT
+    EXPECT_EQ(a, pq.top_handle());
+
+    pq.decrease_key(c, {5, 'c'}); // NOLINT
+    EXPECT_EQ(c, pq.top_handle());
+    EXPECT_EQ(5, pq[c].first);
+
+    pq.update(c, {40, 'c'}); // NOLINT
+    EXPECT_EQ(a, pq.top_handle());
+
+    pq.erase(a);
+    EXPECT_EQ(b, pq.top_handle());
+    EXPECT_EQ(2, pq.size());
+
+    // 削除したハンドルは再利用される
+    const auto d = pq.push({1, 'd'});
+    EXPECT_EQ(a, d);
+    EXPECT_EQ('d', pq.top().second);
+}
+
+template <std::size_t D>
+void CheckAgainstMultiset()
+{
+    auto gen = std::mt19937{42}; // NOLINT
+    auto value = std::uniform_int_distribution<int>(0, 1'000);
+    auto op = std::uniform_int_distribution<int>(0, 4);
+
+    // 最初の 1'000 要素はまとめてヒープにする
+    auto init = std::vector<int>(1'000); // NOLINT
+    std::ranges::generate(init, [&]() { return value(gen); });
+
+    auto pq = cppreference::DaryHeap<int, std::less<int>, D>(init.begin(), init.end());
+    auto expected = std::multiset<int>(init.begin(), init.end());
+    auto handles = std::vector<std::pair<std::size_t, int>>(); // {ハンドル, 値} (pop された要素は除く)
+    for (std::size_t i = 0; i < init.size(); ++i)
+    {
+        handles.emplace_back(i, init[i]);
+    }
+
+    const auto forget = [&](std::size_t h) {
+        std::erase_if(handles, [&](const auto& e) { return e.first == h; });
+    };
+
+    for (int i = 0; i < 20'000; ++i) // NOLINT
+    {
+        const auto kind = op(gen);
+        if (kind <= 1 || handles.empty())
+        {
+            const auto x = value(gen);
+            handles.emplace_back(pq.push(x), x);
+            expected.insert(x);
+        }
+        else if (kind == 2)
+        {
+            const auto top = pq.top_handle();
+            EXPECT_EQ(*expected.rbegin(), pq.top());
+            expected.erase(std::prev(expected.end()));
+            pq.pop();
+            forget(top);
+        }
+        else
+        {
+            auto& [h, old] = handles[std::uniform_int_distribution<std::size_t>(0, handles.size() - 1)(gen)];
+            EXPECT_EQ(old, pq[h]);
+            expected.erase(expected.find(old));
+            if (kind == 3)
+            {
+                // less の最大ヒープで top に近づける = 値を大きくする
+                const auto x = std::uniform_int_distribution<int>(old, 1'000)(gen);
+                pq.decrease_key(h, x);
+                old = x;
+                expected.insert(x);
+            }
+            else
+            {
+                pq.erase(h);
+                forget(h);
+            }
+        }
+        ASSERT_EQ(expected.size(), pq.size());
+    }
+
+    while (!pq.empty())
+    {
+        EXPECT_EQ(*expected.rbegin(), pq.top());
+        expected.erase(std::prev(expected.end()));
+        pq.pop();
+    }
+}
+
+TEST(
+    dary_heap, AgainstMultiset
+)
+{
+    CheckAgainstMultiset<2>();
+    CheckAgainstMultiset<4>();
+    CheckAgainstMultiset<8>(); // NOLINT
+}
+
+} // namespace
@@ -0,0 +1,121 @@
+#include "deterministic_reduce.hpp"
+#include "simd_search.hpp"
+#include "thread_pool.hpp"
+#include "gtest/gtest.h"
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using cppreference::Summation;
+
+TEST(
+    deterministic_reduce, Numeric_reduce
+)
+{
+    using std::begin, std::end;
+
+    auto v = std::vector<double>(10); // NOLINT
+    std::iota(begin(v), end(v), 1.0);
+
+    auto pool = cppreference::ThreadPool(4); // NOLINT
+    auto par = cppreference::execution::par.on(pool);
+
+    EXPECT_EQ(55.0, cppreference::deterministic_reduce(begin(v), end(v)));         // NOLINT
+    EXPECT_EQ(155.0, cppreference::deterministic_reduce(begin(v), end(v), 100.0)); // NOLINT
+    EXPECT_EQ(55.0, cppreference::deterministic_reduce(par, begin(v), end(v)));    // NOLINT
+    EXPECT_EQ(0.0, cppreference::deterministic_reduce(par, begin(v), begin(v)));   // NOLINT
+    EXPECT_EQ(1.0, cppreference::deterministic_reduce(begin(v), begin(v), 1.0));   // NOLINT
+
+    const auto f = std::array<float, 4>{0.5F, 0.25F, 0.125F, 0.125F}; // NOLINT
+    EXPECT_EQ(1.0F, cppreference::deterministic_reduce(begin(f), end(f), 0.0F, Summation::Neumaier));
+}
+
+// スレッド数・grain・命令セットを変えてもビット単位で一致する
+template <typename T>
+void CheckReproducible(
+    Summation mode
+)
+{
+    auto gen = std::mt19937{42};                              // NOLINT
+    auto dist = std::uniform_real_distribution<T>(-1e3, 1e3); // NOLINT
+    auto v = std::vector<T>(1'234'567);                       // NOLINT
+    std::ranges::generate(v, [&]() { return dist(gen); });
+
+    using std::begin, std::end;
+
+    const auto expected = std::bit_cast<std::uint64_t>(
+        static_cast<double>(cppreference::deterministic_reduce(begin(v), end(v), T{0}, mode))
+    );
+    for (const std::size_t threads : {1, 2, 3, 4})
+    {
+        auto pool = cppreference::ThreadPool(threads);
+        for (const std::size_t grain : {0, 1, 10'000, 100'000}) // NOLINT
+        {
+            const auto par = cppreference::execution::par.on(pool).with_grain(grain);
+            const auto actual = cppreference::deterministic_reduce(par, begin(v), end(v), T{0}, mode);
+            EXPECT_EQ(expected, std::bit_cast<std::uint64_t>(static_cast<double>(actual)));
+        }
+    }
+    for (const auto isa : {cppreference::simd::Isa::Scalar, cppreference::simd::Isa::Avx2})
+    {
+        cppreference::simd::SetIsa(isa);
+        const auto actual = cppreference::deterministic_reduce(begin(v), end(v), T{0}, mode);
+        EXPECT_EQ(expected, std::bit_cast<std::uint64_t>(static_cast<double>(actual)));
+    }
+    cppreference::simd::SetIsa(cppreference::simd::Isa::Avx2);
+}
+
+TEST(
+    deterministic_reduce, Reproducible
+)
+{
+    CheckReproducible<double>(Summation::Pairwise);
+    CheckReproducible<double>(Summation::Neumaier);
+    CheckReproducible<float>(Summation::Pairwise);
+    CheckReproducible<float>(Summation::Neumaier);
+}
+
+TEST(
+    deterministic_reduce, Accuracy
+)
+{
+    using std::begin, std::end;
+
+    // 打ち消し合う大きな値に埋もれる 1.0 を拾えるのは補正ありだけ (周期 5 で全レーンに混ざる)
+    auto v = std::vector<double>();
+    for (int i = 0; i < 10'000; ++i) // NOLINT
+    {
+        v.insert(end(v), {1.0, 1e100, 1.0, -1e100, 1.0}); // NOLINT
+    }
+    EXPECT_EQ(30'000.0, cppreference::deterministic_reduce(begin(v), end(v), 0.0, Summation::Neumaier));
+    EXPECT_NE(30'000.0, cppreference::deterministic_reduce(begin(v), end(v), 0.0, Summation::Pairwise));
+
+    // 0.1 の 10M 回の和: 逐次の累積より誤差が小さい
+    const auto tenth = std::vector<double>(10'000'000, 0.1); // NOLINT
+    const auto exact = 1'000'000.0;                          // NOLINT
+    const auto naive = std::accumulate(begin(tenth), end(tenth), 0.0);
+    const auto pairwise = cppreference::deterministic_reduce(begin(tenth), end(tenth));
+    const auto neumaier = cppreference::deterministic_reduce(begin(tenth), end(tenth), 0.0, Summation::Neumaier);
+    EXPECT_LT(std::abs(pairwise - exact), std::abs(naive - exact));
+    EXPECT_LE(std::abs(neumaier - exact), std::abs(pairwise - exact));
+    EXPECT_NEAR(exact, neumaier, 1e-9); // NOLINT
+
+    // inf と NaN はそのまま伝播する
+    v[3] = std::numeric_limits<double>::infinity();
+    EXPECT_EQ(
+        std::numeric_limits<double>::infinity(),
+        cppreference::deterministic_reduce(begin(v) + 2, begin(v) + 5, 0.0, Summation::Neumaier) // NOLINT
+    );
+    v[3] = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_TRUE(std::isnan(cppreference::deterministic_reduce(begin(v), end(v), 0.0, Summation::Neumaier)));
+}
+
+} // namespace
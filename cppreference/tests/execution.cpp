@@ -0,0 +1,274 @@
+#include "execution.hpp"
+#include "thread_pool.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <list>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+void dbl(
+    auto& v
+)
+{
+    v = v * 2; // NOLINT
+}
+
+TEST(
+    execution, ThreadPool
+)
+{
+    auto pool = cppreference::ThreadPool(4); // NOLINT
+    EXPECT_EQ(4, pool.size());
+
+    // 全インデックスがちょうど 1 回ずつ処理される
+    auto hits = std::vector<std::atomic<int>>(10'000); // NOLINT
+    pool.ParallelFor(0, hits.size(), 7, [&](std::size_t b, std::size_t e) {
+        for (auto i = b; i < e; ++i)
+        {
+            hits[i].fetch_add(1);
+        }
+    });
+    EXPECT_TRUE(std::ranges::all_of(hits, [](const auto& h) { return h.load() == 1; }));
+
+    // ワーカー内から入れ子で ParallelFor しても詰まらない
+    auto sum = std::atomic<std::size_t>(0);
+    pool.ParallelFor(0, 16, 1, [&](std::size_t, std::size_t) {                   // NOLINT
+        pool.ParallelFor(0, 100, 10, [&](std::size_t b, std::size_t e) { sum += e - b; }); // NOLINT
+    });
+    EXPECT_EQ(1600, sum.load());
+
+    // 例外は呼び出し元に伝播する
+    EXPECT_THROW(
+        pool.ParallelFor(
+            0,
+            100, // NOLINT
+            1,
+            [](std::size_t b, std::size_t) {
+                if (b == 42) // NOLINT
+                {
+                    throw std::runtime_error("42");
+                }
+            }
+        ),
+        std::runtime_error
+    );
+}
+
+TEST(
+    execution, batch_foreach
+)
+{
+    constexpr std::array<int, 6> expected = {2, 4, 6, 8, 10, 12}; // NOLINT
+
+    std::array<int, 6> arr = {1, 2, 3, 4, 5, 6};                  // NOLINT
+    std::vector<int>   vec = {1, 2, 3, 4, 5, 6};                  // NOLINT
+    std::deque<int>    deq = {1, 2, 3, 4, 5, 6};                  // NOLINT
+    std::list<int>     lst = {1, 2, 3, 4, 5, 6};                  // NOLINT
+
+    std::vector<int>                        rng = {1, 2, 3, 4, 5, 6}; // NOLINT
+    std::ranges::ref_view<std::vector<int>> view = rng | std::views::all;
+
+    using std::begin, std::end;
+
+    // grain = 1 で 1 要素ずつタスクに分ける
+    auto pool = cppreference::ThreadPool(4); // NOLINT
+    auto par = cppreference::execution::par.on(pool).with_grain(1);
+
+    cppreference::for_each(par, begin(arr), end(arr), [](auto& v) { v *= 2; }); // NOLINT
+    cppreference::for_each(par, begin(vec), end(vec), dbl<int>);                // NOLINT
+    cppreference::for_each(par, begin(deq), end(deq), dbl<int>);                // NOLINT
+    cppreference::for_each(par, begin(lst), end(lst), dbl<int>);                // NOLINT
+    cppreference::for_each(par, begin(view), end(view), dbl<int>);              // NOLINT
+
+    EXPECT_TRUE(std::ranges::equal(arr, expected));                             // NOLINT
+    EXPECT_TRUE(std::ranges::equal(vec, expected));                             // NOLINT
+    EXPECT_TRUE(std::ranges::equal(deq, expected));                             // NOLINT
+    EXPECT_TRUE(std::ranges::equal(lst, expected));                             // NOLINT
+    EXPECT_TRUE(std::ranges::equal(view, expected));                            // NOLINT
+
+    // 既定のプールでも同じ
+    auto big = std::deque<int>(100'000, 1);                                     // NOLINT
+    cppreference::for_each(cppreference::execution::par, begin(big), end(big), dbl<int>);
+    EXPECT_TRUE(std::ranges::all_of(big, [](const int& v) { return v == 2; }));
+}
+
+TEST(
+    execution, batch_foreachN
+)
+{
+    constexpr std::array<int, 6> expected = {2, 4, 6, 8, 5, 6}; // NOLINT
+
+    std::vector<int> vec = {1, 2, 3, 4, 5, 6};                  // NOLINT
+    std::deque<int>  deq = {1, 2, 3, 4, 5, 6};                  // NOLINT
+    std::list<int>   lst = {1, 2, 3, 4, 5, 6};                  // NOLINT
+
+    using std::begin, std::end;
+
+    auto pool = cppreference::ThreadPool(4); // NOLINT
+    auto par = cppreference::execution::par.on(pool).with_grain(1);
+
+    EXPECT_EQ(begin(vec) + 4, cppreference::for_each_n(par, begin(vec), 4, dbl<int>)); // NOLINT
+    EXPECT_EQ(begin(deq) + 4, cppreference::for_each_n(par, begin(deq), 4, dbl<int>)); // NOLINT
+    cppreference::for_each_n(par, begin(lst), 4, dbl<int>);                            // NOLINT
+
+    EXPECT_TRUE(std::ranges::equal(vec, expected));                                    // NOLINT
+    EXPECT_TRUE(std::ranges::equal(deq, expected));                                    // NOLINT
+    EXPECT_TRUE(std::ranges::equal(lst, expected));                                    // NOLINT
+}
+
+TEST(
+    execution, Transformation_transform
+)
+{
+    constexpr std::array<int, 6> arr1 = {1, 2, 3, 4, 5, 6};       // NOLINT
+    constexpr std::array<int, 6> arr2 = {-1, -2, -3, -4, -5, -6}; // NOLINT
+
+    auto vec = std::vector<int>(6);                               // NOLINT
+
+    using std::begin, std::end;
+
+    auto pool = cppreference::ThreadPool(4); // NOLINT
+    auto par = cppreference::execution::par.on(pool).with_grain(1);
+
+    auto it1 = cppreference::transform(par, begin(arr1), end(arr1), begin(vec), [](const auto& v) { return v * 2; });
+    EXPECT_EQ(end(vec), it1);
+    EXPECT_TRUE(std::ranges::equal(std::initializer_list{2, 4, 6, 8, 10, 12}, vec)); // NOLINT
+
+    auto it2 = cppreference::transform(
+        par,
+        begin(arr1),
+        end(arr1),
+        begin(arr2),
+        begin(vec),
+        [](const auto& v1, const auto& v2) { return v1 * v2; }
+    );
+    EXPECT_EQ(end(vec), it2);
+    EXPECT_TRUE(std::ranges::equal(std::initializer_list{-1, -4, -9, -16, -25, -36}, vec)); // NOLINT
+}
+
+TEST(
+    execution, Numeric_reduce
+)
+{
+    using std::begin, std::end;
+
+    auto v = std::vector<int>(10);                                                      // NOLINT
+    std::iota(begin(v), end(v), 1);
+    auto l = std::list<int>(begin(v), end(v));
+
+    auto pool = cppreference::ThreadPool(4); // NOLINT
+    auto par = cppreference::execution::par.on(pool).with_grain(3);
+
+    EXPECT_EQ(55, cppreference::reduce(par, begin(v), end(v)));                         // NOLINT
+    EXPECT_EQ(155, cppreference::reduce(par, begin(v), end(v), 100));                   // NOLINT
+    EXPECT_EQ(3'628'800, cppreference::reduce(par, begin(v), end(v), 1, std::multiplies{})); // NOLINT
+    EXPECT_EQ(55, cppreference::reduce(par, begin(l), end(l)));                         // NOLINT
+    EXPECT_EQ(0, cppreference::reduce(par, begin(v), begin(v)));                        // NOLINT
+
+    // 既定の grain でも分割される大きさ
+    auto big = std::vector<long>(1'000'000, 1);                                         // NOLINT
+    EXPECT_EQ(1'000'000, cppreference::reduce(cppreference::execution::par, begin(big), end(big)));
+}
+
+TEST(
+    execution, Numeric_scan
+)
+{
+    using std::begin, std::end;
+
+    const auto v1 = std::vector<int>{1, 2, 5, 3, 100}; // NOLINT
+    auto       vy = std::vector<int>(5);                // NOLINT
+    auto       vz = std::vector<int>(5);                // NOLINT
+
+    auto pool = cppreference::ThreadPool(4); // NOLINT
+    auto par = cppreference::execution::par.on(pool).with_grain(2);
+
+    auto it1 = cppreference::exclusive_scan(par, begin(v1), end(v1), begin(vy), -100);      // NOLINT
+    EXPECT_EQ(end(vy), it1);
+    EXPECT_TRUE(std::ranges::equal(vy, std::initializer_list<int>{-100, -99, -97, -92, -89})); // NOLINT
+
+    auto it2 = cppreference::inclusive_scan(par, begin(v1), end(v1), begin(vz));             // NOLINT
+    EXPECT_EQ(end(vz), it2);
+    EXPECT_TRUE(std::ranges::equal(vz, std::initializer_list<int>{1, 3, 8, 11, 111}));         // NOLINT
+
+    cppreference::inclusive_scan(par, begin(v1), end(v1), begin(vz), std::plus{}, 10);       // NOLINT
+    EXPECT_TRUE(std::ranges::equal(vz, std::initializer_list<int>{11, 13, 18, 21, 121}));      // NOLINT
+
+    // 可換でない op (文字列の連結) でも順序を保つ
+    const auto strs = std::vector<std::string>{"a", "b", "c", "d", "e", "f", "g"};
+    auto       cat = std::vector<std::string>(strs.size());
+    cppreference::inclusive_scan(par, begin(strs), end(strs), begin(cat), std::plus{});
+    EXPECT_EQ("abcdefg", cat.back());
+    cppreference::exclusive_scan(par, begin(strs), end(strs), begin(cat), std::string(">"), std::plus{});
+    EXPECT_EQ(">abcdef", cat.back());
+
+    // 逐次版との突き合わせ (in-place と list)
+    auto big = std::vector<long>(100'000);                                                    // NOLINT
+    std::iota(begin(big), end(big), -50'000);                                                 // NOLINT
+    auto expected = std::vector<long>(big.size());
+    std::inclusive_scan(begin(big), end(big), begin(expected));
+    cppreference::inclusive_scan(cppreference::execution::par.on(pool), begin(big), end(big), begin(big));
+    EXPECT_EQ(expected, big);
+
+    auto lst = std::list<int>(begin(v1), end(v1));
+    auto lz = std::list<int>(5);                                                              // NOLINT
+    cppreference::exclusive_scan(par, begin(lst), end(lst), begin(lz), -100);                 // NOLINT
+    EXPECT_TRUE(std::ranges::equal(lz, std::initializer_list<int>{-100, -99, -97, -92, -89})); // NOLINT
+}
+
+TEST(
+    execution, Numeric_transformScan
+)
+{
+    using std::begin, std::end;
+
+    const auto v1 = std::vector<int>{1, 2, 5, 3, 100}; // NOLINT
+    auto       vi = std::vector<int>(5);                // NOLINT
+    auto       ve = std::vector<int>(5);                // NOLINT
+
+    auto pool = cppreference::ThreadPool(4); // NOLINT
+    auto par = cppreference::execution::par.on(pool).with_grain(2);
+
+    cppreference::transform_exclusive_scan(
+        par,
+        begin(v1),
+        end(v1),
+        begin(vi),
+        -100, // NOLINT
+        std::plus{},
+        [](const auto& x) { return x * 2; }
+    );
+    EXPECT_TRUE(std::ranges::equal(vi, std::initializer_list<int>{-100, -98, -94, -84, -78})); // NOLINT
+
+    cppreference::transform_inclusive_scan(
+        par,
+        begin(v1),
+        end(v1),
+        begin(ve),
+        std::plus{},
+        [](const auto& x) { return x * 2; }
+    );
+    EXPECT_TRUE(std::ranges::equal(ve, std::initializer_list<int>{2, 6, 16, 22, 222})); // NOLINT
+
+    cppreference::transform_inclusive_scan(
+        par,
+        begin(v1),
+        end(v1),
+        begin(ve),
+        std::plus{},
+        [](const auto& x) { return x * 2; },
+        -100 // NOLINT
+    );
+    EXPECT_TRUE(std::ranges::equal(ve, std::initializer_list<int>{-98, -94, -84, -78, 122})); // NOLINT
+}
+
+} // namespace
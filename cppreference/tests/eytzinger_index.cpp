@@ -0,0 +1,75 @@
+#include "eytzinger_index.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+TEST(
+    eytzinger_index, BinarySearch_Bound
+)
+{
+    const std::vector<int> vec1 = {1, 2, 3, 4, 4, 5, 6, 7, 8, 9}; // NOLINT
+
+    const auto index = cppreference::EytzingerIndex(vec1);
+    EXPECT_EQ(vec1.size(), index.size());
+
+    EXPECT_EQ(3, index.lower_bound(4));                                           // NOLINT
+    EXPECT_EQ(5, index.upper_bound(4));                                           // NOLINT
+    EXPECT_EQ((std::pair<std::size_t, std::size_t>{3, 5}), index.equal_range(4)); // NOLINT
+    EXPECT_EQ(0, index.lower_bound(0));                                           // NOLINT
+    EXPECT_EQ(10, index.lower_bound(10));                                         // NOLINT
+
+    EXPECT_TRUE(index.contains(4));   // NOLINT
+    EXPECT_FALSE(index.contains(10)); // NOLINT
+
+    // 空の列
+    const auto empty = cppreference::EytzingerIndex<int>(std::vector<int>{});
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(0, empty.lower_bound(1));
+    EXPECT_FALSE(empty.contains(1));
+
+    // 比較関数と要素の型は問わない
+    const auto words = std::list<std::string>{"pear", "kiwi", "fig", "apple"};
+    const auto by_name = cppreference::EytzingerIndex(words, std::greater{});
+    EXPECT_EQ(1, by_name.lower_bound("kiwi"));
+    EXPECT_EQ(2, by_name.upper_bound("kiwi"));
+    EXPECT_EQ(4, by_name.lower_bound("aaa"));
+}
+
+TEST(
+    eytzinger_index, AgainstStd
+)
+{
+    auto gen = std::mt19937{42}; // NOLINT
+
+    // 完全 2 分木にならない大きさを全て試す
+    for (int n = 0; n < 300; ++n) // NOLINT
+    {
+        for (const int bound : {3, 1'000}) // 重複だらけ〜ほぼ一意
+        {
+            auto dist = std::uniform_int_distribution<int>(0, bound - 1);
+            auto v = std::vector<int>(n);
+            std::ranges::generate(v, [&]() { return dist(gen); });
+            std::ranges::sort(v);
+
+            const auto index = cppreference::EytzingerIndex(v);
+            for (int key = -1; key <= bound; ++key)
+            {
+                EXPECT_EQ(std::ranges::lower_bound(v, key) - v.begin(), index.lower_bound(key));
+                EXPECT_EQ(std::ranges::upper_bound(v, key) - v.begin(), index.upper_bound(key));
+                EXPECT_EQ(std::ranges::binary_search(v, key), index.contains(key));
+            }
+        }
+    }
+}
+
+} // namespace
@@ -0,0 +1,214 @@
+#include "flat_hash.hpp"
+#include "hash_diagnostics.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+TEST(
+    flat_hash, Basics
+)
+{
+    const auto vec1 = std::vector<int>({1, 2, 3, 4, 5});                                                // NOLINT
+    const auto vec2 = std::vector<std::pair<std::string, int>>({{"one", 1}, {"two", 2}, {"three", 3}}); // NOLINT
+
+    // FlatHashSet
+    // iterator の中身は const Key&
+    auto us1 = cppreference::FlatHashSet<int>({1, 2, 3, 4, 5});          // NOLINT
+    auto us2 = cppreference::FlatHashSet<int>(vec1.begin(), vec1.end()); // NOLINT
+    static_assert(std::is_same_v<decltype(us1.begin()), cppreference::FlatHashSet<int>::iterator>);
+    static_assert(std::is_same_v<decltype(*us1.begin()), const int&>);
+    EXPECT_EQ(us1, us2);
+
+    // FlatHashMap
+    // iterator の中身は std::pair<const Key, T>&
+    auto um1 = cppreference::FlatHashMap<std::string, int>({{"one", 1}, {"two", 2}, {"three", 3}}); // NOLINT
+    auto um2 = cppreference::FlatHashMap<std::string, int>(vec2.begin(), vec2.end());               // NOLINT
+    static_assert(std::is_same_v<decltype(um1.begin()), cppreference::FlatHashMap<std::string, int>::iterator>);
+    static_assert(std::is_same_v<decltype(*um1.begin()), std::pair<const std::string, int>&>);
+    EXPECT_EQ(um1, um2);
+    EXPECT_FALSE(cppreference::AnalyzeHash(um1).pathological()) << cppreference::AnalyzeHash(um1);
+
+    // 重複したキーは最初のものだけ
+    auto us0 = cppreference::FlatHashSet<int>({1, 2, 3, 4, 5, 1});                              // NOLINT
+    auto um0 = cppreference::FlatHashMap<std::string, int>({{"one", 1}, {"two", 2}, {"one", 4}}); // NOLINT
+    EXPECT_EQ(5, us0.size());
+    EXPECT_EQ(2, um0.size());
+    EXPECT_EQ(1, um0.at("one"));
+
+    // operator[], try_emplace, insert_or_assign
+    um0["three"] = 3;                                       // NOLINT
+    EXPECT_FALSE(um0.try_emplace("three", 30).second);      // NOLINT
+    EXPECT_FALSE(um0.insert_or_assign("three", 33).second); // NOLINT
+    EXPECT_EQ(33, um0["three"]);
+    EXPECT_THROW(um0.at("four"), std::out_of_range);
+
+    // 連続した小さな整数でも探索を始めるスロットが散らばる (16 スロットの 2 つだけに偏らない)
+    auto us3 = cppreference::FlatHashSet<int>({1, 2, 3, 4, 5}); // NOLINT
+    ASSERT_EQ(16, us3.bucket_count());
+    auto starts = std::vector<std::size_t>();
+    for (const auto v : us3)
+    {
+        starts.push_back(us3.bucket(v));
+    }
+    std::ranges::sort(starts);
+    EXPECT_GT(std::ranges::distance(starts.begin(), std::ranges::unique(starts).begin()), 2);
+}
+
+// 構築時に例外を投げる値
+struct Boom
+{
+    explicit Boom(
+        int value
+    )
+    {
+        if (value == 0)
+        {
+            throw std::runtime_error("boom");
+        }
+    }
+};
+
+template <typename T>
+void EqUS(
+    const cppreference::FlatHashSet<T>& us, // NOLINT
+    const std::initializer_list<T>&     values
+)
+{
+    EXPECT_EQ(values.size(), us.size());
+    for (const auto& v : values) // NOLINT
+    {
+        EXPECT_NE(us.find(v), us.end());
+        EXPECT_TRUE(us.contains(v));
+    }
+    EXPECT_FALSE(cppreference::AnalyzeHash(us).pathological()) << cppreference::AnalyzeHash(us);
+}
+
+TEST(
+    flat_hash, Modifiers
+)
+{
+    // insert
+    auto vec1 = std::vector<int>({6, 7});                        // NOLINT
+    auto us1 = cppreference::FlatHashSet<int>({1, 2, 3, 4, 5}); // NOLINT
+    us1.insert(0);
+    EqUS(us1, {0, 1, 2, 3, 4, 5});                               // NOLINT
+    us1.insert({-1, -2});
+    EqUS(us1, {-2, -1, 0, 1, 2, 3, 4, 5});                       // NOLINT
+    us1.insert(vec1.begin(), vec1.end());
+    EqUS(us1, {-2, -1, 0, 1, 2, 3, 4, 5, 6, 7});                 // NOLINT
+
+    // emplace
+    auto us2 = cppreference::FlatHashSet<int>({1, 2, 3, 4, 5}); // NOLINT
+    us2.emplace(0);
+    EqUS(us2, {0, 1, 2, 3, 4, 5});                               // NOLINT
+
+    // erase
+    auto us3 = cppreference::FlatHashSet<int>({1, 2, 3, 4, 5}); // NOLINT
+    us3.erase(3);
+    EqUS(us3, {1, 2, 4, 5});                                     // NOLINT
+    us3.erase(us3.find(2));
+    EqUS(us3, {1, 4, 5});                                        // NOLINT
+
+    // extract & insert
+    auto us4 = cppreference::FlatHashSet<int>({1, 2, 3, 4, 5}); // NOLINT
+    auto node = us4.extract(3);
+    static_assert(std::is_same_v<decltype(node), cppreference::FlatHashSet<int>::node_type>);
+    EXPECT_EQ(3, node.value());
+    EqUS(us4, {1, 2, 4, 5});                                     // NOLINT
+    us4.insert(std::move(node));
+    EqUS(us4, {1, 2, 3, 4, 5});                                  // NOLINT
+    EXPECT_TRUE(us4.extract(6).empty());                         // NOLINT
+
+    auto um4 = cppreference::FlatHashMap<std::string, int>({{"one", 1}, {"two", 2}}); // NOLINT
+    auto mnode = um4.extract("one");
+    mnode.key() = "uno";
+    EXPECT_TRUE(um4.insert(std::move(mnode)).inserted);
+    EXPECT_EQ(1, um4.at("uno"));
+    EXPECT_FALSE(um4.contains("one"));
+
+    // merge (同じキーがあれば移さない)
+    auto us5 = cppreference::FlatHashSet<int>({1, 2, 3, 4, 5}); // NOLINT
+    auto us5x = cppreference::FlatHashSet<int>({5, 6, 7});      // NOLINT
+    us5.merge(us5x);
+    EqUS(us5, {1, 2, 3, 4, 5, 6, 7});                            // NOLINT
+    EqUS(us5x, {5});                                             // NOLINT
+
+    // 値の構築が例外を投げたら何も入らない
+    auto um6 = cppreference::FlatHashMap<int, Boom>();
+    EXPECT_THROW(um6.try_emplace(1, 0), std::runtime_error);
+    EXPECT_EQ(0, um6.size());
+    EXPECT_FALSE(um6.contains(1));
+    EXPECT_EQ(um6.begin(), um6.end());
+    EXPECT_TRUE(um6.try_emplace(1, 1).second);
+    EXPECT_THROW(um6.try_emplace(2, 0), std::runtime_error);
+    EXPECT_EQ(1, um6.size());
+    EXPECT_EQ(std::next(um6.begin()), um6.end());
+}
+
+TEST(
+    flat_hash, AgainstStd
+)
+{
+    auto gen = std::mt19937{42}; // NOLINT
+    auto key = std::uniform_int_distribution<int>(0, 5'000);
+    auto op = std::uniform_int_distribution<int>(0, 3);
+
+    // 削除済みの目印が溜まっても rehash で片付くこと
+    auto actual = cppreference::FlatHashMap<int, int>();
+    auto expected = std::unordered_map<int, int>();
+    for (int i = 0; i < 200'000; ++i) // NOLINT
+    {
+        const auto k = key(gen);
+        switch (op(gen))
+        {
+        case 0:
+            EXPECT_EQ(expected.insert({k, i}).second, actual.insert({k, i}).second);
+            break;
+        case 1:
+            expected[k] += i;
+            actual[k] += i;
+            break;
+        case 2:
+            EXPECT_EQ(expected.erase(k), actual.erase(k));
+            break;
+        default:
+            EXPECT_EQ(expected.contains(k), actual.contains(k));
+            break;
+        }
+        ASSERT_EQ(expected.size(), actual.size());
+    }
+    EXPECT_LE(actual.load_factor(), actual.max_load_factor());
+    const auto stats = cppreference::AnalyzeHash(actual);
+    EXPECT_FALSE(stats.pathological()) << stats;
+
+    auto count = std::size_t{0};
+    for (const auto& [k, v] : actual)
+    {
+        EXPECT_EQ(expected.at(k), v);
+        ++count;
+    }
+    EXPECT_EQ(expected.size(), count);
+
+    // コピー・ムーブ
+    auto copy = actual;
+    EXPECT_EQ(actual, copy);
+    auto moved = std::move(copy);
+    EXPECT_EQ(actual, moved);
+    actual.clear();
+    EXPECT_TRUE(actual.empty());
+    EXPECT_EQ(actual.end(), actual.find(0));
+}
+
+} // namespace
@@ -0,0 +1,129 @@
+#include "flat_hash.hpp"
+#include "hash_diagnostics.hpp"
+#include "gtest/gtest.h"
+#include <cstddef>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace
+{
+
+// occupancy[k] * k の合計 (要素数になる)
+auto Occupied(
+    const cppreference::HashStats& stats
+) -> std::size_t
+{
+    std::size_t n = 0;
+    for (std::size_t k = 0; k < stats.occupancy.size(); ++k)
+    {
+        n += k * stats.occupancy[k];
+    }
+    return n;
+}
+
+// unordered_associative_containers.cpp の std::hash<Scp> と同じく常に 0 を返す
+struct ZeroHash
+{
+    auto operator()(int /* key */) const -> std::size_t { return 0; }
+};
+
+// 値は全て違うがバケツ数の倍数しか返さない
+struct StridedHash
+{
+    auto operator()(int key) const -> std::size_t { return static_cast<std::size_t>(key) * 1'031; } // NOLINT
+};
+
+TEST(
+    hash_diagnostics, Unordered
+)
+{
+    auto good = std::unordered_set<int>();
+    auto watcher = cppreference::RehashWatcher(good);
+    for (int i = 0; i < 1'000; ++i) // NOLINT
+    {
+        good.insert(i);
+        watcher.Observe();
+    }
+    const auto stats = watcher.Analyze();
+    EXPECT_EQ(1'000, stats.size);
+    EXPECT_EQ(good.bucket_count(), stats.bucket_count);
+    EXPECT_EQ(good.load_factor(), stats.load_factor);
+    EXPECT_EQ(1'000, stats.distinct_hashes);
+    EXPECT_EQ(stats.size, std::accumulate(stats.histogram.begin(), stats.histogram.end(), std::size_t{0}));
+    EXPECT_EQ(stats.bucket_count, std::accumulate(stats.occupancy.begin(), stats.occupancy.end(), std::size_t{0}));
+    EXPECT_EQ(stats.bucket_count - stats.used_buckets, stats.occupancy[0]);
+    EXPECT_EQ(stats.size, Occupied(stats));
+    EXPECT_GT(stats.rehash_count, 0);
+    EXPECT_FALSE(stats.pathological()) << stats;
+
+    // 定数ハッシュは 1 本のチェインになる
+    auto zero = std::unordered_map<int, std::string, ZeroHash>();
+    for (int i = 0; i < 100; ++i) // NOLINT
+    {
+        zero.emplace(i, "");
+    }
+    const auto zstats = cppreference::AnalyzeHash(zero);
+    EXPECT_EQ(1, zstats.distinct_hashes);
+    EXPECT_EQ(1, zstats.used_buckets);
+    EXPECT_EQ(100, zstats.max_probe);
+    ASSERT_EQ(101, zstats.occupancy.size());
+    EXPECT_EQ(1, zstats.occupancy[100]);
+    EXPECT_EQ(zero.bucket_count() - 1, zstats.occupancy[0]);
+    EXPECT_TRUE(zstats.pathological());
+
+    // 値は違ってもバケツ数 (素数) の倍数ばかりなら同じバケツに落ちる
+    auto strided = std::unordered_set<int, StridedHash>(1'031); // NOLINT
+    for (int i = 0; i < 500; ++i)                              // NOLINT
+    {
+        strided.insert(i);
+    }
+    ASSERT_EQ(1'031, strided.bucket_count());
+    const auto sstats = cppreference::AnalyzeHash(strided);
+    EXPECT_EQ(500, sstats.distinct_hashes);
+    EXPECT_TRUE(sstats.pathological());
+
+    auto text = std::ostringstream();
+    text << sstats;
+    EXPECT_NE(std::string::npos, text.str().find("PATHOLOGICAL"));
+    EXPECT_NE(std::string::npos, text.str().find(" occupancy=[0:"));
+}
+
+TEST(
+    hash_diagnostics, FlatHash
+)
+{
+    auto good = cppreference::FlatHashSet<int>();
+    for (int i = 0; i < 1'000; ++i) // NOLINT
+    {
+        good.insert(i);
+    }
+    const auto stats = cppreference::AnalyzeHash(good);
+    EXPECT_EQ(1'000, stats.size);
+    EXPECT_EQ(good.bucket_count(), stats.bucket_count);
+    EXPECT_EQ(stats.size, std::accumulate(stats.histogram.begin(), stats.histogram.end(), std::size_t{0}));
+    EXPECT_EQ(0, stats.histogram[0]);
+    EXPECT_EQ(stats.bucket_count, std::accumulate(stats.occupancy.begin(), stats.occupancy.end(), std::size_t{0}));
+    EXPECT_EQ(stats.size, Occupied(stats));
+    EXPECT_GE(stats.mean_probe, 1.0);
+    EXPECT_EQ(7, stats.rehash_count); // NOLINT (16 -> 32 -> ... -> 2048)
+    EXPECT_FALSE(stats.pathological()) << stats;
+
+    auto zero = cppreference::FlatHashSet<int, ZeroHash>();
+    for (int i = 0; i < 100; ++i) // NOLINT
+    {
+        zero.insert(i);
+    }
+    // 探索を始めるスロットは bucket() で分かる (定数ハッシュなら全て同じ)
+    EXPECT_EQ(zero.bucket(0), zero.bucket(99)); // NOLINT
+    EXPECT_LT(zero.bucket(0), zero.bucket_count());
+    const auto zstats = cppreference::AnalyzeHash(zero);
+    EXPECT_EQ(1, zstats.distinct_hashes);
+    EXPECT_EQ(1, zstats.used_buckets);
+    EXPECT_EQ(1, zstats.occupancy[100]);
+    EXPECT_TRUE(zstats.pathological());
+}
+
+} // namespace
@@ -0,0 +1,161 @@
+#pragma once
+
+#include "allocation_counter.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <optional>
+#include <source_location>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cppreference
+{
+
+/**
+ * @brief TEST ごとのメモリ確保の回数とバイト数を記録する gtest のリスナ
+ *
+ * 数えるのはテスト本体を実行するスレッドでの確保だけ (ThreadPool などのワーカーでの確保は含まない)。
+ * OnTestStart の後に gtest 自身がテストのオブジェクトを new するので、どのテストも 1 回以上になる。
+ * 終了時に確保の多いテストを SUMMARY_TESTS 個表示する。
+ */
+class AllocationListener : public ::testing::EmptyTestEventListener
+{
+public:
+    static constexpr std::size_t SUMMARY_TESTS = 10;
+
+    /**
+     * @brief リスナを登録する (何度呼んでも 1 つだけ)。RUN_ALL_TESTS より前に呼ぶこと
+     */
+    static auto Install() -> bool
+    {
+        static const bool installed = [] {
+            // listeners は登録したリスナを delete する
+            ::testing::UnitTest::GetInstance()->listeners().Append(new AllocationListener()); // NOLINT
+            return true;
+        }();
+        return installed;
+    }
+
+    /**
+     * @brief 終了したテスト ("suite.name") の記録
+     */
+    [[nodiscard]] static auto Find(
+        const std::string& test
+    ) -> std::optional<AllocationStats>
+    {
+        const auto it = Records().find(test);
+        if (it == Records().end())
+        {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    void OnTestStart(
+        const ::testing::TestInfo& /*info*/
+    ) override
+    {
+        start_ = detail::allocation_stats;
+    }
+
+    void OnTestEnd(
+        const ::testing::TestInfo& info
+    ) override
+    {
+        // 記録のための確保を数えないように、先に差を取る
+        const auto stats = AllocationStats{
+            .count = detail::allocation_stats.count - start_.count,
+            .bytes = detail::allocation_stats.bytes - start_.bytes,
+        };
+        Records()[std::string(info.test_suite_name()) + "." + info.name()] = stats;
+    }
+
+    void OnTestProgramEnd(
+        const ::testing::UnitTest& /*unit_test*/
+    ) override
+    {
+        if (!detail::allocation_hook_installed || Records().empty())
+        {
+            return;
+        }
+        auto sorted = std::vector<std::pair<std::string, AllocationStats>>(Records().begin(), Records().end());
+        const auto n = std::min(sorted.size(), SUMMARY_TESTS);
+        const auto more = [](const auto& a, const auto& b) { return a.second.count > b.second.count; };
+        std::ranges::partial_sort(sorted, sorted.begin() + static_cast<std::ptrdiff_t>(n), more);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const auto& [test, stats] = sorted[i];
+            std::cout << "[ ALLOCS   ] " << stats.count << " allocations, " << stats.bytes << " bytes: " << test
+                      << '\n';
+        }
+    }
+
+private:
+    static auto Records() -> std::map<std::string, AllocationStats>&
+    {
+        static auto records = std::map<std::string, AllocationStats>();
+        return records;
+    }
+
+    AllocationStats start_;
+};
+
+/**
+ * @brief 生存期間中にこのスレッドで起きたメモリ確保が上限を超えたら、破棄するときにテストを失敗させる
+ *
+ * 速さが大事な処理の確保の回数が増えたことをテストで検出するためのもの。
+ * operator new を置き換えていない実行ファイルでは数えられないので、常に失敗させる。
+ */
+class AllocationBudget
+{
+public:
+    static constexpr std::uint64_t UNLIMITED = std::numeric_limits<std::uint64_t>::max();
+
+    explicit AllocationBudget(
+        std::uint64_t        max_count,
+        std::uint64_t        max_bytes = UNLIMITED,
+        std::source_location location = std::source_location::current()
+    )
+        : max_count_(max_count), max_bytes_(max_bytes), location_(location)
+    {
+    }
+
+    AllocationBudget(const AllocationBudget&) = delete;
+    auto operator=(const AllocationBudget&) -> AllocationBudget& = delete;
+    AllocationBudget(AllocationBudget&&) = delete;
+    auto operator=(AllocationBudget&&) -> AllocationBudget& = delete;
+
+    ~AllocationBudget()
+    {
+        if (!detail::allocation_hook_installed)
+        {
+            ADD_FAILURE_AT(location_.file_name(), static_cast<int>(location_.line()))
+                << "operator new is not replaced; link src/allocation_counter.cpp";
+            return;
+        }
+        if (scope_.count() > max_count_ || scope_.bytes() > max_bytes_)
+        {
+            ADD_FAILURE_AT(location_.file_name(), static_cast<int>(location_.line()))
+                << "allocation budget exceeded: " << scope_.count() << " allocations (budget " << max_count_ << "), "
+                << scope_.bytes() << " bytes (budget " << max_bytes_ << ")";
+        }
+    }
+
+    [[nodiscard]] auto count() const -> std::uint64_t { return scope_.count(); }
+
+    [[nodiscard]] auto bytes() const -> std::uint64_t { return scope_.bytes(); }
+
+private:
+    std::uint64_t        max_count_;
+    std::uint64_t        max_bytes_;
+    std::source_location location_;
+    AllocationScope      scope_;
+};
+
+} // namespace cppreference
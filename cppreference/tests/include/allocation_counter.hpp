@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace cppreference
+{
+
+/**
+ * @brief グローバルの operator new を呼んだ回数と確保したバイト数
+ */
+struct AllocationStats
+{
+    std::uint64_t count = 0;
+    std::uint64_t bytes = 0;
+};
+
+namespace detail
+{
+// 置き換え版の operator new が加算する (スレッドごと)
+inline thread_local AllocationStats allocation_stats;
+
+// 置き換え版の operator new は、count がこの値に達していたら std::bad_alloc を投げる (スレッドごと)
+inline thread_local std::uint64_t allocation_limit = std::numeric_limits<std::uint64_t>::max();
+
+// 置き換え版の operator new をリンクした実行ファイルでは true (そうでなければ数は常に 0)
+inline bool allocation_hook_installed = false;
+} // namespace detail
+
+/**
+ * @brief 生存期間中にこのスレッドで起きたメモリ確保を数える
+ *
+ * 数えられるのは operator new を置き換えた実行ファイルだけ (src/allocation_counter.cpp を
+ * bench_main と test_main にリンクしている)
+ */
+class AllocationScope
+{
+public:
+    AllocationScope()
+        : start_(detail::allocation_stats)
+    {
+    }
+
+    [[nodiscard]] auto count() const -> std::uint64_t { return detail::allocation_stats.count - start_.count; }
+
+    [[nodiscard]] auto bytes() const -> std::uint64_t { return detail::allocation_stats.bytes - start_.bytes; }
+
+private:
+    AllocationStats start_;
+};
+
+/**
+ * @brief 生存期間中、このスレッドで n 回確保したあとの確保を std::bad_alloc で失敗させる (例外安全のテスト用)
+ */
+class AllocationLimit
+{
+public:
+    explicit AllocationLimit(
+        std::uint64_t n
+    )
+        : saved_(std::exchange(detail::allocation_limit, detail::allocation_stats.count + n))
+    {
+    }
+
+    AllocationLimit(const AllocationLimit&) = delete;
+    auto operator=(const AllocationLimit&) -> AllocationLimit& = delete;
+    AllocationLimit(AllocationLimit&&) = delete;
+    auto operator=(AllocationLimit&&) -> AllocationLimit& = delete;
+
+    ~AllocationLimit() { detail::allocation_limit = saved_; }
+
+private:
+    std::uint64_t saved_;
+};
+
+} // namespace cppreference
@@ -0,0 +1,208 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <span>
+
+namespace cppreference
+{
+
+/**
+ * @brief リクエスト 1 回分の一時的な確保をまとめて捨てる std::pmr::memory_resource
+ *
+ * チャンクの先頭からポインタを進めて切り出すだけで、deallocate は何もしない。
+ * reset() はポインタを最初のチャンクに戻すだけの O(1) で、チャンクは上流に返さずに次のリクエストで使い回す
+ * (std::pmr::monotonic_buffer_resource::release() はチャンクを全て上流に返すので、次のリクエストで確保し直す)。
+ * reset() の前に、このリソースから確保したオブジェクトを全て破棄しておくこと。
+ * 解放した領域を使い回したいコンテナ (insert と erase を繰り返すもの) は、
+ * std::pmr::unsynchronized_pool_resource の上流にこのリソースを置く。
+ */
+class Arena : public std::pmr::memory_resource
+{
+public:
+    static constexpr std::size_t DEFAULT_CHUNK_SIZE = 64 * 1024; // NOLINT
+
+    /**
+     * @brief 最初のチャンクは chunk_size バイトで、足りなくなるたびに 2 倍の大きさのチャンクを upstream から確保する
+     */
+    explicit Arena(
+        std::size_t                chunk_size = DEFAULT_CHUNK_SIZE,
+        std::pmr::memory_resource* upstream = std::pmr::get_default_resource()
+    )
+        : upstream_(upstream), next_size_(std::max(chunk_size, HEADER_SIZE * 2))
+    {
+    }
+
+    /**
+     * @brief まず buffer から切り出し、足りなくなったら upstream から確保する
+     *
+     * upstream を std::pmr::null_memory_resource() にすると、buffer を使い切ったら std::bad_alloc を投げる
+     */
+    explicit Arena(
+        std::span<std::byte>       buffer,
+        std::pmr::memory_resource* upstream = std::pmr::get_default_resource()
+    )
+        : Arena(std::max(buffer.size(), DEFAULT_CHUNK_SIZE), upstream)
+    {
+        buffer_ = buffer;
+        reset();
+    }
+
+    Arena(const Arena&) = delete;
+    auto operator=(const Arena&) -> Arena& = delete;
+    Arena(Arena&&) = delete;
+    auto operator=(Arena&&) -> Arena& = delete;
+
+    ~Arena() override
+    {
+        while (head_ != nullptr)
+        {
+            auto* next = head_->next;
+            upstream_->deallocate(head_, head_->size, alignof(std::max_align_t));
+            head_ = next;
+        }
+    }
+
+    /**
+     * @brief 切り出した領域を全て捨てる (O(1)、チャンクは手元に残す)
+     */
+    void reset()
+    {
+        used_ = 0;
+        if (!buffer_.empty())
+        {
+            current_ = nullptr;
+            ptr_ = buffer_.data();
+            end_ = buffer_.data() + buffer_.size();
+        }
+        else if (head_ != nullptr)
+        {
+            Enter(head_);
+        }
+        else
+        {
+            current_ = nullptr;
+            ptr_ = nullptr;
+            end_ = nullptr;
+        }
+    }
+
+    /**
+     * @brief 前回の reset() から切り出したバイト数
+     */
+    [[nodiscard]] auto used() const -> std::size_t { return used_; }
+
+    /**
+     * @brief upstream から確保したバイト数 (reset() しても減らない)
+     */
+    [[nodiscard]] auto reserved() const -> std::size_t { return reserved_; }
+
+    [[nodiscard]] auto upstream_resource() const -> std::pmr::memory_resource* { return upstream_; }
+
+protected:
+    auto do_allocate(
+        std::size_t bytes,
+        std::size_t alignment
+    ) -> void* override
+    {
+        bytes = std::max<std::size_t>(bytes, 1);
+        for (;;)
+        {
+            void* p = ptr_;
+            auto  space = static_cast<std::size_t>(end_ - ptr_);
+            if (p != nullptr && std::align(alignment, bytes, p, space) != nullptr)
+            {
+                ptr_ = static_cast<std::byte*>(p) + bytes;
+                used_ += bytes;
+                return p;
+            }
+
+            // 次のチャンクが小さければ、その手前に十分な大きさのチャンクを足す
+            auto* next = current_ == nullptr ? head_ : current_->next;
+            if (next == nullptr || Capacity(next) < bytes + alignment)
+            {
+                next = AddChunk(bytes + alignment, next);
+            }
+            Enter(next);
+        }
+    }
+
+    void do_deallocate(
+        void* /*p*/,
+        std::size_t /*bytes*/,
+        std::size_t /*alignment*/
+    ) override
+    {
+    }
+
+    [[nodiscard]] auto do_is_equal(
+        const std::pmr::memory_resource& other
+    ) const noexcept -> bool override
+    {
+        return this == &other;
+    }
+
+private:
+    struct Chunk
+    {
+        Chunk*      next;
+        std::size_t size; // ヘッダを含むバイト数
+    };
+
+    static constexpr std::size_t HEADER_SIZE =
+        (sizeof(Chunk) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+
+    static auto Data(
+        Chunk* chunk
+    ) -> std::byte*
+    {
+        return reinterpret_cast<std::byte*>(chunk) + HEADER_SIZE; // NOLINT
+    }
+
+    static auto Capacity(
+        const Chunk* chunk
+    ) -> std::size_t
+    {
+        return chunk->size - HEADER_SIZE;
+    }
+
+    void Enter(
+        Chunk* chunk
+    )
+    {
+        current_ = chunk;
+        ptr_ = Data(chunk);
+        end_ = ptr_ + Capacity(chunk);
+    }
+
+    /**
+     * @brief min_bytes 以上切り出せるチャンクを確保して、今のチャンクの次 (next の手前) につなぐ
+     */
+    auto AddChunk(
+        std::size_t min_bytes,
+        Chunk*      next
+    ) -> Chunk*
+    {
+        const auto size = std::max(next_size_, min_bytes + HEADER_SIZE);
+        auto*      chunk = static_cast<Chunk*>(upstream_->allocate(size, alignof(std::max_align_t)));
+        *chunk = Chunk{.next = next, .size = size};
+        (current_ == nullptr ? head_ : current_->next) = chunk;
+        reserved_ += size;
+        next_size_ = size * 2;
+        return chunk;
+    }
+
+    std::pmr::memory_resource* upstream_;
+    std::size_t                next_size_;
+    std::span<std::byte>       buffer_;
+    Chunk*                     head_ = nullptr;
+    Chunk*                     current_ = nullptr; // nullptr なら buffer_ (またはまだチャンクがない)
+    std::byte*                 ptr_ = nullptr;
+    std::byte*                 end_ = nullptr;
+    std::size_t                used_ = 0;
+    std::size_t                reserved_ = 0;
+};
+
+} // namespace cppreference
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <utility>
+
+namespace cppreference
+{
+
+namespace detail
+{
+
+// 同時に進めるクエリの数。1 段ごとにこの数のキャッシュミスを重ねて待つ
+inline constexpr std::size_t BATCH_WIDTH = 16;
+
+/**
+ * @brief 次に読む位置をプリフェッチする (連続したメモリでなければ何もしない)
+ */
+template <std::random_access_iterator It>
+[[gnu::always_inline]] inline void PrefetchAt(
+    It it
+)
+{
+    if constexpr (std::contiguous_iterator<It>)
+    {
+        __builtin_prefetch(std::to_address(it)); // NOLINT
+    }
+}
+
+/**
+ * @brief keys[0, m) (m <= BATCH_WIDTH) の各キーについて go_right(x, key) が false になる最初の位置を同時に求める
+ *
+ * 分岐のない 2 分探索 (base[half] で go_right なら base を half 進めて、長さを len - half にする) は
+ * 長さの列がキーによらないので、全てのクエリを 1 段ずつ揃えて進められる。
+ * 1 つのクエリの次に読む位置をプリフェッチしてから残りのクエリを進めるので、メモリの待ち時間が重なる。
+ */
+template <std::random_access_iterator It, typename Key, typename GoRight, typename Out>
+auto BatchSearchBlock(
+    It          first,
+    It          last,
+    const Key*  keys,
+    std::size_t m,
+    GoRight&    go_right,
+    Out         out
+) -> Out
+{
+    using Diff = std::iter_difference_t<It>;
+
+    auto base = std::array<It, BATCH_WIDTH>();
+    std::fill_n(base.begin(), m, first);
+
+    auto len = last - first;
+    while (len > 1)
+    {
+        const auto half = len / 2;
+        len -= half;
+        const auto next = len / 2;
+        for (std::size_t q = 0; q < m; ++q)
+        {
+            base[q] += static_cast<Diff>(go_right(base[q][half], keys[q])) * half;
+            PrefetchAt(base[q] + next);
+        }
+    }
+    if (len == 1)
+    {
+        for (std::size_t q = 0; q < m; ++q)
+        {
+            base[q] += static_cast<Diff>(go_right(*base[q], keys[q]));
+        }
+    }
+
+    for (std::size_t q = 0; q < m; ++q)
+    {
+        *out = base[q];
+        ++out;
+    }
+    return out;
+}
+
+template <std::random_access_iterator It, typename Keys, typename GoRight, typename Out>
+auto BatchSearch(
+    It          first,
+    It          last,
+    const Keys& keys,
+    GoRight     go_right,
+    Out         out
+) -> Out
+{
+    const auto* k = std::ranges::data(keys);
+    const auto  n = static_cast<std::size_t>(std::ranges::size(keys));
+    for (std::size_t i = 0; i < n; i += BATCH_WIDTH)
+    {
+        out = BatchSearchBlock(first, last, k + i, std::min(BATCH_WIDTH, n - i), go_right, std::move(out));
+    }
+    return out;
+}
+
+} // namespace detail
+
+/**
+ * @brief keys の各キーについて std::lower_bound(first, last, key, comp) をまとめて求め、順に out に書く
+ *
+ * 1 つずつ探索するとキャッシュミスのたびに待つが、BATCH_WIDTH 個のクエリを 1 段ずつ交互に進め、
+ * 次に読む位置をプリフェッチするので、待ち時間を重ねられる。
+ */
+template <
+    std::random_access_iterator   It,
+    std::ranges::contiguous_range Keys,
+    std::weakly_incrementable     Out,
+    typename Comp = std::ranges::less>
+    requires std::indirectly_writable<Out, const It&> &&
+             std::indirect_strict_weak_order<Comp, std::ranges::iterator_t<const Keys>, It>
+auto batch_lower_bound(
+    It          first,
+    It          last,
+    const Keys& keys,
+    Out         out,
+    Comp        comp = {}
+) -> Out
+{
+    const auto go_right = [&](const auto& x, const auto& key) -> bool { return std::invoke(comp, x, key); };
+    return detail::BatchSearch(first, last, keys, go_right, std::move(out));
+}
+
+/**
+ * @brief batch_lower_bound の std::upper_bound 版
+ */
+template <
+    std::random_access_iterator   It,
+    std::ranges::contiguous_range Keys,
+    std::weakly_incrementable     Out,
+    typename Comp = std::ranges::less>
+    requires std::indirectly_writable<Out, const It&> &&
+             std::indirect_strict_weak_order<Comp, std::ranges::iterator_t<const Keys>, It>
+auto batch_upper_bound(
+    It          first,
+    It          last,
+    const Keys& keys,
+    Out         out,
+    Comp        comp = {}
+) -> Out
+{
+    const auto go_right = [&](const auto& x, const auto& key) -> bool { return !std::invoke(comp, key, x); };
+    return detail::BatchSearch(first, last, keys, go_right, std::move(out));
+}
+
+} // namespace cppreference
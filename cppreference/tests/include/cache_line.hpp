@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstddef>
+
+namespace cppreference::detail
+{
+
+/**
+ * @brief キャッシュラインの大きさ (x86-64 / AArch64 の多くで 64 byte)
+ *
+ * std::hardware_destructive_interference_size はコンパイラやフラグで値が変わり得るので、ABI に効く箇所では固定値を使う
+ */
+inline constexpr std::size_t CACHE_LINE = 64;
+
+} // namespace cppreference::detail
@@ -0,0 +1,174 @@
+#pragma once
+
+#include "cache_line.hpp"
+#include "flat_hash.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <thread>
+#include <utility>
+
+namespace cppreference
+{
+
+/**
+ * @brief シャード分割した並行ハッシュ表
+ *
+ * キーのハッシュ値の上位ビットでシャードを選び、シャードごとに読み書きロックと FlatHashMap を持つ。
+ * 別のシャードに落ちるキーへの操作は互いに待たない。シャードはキャッシュラインに揃えて、
+ * 隣のシャードのロックとの偽共有を避ける。
+ * 要素への参照は返さず (ロックを外した後に書き換えられるので)、find は値のコピーを返し、
+ * 更新は upsert に渡した関数をロックの中で呼んで行う。
+ */
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class ConcurrentHashMap
+{
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using size_type = std::size_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+
+    /**
+     * @brief シャード数は shards 以上の 2 の冪 (既定はハードウェアスレッド数の 8 倍)
+     *
+     * ハッシュの上位ビットでシャードを選ぶので、シャードは最低 2 つ (shards が 1 以下でも 2 になる)
+     */
+    explicit ConcurrentHashMap(
+        size_type shards = 8 * std::max(1U, std::thread::hardware_concurrency()) // NOLINT
+    )
+        : shard_count_(std::bit_ceil(std::max<size_type>(shards, 2))),
+          shift_(std::numeric_limits<std::size_t>::digits - std::countr_zero(shard_count_)),
+          shards_(std::make_unique<Shard[]>(shard_count_))
+    {
+    }
+
+    [[nodiscard]] auto shard_count() const -> size_type { return shard_count_; }
+
+    /**
+     * @brief 全シャードの要素数の和 (他のスレッドが書き込んでいれば目安)
+     */
+    [[nodiscard]] auto size() const -> size_type
+    {
+        size_type n = 0;
+        for (size_type s = 0; s < shard_count(); ++s)
+        {
+            const auto lock = std::shared_lock(shards_[s].mutex);
+            n += shards_[s].map.size();
+        }
+        return n;
+    }
+
+    [[nodiscard]] auto empty() const -> bool { return size() == 0; }
+
+    [[nodiscard]] auto find(
+        const Key& key
+    ) const -> std::optional<T>
+    {
+        auto&      shard = ShardOf(key);
+        const auto lock = std::shared_lock(shard.mutex);
+        const auto it = shard.map.find(key);
+        if (it == shard.map.end())
+        {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    [[nodiscard]] auto contains(
+        const Key& key
+    ) const -> bool
+    {
+        auto&      shard = ShardOf(key);
+        const auto lock = std::shared_lock(shard.mutex);
+        return shard.map.contains(key);
+    }
+
+    /**
+     * @brief key の値を value にする。新しく入れたら true
+     */
+    template <typename M>
+    auto insert_or_assign(
+        const Key& key,
+        M&&        value
+    ) -> bool
+    {
+        auto&      shard = ShardOf(key);
+        const auto lock = std::scoped_lock(shard.mutex);
+        return shard.map.insert_or_assign(key, std::forward<M>(value)).second;
+    }
+
+    /**
+     * @brief key の値 (なければ T() を入れて) に fn(T&) をロックの中で適用する。新しく入れたら true
+     *
+     * fn の中でこの表を操作してはいけない (同じシャードならデッドロックする)
+     */
+    template <typename Fn>
+    auto upsert(
+        const Key& key,
+        Fn&&       fn
+    ) -> bool
+    {
+        auto&      shard = ShardOf(key);
+        const auto lock = std::scoped_lock(shard.mutex);
+        auto [it, inserted] = shard.map.try_emplace(key);
+        std::invoke(std::forward<Fn>(fn), it->second);
+        return inserted;
+    }
+
+    auto erase(
+        const Key& key
+    ) -> bool
+    {
+        auto&      shard = ShardOf(key);
+        const auto lock = std::scoped_lock(shard.mutex);
+        return shard.map.erase(key) != 0;
+    }
+
+    /**
+     * @brief 全要素に fn(const Key&, const T&) を適用する (シャードを 1 つずつ読みロックする)
+     */
+    template <typename Fn>
+    void for_each(
+        Fn&& fn
+    ) const
+    {
+        for (size_type s = 0; s < shard_count(); ++s)
+        {
+            const auto lock = std::shared_lock(shards_[s].mutex);
+            for (const auto& [k, v] : shards_[s].map)
+            {
+                std::invoke(fn, k, v);
+            }
+        }
+    }
+
+private:
+    struct alignas(detail::CACHE_LINE) Shard
+    {
+        mutable std::shared_mutex           mutex;
+        FlatHashMap<Key, T, Hash, KeyEqual> map;
+    };
+
+    // シャード内の表は混ぜたハッシュ値の下位ビットを使うので、シャードは上位ビットで選ぶ
+    auto ShardOf(
+        const Key& key
+    ) const -> Shard&
+    {
+        return shards_[detail::MixHash(std::invoke(hash_, key)) >> shift_];
+    }
+
+    size_type                shard_count_;
+    int                      shift_;  // 64 - log2(シャード数)
+    std::unique_ptr<Shard[]> shards_; // NOLINT
+    Hash                     hash_;
+};
+
+} // namespace cppreference
@@ -0,0 +1,498 @@
+#pragma once
+
+#include "cache_line.hpp"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <thread>
+#include <utility>
+
+namespace cppreference
+{
+
+namespace detail
+{
+
+/**
+ * @brief T を 1 つ置ける未初期化の領域 (T がデフォルト構築できなくてもよい)
+ */
+template <typename T>
+struct RawSlot
+{
+    alignas(T) std::byte bytes[sizeof(T)]; // NOLINT
+
+    auto get() -> T* { return std::launder(reinterpret_cast<T*>(bytes)); } // NOLINT
+};
+
+/**
+ * @brief try_once() が成功するまで他のスレッドに譲りながら繰り返す
+ */
+template <typename Fn>
+void SpinUntil(
+    Fn&& try_once
+)
+{
+    while (!try_once())
+    {
+        std::this_thread::yield();
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief 生産者 1 スレッド・消費者 1 スレッド用の有界リングバッファ (wait-free)
+ *
+ * 添字は単調増加させて容量 (2 の冪) で剰余を取る。生産者の tail と消費者の head は別のキャッシュラインに置き、
+ * 相手の添字はキャッシュしておいて、満杯 / 空に見えたときだけ読み直す (相手のラインを取りに行く回数を減らす)。
+ * try_* は wait-free、push / emplace は空きが出るまで yield しながら待つ。
+ * push 系は生産者スレッドから、front / pop / try_pop は消費者スレッドからだけ呼ぶこと。
+ */
+template <typename T>
+class SpscQueue
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+    /**
+     * @brief 容量は capacity 以上の 2 の冪
+     */
+    explicit SpscQueue(
+        size_type capacity
+    )
+        : mask_(std::bit_ceil(std::max<size_type>(capacity, 1)) - 1),
+          slots_(std::make_unique_for_overwrite<detail::RawSlot<T>[]>(mask_ + 1))
+    {
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue(SpscQueue&&) = delete;
+    auto operator=(const SpscQueue&) -> SpscQueue& = delete;
+    auto operator=(SpscQueue&&) -> SpscQueue& = delete;
+
+    ~SpscQueue()
+    {
+        const auto tail = producer_.tail.load(std::memory_order_relaxed);
+        for (auto i = consumer_.head.load(std::memory_order_relaxed); i != tail; ++i)
+        {
+            std::destroy_at(Slot(i));
+        }
+    }
+
+    [[nodiscard]] auto capacity() const -> size_type { return mask_ + 1; }
+
+    /**
+     * @brief 呼び出した時点の要素数 (他方のスレッドが動いていれば目安)
+     */
+    [[nodiscard]] auto size() const -> size_type
+    {
+        const auto head = consumer_.head.load(std::memory_order_acquire);
+        return producer_.tail.load(std::memory_order_acquire) - head;
+    }
+
+    [[nodiscard]] auto empty() const -> bool { return size() == 0; }
+
+    template <typename... Args>
+    auto try_emplace(
+        Args&&... args
+    ) -> bool
+    {
+        const auto tail = producer_.tail.load(std::memory_order_relaxed);
+        if (tail - producer_.head_cache > mask_)
+        {
+            producer_.head_cache = consumer_.head.load(std::memory_order_acquire);
+            if (tail - producer_.head_cache > mask_)
+            {
+                return false;
+            }
+        }
+        std::construct_at(Slot(tail), std::forward<Args>(args)...);
+        producer_.tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    auto try_push(
+        const value_type& value
+    ) -> bool
+    {
+        return try_emplace(value);
+    }
+
+    auto try_push(
+        value_type&& value
+    ) -> bool
+    {
+        return try_emplace(std::move(value));
+    }
+
+    /**
+     * @brief [first, last) を空いているだけ push し、push しなかった最初の要素を返す
+     *
+     * まとめて 1 回だけ tail を公開するので、1 要素ずつより消費者のキャッシュラインを奪う回数が少ない
+     */
+    template <std::forward_iterator It>
+    auto try_push(
+        It first,
+        It last
+    ) -> It
+    {
+        const auto tail = producer_.tail.load(std::memory_order_relaxed);
+        producer_.head_cache = consumer_.head.load(std::memory_order_acquire);
+        const auto n = std::min<size_type>(capacity() - (tail - producer_.head_cache), std::distance(first, last));
+        for (size_type i = 0; i < n; ++i, ++first)
+        {
+            std::construct_at(Slot(tail + i), *first);
+        }
+        producer_.tail.store(tail + n, std::memory_order_release);
+        return first;
+    }
+
+    template <typename... Args>
+    void emplace(
+        Args&&... args
+    )
+    {
+        detail::SpinUntil([&]() { return try_emplace(std::forward<Args>(args)...); });
+    }
+
+    void push(
+        const value_type& value
+    )
+    {
+        detail::SpinUntil([&]() { return try_emplace(value); });
+    }
+
+    void push(
+        value_type&& value
+    )
+    {
+        detail::SpinUntil([&]() { return try_emplace(std::move(value)); });
+    }
+
+    /**
+     * @brief 先頭の要素 (空なら nullptr)
+     */
+    [[nodiscard]] auto front() -> T*
+    {
+        const auto head = consumer_.head.load(std::memory_order_relaxed);
+        if (head == consumer_.tail_cache)
+        {
+            consumer_.tail_cache = producer_.tail.load(std::memory_order_acquire);
+            if (head == consumer_.tail_cache)
+            {
+                return nullptr;
+            }
+        }
+        return Slot(head);
+    }
+
+    /**
+     * @brief 先頭の要素を捨てる (front() が nullptr でないこと)
+     */
+    void pop()
+    {
+        const auto head = consumer_.head.load(std::memory_order_relaxed);
+        std::destroy_at(Slot(head));
+        consumer_.head.store(head + 1, std::memory_order_release);
+    }
+
+    auto try_pop() -> std::optional<T>
+    {
+        auto* p = front();
+        if (p == nullptr)
+        {
+            return std::nullopt;
+        }
+        auto value = std::optional<T>(std::move(*p));
+        pop();
+        return value;
+    }
+
+    /**
+     * @brief 最大 n 個を out に取り出し、書き終えた位置を返す
+     */
+    template <typename Out>
+    auto try_pop(
+        Out       out,
+        size_type n
+    ) -> Out
+    {
+        const auto head = consumer_.head.load(std::memory_order_relaxed);
+        consumer_.tail_cache = producer_.tail.load(std::memory_order_acquire);
+        n = std::min(n, consumer_.tail_cache - head);
+        for (size_type i = 0; i < n; ++i, ++out)
+        {
+            auto* p = Slot(head + i);
+            *out = std::move(*p);
+            std::destroy_at(p);
+        }
+        consumer_.head.store(head + n, std::memory_order_release);
+        return out;
+    }
+
+private:
+    auto Slot(
+        size_type i
+    ) const -> T*
+    {
+        return slots_[i & mask_].get();
+    }
+
+    struct alignas(detail::CACHE_LINE) Producer
+    {
+        std::atomic<size_type> tail{0};
+        size_type              head_cache = 0; // 最後に読んだ consumer_.head
+    };
+
+    struct alignas(detail::CACHE_LINE) Consumer
+    {
+        std::atomic<size_type> head{0};
+        size_type              tail_cache = 0; // 最後に読んだ producer_.tail
+    };
+
+    size_type                             mask_;
+    std::unique_ptr<detail::RawSlot<T>[]> slots_; // NOLINT
+    Producer                              producer_;
+    Consumer                              consumer_;
+};
+
+/**
+ * @brief 複数生産者・複数消費者用の有界リングバッファ (lock-free)
+ *
+ * 各スロットに通し番号 seq を持たせる (Vyukov の bounded MPMC queue)。
+ * 位置 pos のスロットは seq == pos なら書き込み可、seq == pos + 1 なら読み出し可で、
+ * 生産者 / 消費者は enqueue / dequeue の位置を CAS で確保してから書き込み / 読み出しを行い、seq を進めて公開する。
+ * 複数の消費者がいると先頭の要素は他のスレッドに取られ得るので、front は持たず try_pop で取り出す。
+ */
+template <typename T>
+class MpmcQueue
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+    /**
+     * @brief 容量は capacity 以上の 2 の冪
+     */
+    explicit MpmcQueue(
+        size_type capacity
+    )
+        : mask_(std::bit_ceil(std::max<size_type>(capacity, 1)) - 1),
+          cells_(std::make_unique_for_overwrite<Cell[]>(mask_ + 1))
+    {
+        for (size_type i = 0; i <= mask_; ++i)
+        {
+            cells_[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue(MpmcQueue&&) = delete;
+    auto operator=(const MpmcQueue&) -> MpmcQueue& = delete;
+    auto operator=(MpmcQueue&&) -> MpmcQueue& = delete;
+
+    ~MpmcQueue()
+    {
+        const auto tail = enqueue_.pos.load(std::memory_order_relaxed);
+        for (auto i = dequeue_.pos.load(std::memory_order_relaxed); i != tail; ++i)
+        {
+            std::destroy_at(cells_[i & mask_].slot.get());
+        }
+    }
+
+    [[nodiscard]] auto capacity() const -> size_type { return mask_ + 1; }
+
+    /**
+     * @brief 確保済みの位置の差 (他のスレッドが動いていれば目安)
+     */
+    [[nodiscard]] auto size() const -> size_type
+    {
+        const auto head = dequeue_.pos.load(std::memory_order_acquire);
+        const auto tail = enqueue_.pos.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    [[nodiscard]] auto empty() const -> bool { return size() == 0; }
+
+    template <typename... Args>
+    auto try_emplace(
+        Args&&... args
+    ) -> bool
+    {
+        const auto [pos, n] = Claim(enqueue_.pos, 1, 0);
+        if (n == 0)
+        {
+            return false;
+        }
+        auto& cell = cells_[pos & mask_];
+        std::construct_at(cell.slot.get(), std::forward<Args>(args)...);
+        cell.seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    auto try_push(
+        const value_type& value
+    ) -> bool
+    {
+        return try_emplace(value);
+    }
+
+    auto try_push(
+        value_type&& value
+    ) -> bool
+    {
+        return try_emplace(std::move(value));
+    }
+
+    /**
+     * @brief [first, last) を連続して空いているだけ push し、push しなかった最初の要素を返す
+     *
+     * 位置の確保を 1 回の CAS で済ませるので、生産者どうしの enqueue 位置の奪い合いが減る
+     */
+    template <std::forward_iterator It>
+    auto try_push(
+        It first,
+        It last
+    ) -> It
+    {
+        const auto [pos, n] = Claim(enqueue_.pos, std::min<size_type>(capacity(), std::distance(first, last)), 0);
+        for (size_type i = 0; i < n; ++i, ++first)
+        {
+            auto& cell = cells_[(pos + i) & mask_];
+            std::construct_at(cell.slot.get(), *first);
+            cell.seq.store(pos + i + 1, std::memory_order_release);
+        }
+        return first;
+    }
+
+    template <typename... Args>
+    void emplace(
+        Args&&... args
+    )
+    {
+        detail::SpinUntil([&]() { return try_emplace(std::forward<Args>(args)...); });
+    }
+
+    void push(
+        const value_type& value
+    )
+    {
+        detail::SpinUntil([&]() { return try_emplace(value); });
+    }
+
+    void push(
+        value_type&& value
+    )
+    {
+        detail::SpinUntil([&]() { return try_emplace(std::move(value)); });
+    }
+
+    auto try_pop() -> std::optional<T>
+    {
+        const auto [pos, n] = Claim(dequeue_.pos, 1, 1);
+        if (n == 0)
+        {
+            return std::nullopt;
+        }
+        auto& cell = cells_[pos & mask_];
+        auto  value = std::optional<T>(std::move(*cell.slot.get()));
+        std::destroy_at(cell.slot.get());
+        cell.seq.store(pos + mask_ + 1, std::memory_order_release);
+        return value;
+    }
+
+    /**
+     * @brief 連続して読み出せる最大 n 個を out に取り出し、書き終えた位置を返す
+     */
+    template <typename Out>
+    auto try_pop(
+        Out       out,
+        size_type n
+    ) -> Out
+    {
+        const auto [pos, got] = Claim(dequeue_.pos, std::min(n, capacity()), 1);
+        for (size_type i = 0; i < got; ++i, ++out)
+        {
+            auto& cell = cells_[(pos + i) & mask_];
+            *out = std::move(*cell.slot.get());
+            std::destroy_at(cell.slot.get());
+            cell.seq.store(pos + i + mask_ + 1, std::memory_order_release);
+        }
+        return out;
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_type> seq;
+        detail::RawSlot<T>     slot;
+    };
+
+    struct alignas(detail::CACHE_LINE) Position
+    {
+        std::atomic<size_type> pos{0};
+    };
+
+    /**
+     * @brief at から連続して seq == 位置 + lag のスロットを最大 n 個確保し、{先頭の位置, 確保できた数} を返す
+     *
+     * lag は生産者なら 0 (空き)、消費者なら 1 (書き込み済み)。
+     * 一度 seq が合ったスロットは確保した本人が進めるまで変わらないので、数えてから CAS すればよい
+     */
+    auto Claim(
+        std::atomic<size_type>& at,
+        size_type               n,
+        size_type               lag
+    ) -> std::pair<size_type, size_type>
+    {
+        auto pos = at.load(std::memory_order_relaxed);
+        while (true)
+        {
+            size_type ready = 0;
+            auto      behind = false;
+            for (; ready < n; ++ready)
+            {
+                const auto seq = cells_[(pos + ready) & mask_].seq.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::ptrdiff_t>(seq - (pos + ready + lag));
+                if (diff != 0)
+                {
+                    // diff > 0 なら pos が古い (他のスレッドが先に確保した)
+                    behind = ready == 0 && diff > 0;
+                    break;
+                }
+            }
+            if (ready > 0)
+            {
+                if (at.compare_exchange_weak(pos, pos + ready, std::memory_order_relaxed))
+                {
+                    return {pos, ready};
+                }
+            }
+            else if (behind)
+            {
+                pos = at.load(std::memory_order_relaxed);
+            }
+            else
+            {
+                return {pos, 0}; // 満杯 / 空
+            }
+        }
+    }
+
+    size_type               mask_;
+    std::unique_ptr<Cell[]> cells_; // NOLINT
+    Position                enqueue_;
+    Position                dequeue_;
+};
+
+} // namespace cppreference
@@ -0,0 +1,348 @@
+#pragma once
+
+#include "cache_line.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace cppreference
+{
+
+namespace detail
+{
+
+/**
+ * @brief 要素 1 番目がキャッシュラインの先頭に来るように、先頭を sizeof(T) だけ手前にずらして確保するアロケータ
+ *
+ * d 分ヒープでは兄弟 (添字 d * i + 1 から d 個) が 1 番目から d 個ずつ並ぶので、
+ * d * sizeof(T) が 64 なら兄弟がちょうど 1 本のキャッシュラインに収まる。
+ */
+template <typename T>
+class SiblingAlignedAllocator
+{
+public:
+    using value_type = T;
+
+    SiblingAlignedAllocator() = default;
+
+    template <typename U>
+    SiblingAlignedAllocator( // NOLINT
+        const SiblingAlignedAllocator<U>& /* other */
+    )
+    {
+    }
+
+    auto allocate(
+        std::size_t n
+    ) -> T*
+    {
+        auto* p = static_cast<std::byte*>(::operator new((n * sizeof(T)) + OFFSET, std::align_val_t{CACHE_LINE}));
+        return reinterpret_cast<T*>(p + OFFSET); // NOLINT
+    }
+
+    void deallocate(
+        T*          p,
+        std::size_t n
+    )
+    {
+        ::operator delete(
+            reinterpret_cast<std::byte*>(p) - OFFSET, (n * sizeof(T)) + OFFSET, std::align_val_t{CACHE_LINE} // NOLINT
+        );
+    }
+
+    friend auto operator==(
+        const SiblingAlignedAllocator& /* a */,
+        const SiblingAlignedAllocator& /* b */
+    ) -> bool
+    {
+        return true;
+    }
+
+private:
+    static constexpr std::size_t OFFSET = (CACHE_LINE - (sizeof(T) % CACHE_LINE)) % CACHE_LINE;
+};
+
+} // namespace detail
+
+/**
+ * @brief d 分ヒープによる優先度付きキュー (std::priority_queue と同じく comp で最大のものが top)
+ *
+ * 子が d 個並ぶので木の高さが log_d(n) になり、pop で子を比べる回数は増えるが、兄弟は 1 本のキャッシュラインに収まる。
+ * push / emplace が返すハンドルで、要素の優先度の変更 (decrease_key / update) と削除 (erase) ができる。
+ * ハンドルはその要素が pop / erase されるまで有効で、その後は別の要素に再利用される。
+ * ハンドルと位置は 32 bit で持つ (要素と位置の表を小さくしてキャッシュミスを減らす) ので、要素数は 2^32 - 1 個まで。
+ */
+template <typename T, typename Compare = std::less<T>, std::size_t D = 4>
+    requires(D >= 2)
+class DaryHeap
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using value_compare = Compare;
+    using reference = T&;
+    using const_reference = const T&;
+    using handle_type = std::uint32_t;
+
+    DaryHeap() = default;
+
+    explicit DaryHeap(
+        const Compare& comp
+    )
+        : comp_(comp)
+    {
+    }
+
+    /**
+     * @brief [first, last) から作る。i 番目の要素のハンドルは i
+     */
+    template <std::input_iterator It>
+    DaryHeap(
+        It             first,
+        It             last,
+        const Compare& comp = Compare()
+    )
+        : comp_(comp)
+    {
+        for (; first != last; ++first)
+        {
+            const auto i = static_cast<std::uint32_t>(heap_.size());
+            pos_.push_back(i);
+            heap_.push_back({*first, i});
+        }
+        // 葉でない最後のノードから順にふるい落とす
+        if (heap_.size() > 1)
+        {
+            for (auto i = ((heap_.size() - 2) / D) + 1; i-- > 0;)
+            {
+                SiftDown(i);
+            }
+        }
+    }
+
+    [[nodiscard]] auto empty() const -> bool { return heap_.empty(); }
+
+    [[nodiscard]] auto size() const -> size_type { return heap_.size(); }
+
+    [[nodiscard]] auto top() const -> const_reference { return heap_.front().value; }
+
+    [[nodiscard]] auto top_handle() const -> handle_type { return heap_.front().handle; }
+
+    [[nodiscard]] auto operator[](
+        handle_type h
+    ) const -> const_reference
+    {
+        return heap_[pos_[h]].value;
+    }
+
+    auto push(
+        const value_type& value
+    ) -> handle_type
+    {
+        return emplace(value);
+    }
+
+    auto push(
+        value_type&& value
+    ) -> handle_type
+    {
+        return emplace(std::move(value));
+    }
+
+    template <typename... Args>
+    auto emplace(
+        Args&&... args
+    ) -> handle_type
+    {
+        const auto  i = static_cast<std::uint32_t>(heap_.size());
+        handle_type h = 0;
+        if (free_.empty())
+        {
+            h = static_cast<handle_type>(pos_.size());
+            pos_.push_back(i);
+        }
+        else
+        {
+            h = free_.back();
+            free_.pop_back();
+            pos_[h] = i;
+        }
+        heap_.push_back({T(std::forward<Args>(args)...), h});
+        SiftUp(heap_.size() - 1);
+        return h;
+    }
+
+    void pop() { RemoveAt(0); }
+
+    /**
+     * @brief h の要素を削除する
+     */
+    void erase(
+        handle_type h
+    )
+    {
+        RemoveAt(pos_[h]);
+    }
+
+    /**
+     * @brief h の要素を top に近づく値 value に置き換える (std::greater の最小ヒープなら値を小さくする)
+     *
+     * value が元の値より top から遠いときは update を使う
+     */
+    void decrease_key(
+        handle_type h,
+        value_type  value
+    )
+    {
+        const auto i = pos_[h];
+        heap_[i].value = std::move(value);
+        SiftUp(i);
+    }
+
+    /**
+     * @brief h の要素を value に置き換える (どちらに動いてもよい)
+     */
+    void update(
+        handle_type h,
+        value_type  value
+    )
+    {
+        const auto i = pos_[h];
+        heap_[i].value = std::move(value);
+        SiftDown(SiftUp(i));
+    }
+
+    void swap(
+        DaryHeap& other
+    ) noexcept
+    {
+        using std::swap;
+        swap(heap_, other.heap_);
+        swap(pos_, other.pos_);
+        swap(free_, other.free_);
+        swap(comp_, other.comp_);
+    }
+
+private:
+    struct Entry
+    {
+        T           value;
+        handle_type handle;
+    };
+
+    // a より b を先に出すか
+    auto Before(
+        const Entry& a,
+        const Entry& b
+    ) const -> bool
+    {
+        return std::invoke(comp_, a.value, b.value);
+    }
+
+    void Place(
+        std::size_t i,
+        Entry&&     e
+    )
+    {
+        pos_[e.handle] = static_cast<std::uint32_t>(i);
+        heap_[i] = std::move(e);
+    }
+
+    // 穴 i を上へ動かしてから e を置く。置いた位置を返す
+    auto Lift(
+        std::size_t i,
+        Entry       e
+    ) -> std::size_t
+    {
+        while (i > 0)
+        {
+            const auto parent = (i - 1) / D;
+            if (!Before(heap_[parent], e))
+            {
+                break;
+            }
+            Place(i, std::move(heap_[parent]));
+            i = parent;
+        }
+        Place(i, std::move(e));
+        return i;
+    }
+
+    auto SiftUp(
+        std::size_t i
+    ) -> std::size_t
+    {
+        auto e = std::move(heap_[i]);
+        return Lift(i, std::move(e));
+    }
+
+    // i の子のうち最も先に出すもの (子がなければ i)
+    auto BestChild(
+        std::size_t i
+    ) const -> std::size_t
+    {
+        const auto first = (D * i) + 1;
+        if (first >= heap_.size())
+        {
+            return i;
+        }
+        const auto last = std::min(first + D, heap_.size());
+        auto       best = first;
+        for (auto c = first + 1; c < last; ++c)
+        {
+            best = Before(heap_[best], heap_[c]) ? c : best;
+        }
+        return best;
+    }
+
+    void SiftDown(
+        std::size_t i
+    )
+    {
+        auto e = std::move(heap_[i]);
+        for (auto best = BestChild(i); best != i && Before(e, heap_[best]); best = BestChild(i))
+        {
+            Place(i, std::move(heap_[best]));
+            i = best;
+        }
+        Place(i, std::move(e));
+    }
+
+    /**
+     * @brief i の要素を取り除く
+     *
+     * 穴を子の最善のものと入れ替えながら葉まで下ろし、末尾の要素を穴に置いて上げる。
+     * 末尾の要素はたいてい葉の近くに戻るので、下ろしながら末尾の要素と比べるより比較が少ない
+     */
+    void RemoveAt(
+        std::size_t i
+    )
+    {
+        free_.push_back(heap_[i].handle);
+
+        auto e = std::move(heap_.back());
+        heap_.pop_back();
+        if (i == heap_.size())
+        {
+            return;
+        }
+        for (auto best = BestChild(i); best != i; best = BestChild(i))
+        {
+            Place(i, std::move(heap_[best]));
+            i = best;
+        }
+        Lift(i, std::move(e));
+    }
+
+    std::vector<Entry, detail::SiblingAlignedAllocator<Entry>> heap_;
+    std::vector<std::uint32_t>                                 pos_;  // ハンドル -> heap_ の添字
+    std::vector<handle_type>                                   free_; // 再利用できるハンドル
+    Compare                                                    comp_;
+};
+
+} // namespace cppreference
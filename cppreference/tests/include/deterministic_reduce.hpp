@@ -0,0 +1,265 @@
+#pragma once
+
+#include "execution.hpp"
+#include "simd_search.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+
+namespace cppreference
+{
+
+/**
+ * @brief 浮動小数点数の総和の取り方
+ */
+enum class Summation : std::uint8_t
+{
+    Pairwise, // 固定の木で足し合わせる
+    Neumaier, // 各加算の丸め誤差を別に積算して最後に足す (Kahan の改良版)
+};
+
+namespace detail
+{
+
+// 木の葉 1 つが受け持つ要素数。スレッド数や grain に依らず固定なので結果がビット単位で再現する
+inline constexpr std::size_t REDUCE_BLOCK = 2048;
+
+// 葉の中で並行して積算するレーン数 (AVX2 の double 4 本 x 4, float 8 本 x 2)
+inline constexpr std::size_t REDUCE_LANES = 16;
+
+template <std::floating_point T>
+struct PartialSum
+{
+    T sum;
+    T compensation;
+};
+
+template <std::floating_point T, Summation S>
+[[gnu::always_inline]] inline void Accumulate(
+    T& sum,
+    T& compensation,
+    T  x
+)
+{
+    if constexpr (S == Summation::Neumaier)
+    {
+        // 分岐する Neumaier の式と同じく sum + x の丸め誤差を厳密に求める (分岐がないのでベクトル化できる)
+        const auto t = sum + x;
+        const auto v = t - sum;
+        compensation += (sum - (t - v)) + (x - v);
+        sum = t;
+    }
+    else
+    {
+        sum += x;
+    }
+}
+
+template <std::floating_point T, Summation S>
+[[gnu::always_inline]] inline auto Combine(
+    PartialSum<T> a,
+    PartialSum<T> b
+) -> PartialSum<T>
+{
+    Accumulate<T, S>(a.sum, a.compensation, b.sum);
+    a.compensation += b.compensation;
+    return a;
+}
+
+/**
+ * @brief 葉 1 つ分の総和
+ *
+ * i 番目の要素は必ずレーン i % REDUCE_LANES に足し、レーンは固定の 2 分木でまとめるので、
+ * 命令セットによらず同じ順序で加算する。どちらの版も同じ本体を展開する。
+ */
+template <std::floating_point T, Summation S>
+[[gnu::always_inline]] inline auto LeafSumBody(
+    const T*    p,
+    std::size_t n
+) -> PartialSum<T>
+{
+    auto sum = std::array<T, REDUCE_LANES>{};
+    auto compensation = std::array<T, REDUCE_LANES>{};
+
+    std::size_t i = 0;
+    for (; i + REDUCE_LANES <= n; i += REDUCE_LANES)
+    {
+        for (std::size_t j = 0; j < REDUCE_LANES; ++j)
+        {
+            Accumulate<T, S>(sum[j], compensation[j], p[i + j]);
+        }
+    }
+    for (std::size_t j = 0; i + j < n; ++j)
+    {
+        Accumulate<T, S>(sum[j], compensation[j], p[i + j]);
+    }
+
+    for (std::size_t w = REDUCE_LANES / 2; w > 0; w /= 2)
+    {
+        for (std::size_t j = 0; j < w; ++j)
+        {
+            Accumulate<T, S>(sum[j], compensation[j], sum[j + w]);
+            compensation[j] += compensation[j + w];
+        }
+    }
+    return {sum[0], compensation[0]};
+}
+
+template <std::floating_point T, Summation S>
+auto LeafSumScalar(
+    const T*    p,
+    std::size_t n
+) -> PartialSum<T>
+{
+    return LeafSumBody<T, S>(p, n);
+}
+
+#if CPPREFERENCE_SIMD_X86
+template <std::floating_point T, Summation S>
+[[gnu::target("avx2")]] auto LeafSumAvx2(
+    const T*    p,
+    std::size_t n
+) -> PartialSum<T>
+{
+    return LeafSumBody<T, S>(p, n);
+}
+#endif
+
+template <std::floating_point T, Summation S>
+auto LeafSum(
+    const T*    p,
+    std::size_t n
+) -> PartialSum<T>
+{
+#if CPPREFERENCE_SIMD_X86
+    if (simd::CurrentIsa() == simd::Isa::Avx2)
+    {
+        return LeafSumAvx2<T, S>(p, n);
+    }
+#endif
+    return LeafSumScalar<T, S>(p, n);
+}
+
+/**
+ * @brief 葉の総和 [first, last) を半分ずつに分ける固定の木でまとめる
+ */
+template <std::floating_point T, Summation S>
+auto TreeSum(
+    const PartialSum<T>* first,
+    const PartialSum<T>* last
+) -> PartialSum<T>
+{
+    if (last - first == 1)
+    {
+        return *first;
+    }
+    const auto mid = first + ((last - first) / 2);
+    return Combine<T, S>(TreeSum<T, S>(first, mid), TreeSum<T, S>(mid, last));
+}
+
+/**
+ * @brief pool が nullptr なら逐次に葉を計算する。どちらでも同じ木になる
+ */
+template <std::floating_point T, Summation S>
+auto DeterministicReduce(
+    ThreadPool* pool,
+    std::size_t grain,
+    const T*    p,
+    std::size_t n,
+    T           init
+) -> T
+{
+    if (n == 0)
+    {
+        return init;
+    }
+
+    const auto blocks = (n + REDUCE_BLOCK - 1) / REDUCE_BLOCK;
+    auto       leaves = std::make_unique_for_overwrite<PartialSum<T>[]>(blocks); // NOLINT
+    const auto leaf = [&](std::size_t b, std::size_t e) {
+        for (auto k = b; k < e; ++k)
+        {
+            leaves[k] = LeafSum<T, S>(p + (k * REDUCE_BLOCK), std::min(REDUCE_BLOCK, n - (k * REDUCE_BLOCK)));
+        }
+    };
+    if (pool != nullptr)
+    {
+        pool->ParallelFor(0, blocks, std::max<std::size_t>(1, grain / REDUCE_BLOCK), leaf);
+    }
+    else
+    {
+        leaf(0, blocks);
+    }
+
+    auto total = Combine<T, S>({init, T{0}}, TreeSum<T, S>(leaves.get(), leaves.get() + blocks));
+    // inf を含むと補正項が NaN になるので使わない
+    return std::isfinite(total.sum) ? total.sum + total.compensation : total.sum;
+}
+
+template <std::floating_point T>
+auto DeterministicReduce(
+    ThreadPool* pool,
+    std::size_t grain,
+    const T*    p,
+    std::size_t n,
+    T           init,
+    Summation   mode
+) -> T
+{
+    if (mode == Summation::Neumaier)
+    {
+        return DeterministicReduce<T, Summation::Neumaier>(pool, grain, p, n, init);
+    }
+    return DeterministicReduce<T, Summation::Pairwise>(pool, grain, p, n, init);
+}
+
+} // namespace detail
+
+/**
+ * @brief ビット単位で再現する浮動小数点数の総和
+ *
+ * 要素を固定長の葉に分け、葉の中は 16 レーンで、葉同士は固定の 2 分木で足し合わせる。
+ * 加算の順序はスレッド数・grain・命令セットに依らず要素数だけで決まるので、結果は常に同じになる。
+ * 逐次の std::accumulate とは順序が違うので値は一致しない。
+ * -ffast-math など加算の順序を変える最適化を有効にすると再現性は保証されない。
+ */
+template <std::contiguous_iterator It>
+    requires std::floating_point<std::iter_value_t<It>>
+auto deterministic_reduce(
+    It                    first,
+    It                    last,
+    std::iter_value_t<It> init = 0,
+    Summation             mode = Summation::Pairwise
+) -> std::iter_value_t<It>
+{
+    return detail::DeterministicReduce(
+        nullptr, 0, std::to_address(first), static_cast<std::size_t>(last - first), init, mode
+    );
+}
+
+/**
+ * @brief deterministic_reduce (ThreadPool 版)
+ *
+ * 葉の計算だけを並列に行う。結果は逐次版と同じ
+ */
+template <std::contiguous_iterator It>
+    requires std::floating_point<std::iter_value_t<It>>
+auto deterministic_reduce(
+    const execution::PoolPolicy& policy,
+    It                           first,
+    It                           last,
+    std::iter_value_t<It>        init = 0,
+    Summation                    mode = Summation::Pairwise
+) -> std::iter_value_t<It>
+{
+    const auto n = static_cast<std::size_t>(last - first);
+    return detail::DeterministicReduce(&policy.pool(), policy.grain(n), std::to_address(first), n, init, mode);
+}
+
+} // namespace cppreference
@@ -0,0 +1,594 @@
+#pragma once
+
+#include "segmented_iterator.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cppreference
+{
+namespace execution
+{
+
+/**
+ * @brief ThreadPool 上で実行する実行ポリシー
+ *
+ * std::execution::par は libstdc++ では TBB が無いと逐次実行になるため、
+ * 自前のプールで分割実行する。pool を指定しなければ ThreadPool::Instance() を使う。
+ */
+class PoolPolicy
+{
+public:
+    constexpr PoolPolicy() = default;
+
+    explicit constexpr PoolPolicy(
+        ThreadPool& pool,
+        std::size_t grain = 0
+    )
+        : pool_(&pool), grain_(grain)
+    {
+    }
+
+    [[nodiscard]] auto pool() const -> ThreadPool& { return (pool_ != nullptr) ? *pool_ : ThreadPool::Instance(); }
+
+    /**
+     * @brief n 要素を処理するときの 1 タスクあたりの要素数
+     *
+     * 明示されていなければワーカーあたり 8 タスク程度に分ける (ただし MIN_GRAIN 以上)
+     */
+    [[nodiscard]] auto grain(
+        std::size_t n
+    ) const -> std::size_t
+    {
+        if (grain_ != 0)
+        {
+            return grain_;
+        }
+        return std::max(MIN_GRAIN, n / (pool().size() * 8)); // NOLINT
+    }
+
+    [[nodiscard]] constexpr auto on(
+        ThreadPool& pool
+    ) const -> PoolPolicy
+    {
+        return PoolPolicy(pool, grain_);
+    }
+
+    [[nodiscard]] constexpr auto with_grain(
+        std::size_t grain
+    ) const -> PoolPolicy
+    {
+        auto p = *this;
+        p.grain_ = grain;
+        return p;
+    }
+
+private:
+    static constexpr std::size_t MIN_GRAIN = 4096;
+
+    ThreadPool* pool_ = nullptr;
+    std::size_t grain_ = 0;
+};
+
+inline constexpr PoolPolicy par{};
+
+} // namespace execution
+
+/**
+ * @brief for_each (ThreadPool 版)
+ *
+ * RandomAccessIterator なら区間分割して並列に、それ以外は逐次で実行する。
+ * 区間はどちらも cppreference::for_each で処理するので、std::deque はブロックごとの内側のループになる
+ */
+template <std::random_access_iterator It, typename F>
+void for_each(
+    const execution::PoolPolicy& policy,
+    It                           first,
+    It                           last,
+    F                            f
+)
+{
+    const auto n = static_cast<std::size_t>(last - first);
+    policy.pool().ParallelFor(0, n, policy.grain(n), [&](std::size_t b, std::size_t e) {
+        cppreference::for_each(first + b, first + e, f);
+    });
+}
+
+template <std::forward_iterator It, typename F>
+void for_each(
+    const execution::PoolPolicy& /* policy */,
+    It                           first,
+    It                           last,
+    F                            f
+)
+{
+    cppreference::for_each(first, last, f);
+}
+
+template <std::forward_iterator It, std::integral Size, typename F>
+auto for_each_n(
+    const execution::PoolPolicy& policy,
+    It                           first,
+    Size                         n,
+    F                            f
+) -> It
+{
+    if (n <= 0)
+    {
+        return first;
+    }
+    auto last = std::next(first, n);
+    cppreference::for_each(policy, first, last, f);
+    return last;
+}
+
+/**
+ * @brief fill (ThreadPool 版)
+ */
+template <std::random_access_iterator It, typename T>
+void fill(
+    const execution::PoolPolicy& policy,
+    It                           first,
+    It                           last,
+    const T&                     value
+)
+{
+    const auto n = static_cast<std::size_t>(last - first);
+    policy.pool().ParallelFor(0, n, policy.grain(n), [&](std::size_t b, std::size_t e) {
+        cppreference::fill(first + b, first + e, value);
+    });
+}
+
+template <std::forward_iterator It, typename T>
+void fill(
+    const execution::PoolPolicy& /* policy */,
+    It                           first,
+    It                           last,
+    const T&                     value
+)
+{
+    cppreference::fill(first, last, value);
+}
+
+/**
+ * @brief copy (ThreadPool 版)
+ */
+template <std::random_access_iterator It, std::random_access_iterator Out>
+auto copy(
+    const execution::PoolPolicy& policy,
+    It                           first,
+    It                           last,
+    Out                          d_first
+) -> Out
+{
+    const auto n = static_cast<std::size_t>(last - first);
+    policy.pool().ParallelFor(0, n, policy.grain(n), [&](std::size_t b, std::size_t e) {
+        cppreference::copy(first + b, first + e, d_first + b);
+    });
+    return d_first + n;
+}
+
+template <std::forward_iterator It, std::forward_iterator Out>
+auto copy(
+    const execution::PoolPolicy& /* policy */,
+    It                           first,
+    It                           last,
+    Out                          d_first
+) -> Out
+{
+    return cppreference::copy(first, last, d_first);
+}
+
+/**
+ * @brief find (ThreadPool 版)
+ *
+ * 区間ごとに並列に探し、見つかった位置の最小値を返す。見つかった位置より後ろの区間は探さない。
+ */
+template <std::random_access_iterator It, typename T>
+auto find(
+    const execution::PoolPolicy& policy,
+    It                           first,
+    It                           last,
+    const T&                     value
+) -> It
+{
+    const auto n = static_cast<std::size_t>(last - first);
+    auto       found = std::atomic<std::size_t>(n);
+    policy.pool().ParallelFor(0, n, policy.grain(n), [&](std::size_t b, std::size_t e) {
+        if (b >= found.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+        const auto i = static_cast<std::size_t>(cppreference::find(first + b, first + e, value) - first);
+        if (i == e)
+        {
+            return;
+        }
+        auto current = found.load(std::memory_order_relaxed);
+        while (i < current && !found.compare_exchange_weak(current, i, std::memory_order_relaxed))
+        {
+        }
+    });
+    return first + found.load(std::memory_order_relaxed);
+}
+
+template <std::forward_iterator It, typename T>
+auto find(
+    const execution::PoolPolicy& /* policy */,
+    It                           first,
+    It                           last,
+    const T&                     value
+) -> It
+{
+    return cppreference::find(first, last, value);
+}
+
+/**
+ * @brief transform (ThreadPool 版)
+ */
+template <std::random_access_iterator It, std::random_access_iterator Out, typename UnaryOp>
+auto transform(
+    const execution::PoolPolicy& policy,
+    It                           first,
+    It                           last,
+    Out                          d_first,
+    UnaryOp                      op
+) -> Out
+{
+    const auto n = static_cast<std::size_t>(last - first);
+    policy.pool().ParallelFor(0, n, policy.grain(n), [&](std::size_t b, std::size_t e) {
+        std::transform(first + b, first + e, d_first + b, op);
+    });
+    return d_first + n;
+}
+
+template <std::forward_iterator It, std::forward_iterator Out, typename UnaryOp>
+auto transform(
+    const execution::PoolPolicy& /* policy */,
+    It                           first,
+    It                           last,
+    Out                          d_first,
+    UnaryOp                      op
+) -> Out
+{
+    return std::transform(first, last, d_first, op);
+}
+
+template <
+    std::random_access_iterator It1,
+    std::random_access_iterator It2,
+    std::random_access_iterator Out,
+    typename BinaryOp>
+auto transform(
+    const execution::PoolPolicy& policy,
+    It1                          first1,
+    It1                          last1,
+    It2                          first2,
+    Out                          d_first,
+    BinaryOp                     op
+) -> Out
+{
+    const auto n = static_cast<std::size_t>(last1 - first1);
+    policy.pool().ParallelFor(0, n, policy.grain(n), [&](std::size_t b, std::size_t e) {
+        std::transform(first1 + b, first1 + e, first2 + b, d_first + b, op);
+    });
+    return d_first + n;
+}
+
+template <std::forward_iterator It1, std::forward_iterator It2, std::forward_iterator Out, typename BinaryOp>
+auto transform(
+    const execution::PoolPolicy& /* policy */,
+    It1                          first1,
+    It1                          last1,
+    It2                          first2,
+    Out                          d_first,
+    BinaryOp                     op
+) -> Out
+{
+    return std::transform(first1, last1, first2, d_first, op);
+}
+
+/**
+ * @brief reduce (ThreadPool 版)
+ *
+ * grain ごとのブロックを並列に畳み込み、ブロックの結果を先頭から順に init へ畳み込む。
+ * std::reduce と同様に op は結合的かつ可換である必要がある。
+ */
+template <std::random_access_iterator It, typename T, typename BinaryOp>
+auto reduce(
+    const execution::PoolPolicy& policy,
+    It                           first,
+    It                           last,
+    T                            init,
+    BinaryOp                     op
+) -> T
+{
+    const auto n = static_cast<std::size_t>(last - first);
+    if (n == 0)
+    {
+        return init;
+    }
+    const auto grain = policy.grain(n);
+    const auto blocks = (n + grain - 1) / grain;
+
+    auto partials = std::vector<std::optional<T>>(blocks);
+    policy.pool().ParallelFor(0, blocks, 1, [&](std::size_t b, std::size_t e) {
+        for (auto k = b; k < e; ++k)
+        {
+            const auto head = first + (k * grain);
+            const auto tail = first + std::min(n, (k + 1) * grain);
+            partials[k].emplace(cppreference::reduce(std::next(head), tail, T(*head), op));
+        }
+    });
+
+    for (auto& p : partials)
+    {
+        init = op(std::move(init), std::move(*p));
+    }
+    return init;
+}
+
+template <std::forward_iterator It, typename T, typename BinaryOp>
+auto reduce(
+    const execution::PoolPolicy& /* policy */,
+    It                           first,
+    It                           last,
+    T                            init,
+    BinaryOp                     op
+) -> T
+{
+    return cppreference::reduce(first, last, std::move(init), op);
+}
+
+template <std::forward_iterator It, typename T>
+auto reduce(
+    const execution::PoolPolicy& policy,
+    It                           first,
+    It                           last,
+    T                            init
+) -> T
+{
+    return cppreference::reduce(policy, first, last, std::move(init), std::plus<>());
+}
+
+template <std::forward_iterator It>
+auto reduce(
+    const execution::PoolPolicy& policy,
+    It                           first,
+    It                           last
+) -> std::iter_value_t<It>
+{
+    return cppreference::reduce(policy, first, last, std::iter_value_t<It>{}, std::plus<>());
+}
+
+namespace detail
+{
+
+/**
+ * @brief transform してから scan する (ThreadPool 版の scan の共通部分)
+ *
+ * 2 パスのブロック分割で、1 パス目で grain ごとのブロックの総和を並列に求め、
+ * その累積をブロックの初期値として 2 パス目で各ブロックを並列に scan する。
+ * std の並列版と同様に op は結合的であればよく、可換である必要はない。
+ * 出力先は入力と同じ区間でもよい。
+ */
+template <bool Exclusive, typename It, typename Out, typename T, typename BinaryOp, typename UnaryOp>
+auto TransformScan(
+    const execution::PoolPolicy& policy,
+    It                           first,
+    It                           last,
+    Out                          d_first,
+    std::optional<T>             init,
+    BinaryOp                     op,
+    UnaryOp                      unary
+) -> Out
+{
+    if constexpr (std::random_access_iterator<It> && std::random_access_iterator<Out>)
+    {
+        const auto n = static_cast<std::size_t>(last - first);
+        const auto grain = policy.grain(n);
+        const auto blocks = (n + grain - 1) / grain;
+
+        // 2 パスにすると読み出しが 2 倍になるので、並列に動かせないなら下の逐次版で 1 パスにする
+        if ((policy.pool().size() > 1) && (blocks > 1))
+        {
+            // 最後のブロックの総和は使わない
+            auto partials = std::vector<std::optional<T>>(blocks);
+            policy.pool().ParallelFor(0, blocks - 1, 1, [&](std::size_t b, std::size_t e) {
+                for (auto k = b; k < e; ++k)
+                {
+                    const auto head = first + (k * grain);
+                    const auto tail = first + ((k + 1) * grain);
+                    auto       acc = T(unary(*head));
+                    for (auto it = std::next(head); it != tail; ++it)
+                    {
+                        acc = op(std::move(acc), unary(*it));
+                    }
+                    partials[k].emplace(std::move(acc));
+                }
+            });
+
+            // partials[k] をブロック k の初期値で置き換える
+            for (std::size_t k = 0; k < blocks; ++k)
+            {
+                auto carry = std::move(init);
+                if (k + 1 < blocks)
+                {
+                    init.emplace(carry ? op(*carry, std::move(*partials[k])) : std::move(*partials[k]));
+                }
+                partials[k] = std::move(carry);
+            }
+
+            policy.pool().ParallelFor(0, blocks, 1, [&](std::size_t b, std::size_t e) {
+                for (auto k = b; k < e; ++k)
+                {
+                    const auto head = first + (k * grain);
+                    const auto tail = first + std::min(n, (k + 1) * grain);
+                    const auto out = d_first + (k * grain);
+                    if constexpr (Exclusive)
+                    {
+                        std::transform_exclusive_scan(head, tail, out, std::move(*partials[k]), op, unary);
+                    }
+                    else if (partials[k])
+                    {
+                        std::transform_inclusive_scan(head, tail, out, op, unary, std::move(*partials[k]));
+                    }
+                    else
+                    {
+                        std::transform_inclusive_scan(head, tail, out, op, unary);
+                    }
+                }
+            });
+            return d_first + n;
+        }
+    }
+
+    if constexpr (Exclusive)
+    {
+        return std::transform_exclusive_scan(first, last, d_first, std::move(*init), op, unary);
+    }
+    else if (init)
+    {
+        return std::transform_inclusive_scan(first, last, d_first, op, unary, std::move(*init));
+    }
+    else
+    {
+        return std::transform_inclusive_scan(first, last, d_first, op, unary);
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief inclusive_scan (ThreadPool 版)
+ *
+ * RandomAccessIterator の入出力なら 2 パスのブロック分割で並列に、それ以外は逐次で実行する
+ */
+template <std::forward_iterator It, std::forward_iterator Out, typename BinaryOp, typename T>
+auto inclusive_scan(
+    const execution::PoolPolicy& policy,
+    It                           first,
+    It                           last,
+    Out                          d_first,
+    BinaryOp                     op,
+    T                            init
+) -> Out
+{
+    return detail::TransformScan<false>(
+        policy, first, last, d_first, std::optional<T>(std::move(init)), op, std::identity()
+    );
+}
+
+template <std::forward_iterator It, std::forward_iterator Out, typename BinaryOp>
+auto inclusive_scan(
+    const execution::PoolPolicy& policy,
+    It                           first,
+    It                           last,
+    Out                          d_first,
+    BinaryOp                     op
+) -> Out
+{
+    return detail::TransformScan<false>(
+        policy, first, last, d_first, std::optional<std::iter_value_t<It>>(), op, std::identity()
+    );
+}
+
+template <std::forward_iterator It, std::forward_iterator Out>
+auto inclusive_scan(
+    const execution::PoolPolicy& policy,
+    It                           first,
+    It                           last,
+    Out                          d_first
+) -> Out
+{
+    return cppreference::inclusive_scan(policy, first, last, d_first, std::plus<>());
+}
+
+/**
+ * @brief exclusive_scan (ThreadPool 版)
+ */
+template <std::forward_iterator It, std::forward_iterator Out, typename T, typename BinaryOp>
+auto exclusive_scan(
+    const execution::PoolPolicy& policy,
+    It                           first,
+    It                           last,
+    Out                          d_first,
+    T                            init,
+    BinaryOp                     op
+) -> Out
+{
+    return detail::TransformScan<true>(
+        policy, first, last, d_first, std::optional<T>(std::move(init)), op, std::identity()
+    );
+}
+
+template <std::forward_iterator It, std::forward_iterator Out, typename T>
+auto exclusive_scan(
+    const execution::PoolPolicy& policy,
+    It                           first,
+    It                           last,
+    Out                          d_first,
+    T                            init
+) -> Out
+{
+    return cppreference::exclusive_scan(policy, first, last, d_first, std::move(init), std::plus<>());
+}
+
+/**
+ * @brief transform_inclusive_scan (ThreadPool 版)
+ */
+template <std::forward_iterator It, std::forward_iterator Out, typename BinaryOp, typename UnaryOp, typename T>
+auto transform_inclusive_scan(
+    const execution::PoolPolicy& policy,
+    It                           first,
+    It                           last,
+    Out                          d_first,
+    BinaryOp                     op,
+    UnaryOp                      unary,
+    T                            init
+) -> Out
+{
+    return detail::TransformScan<false>(policy, first, last, d_first, std::optional<T>(std::move(init)), op, unary);
+}
+
+template <std::forward_iterator It, std::forward_iterator Out, typename BinaryOp, typename UnaryOp>
+auto transform_inclusive_scan(
+    const execution::PoolPolicy& policy,
+    It                           first,
+    It                           last,
+    Out                          d_first,
+    BinaryOp                     op,
+    UnaryOp                      unary
+) -> Out
+{
+    using T = std::decay_t<std::invoke_result_t<UnaryOp&, std::iter_reference_t<It>>>;
+    return detail::TransformScan<false>(policy, first, last, d_first, std::optional<T>(), op, unary);
+}
+
+/**
+ * @brief transform_exclusive_scan (ThreadPool 版)
+ */
+template <std::forward_iterator It, std::forward_iterator Out, typename T, typename BinaryOp, typename UnaryOp>
+auto transform_exclusive_scan(
+    const execution::PoolPolicy& policy,
+    It                           first,
+    It                           last,
+    Out                          d_first,
+    T                            init,
+    BinaryOp                     op,
+    UnaryOp                      unary
+) -> Out
+{
+    return detail::TransformScan<true>(policy, first, last, d_first, std::optional<T>(std::move(init)), op, unary);
+}
+
+} // namespace cppreference
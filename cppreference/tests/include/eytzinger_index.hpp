@@ -0,0 +1,165 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace cppreference
+{
+
+namespace detail
+{
+
+// キャッシュライン 1 本に入る要素数。ノード k の 4 段下 (要素が 4 byte のとき) の子孫 k * 16 ... はこの 1 本に並ぶ
+template <typename T>
+inline constexpr std::size_t PREFETCH_STRIDE = std::max<std::size_t>(1, 64 / sizeof(T));
+
+} // namespace detail
+
+/**
+ * @brief ソート済みの列から作る読み取り専用の探索用インデックス (Eytzinger 配置)
+ *
+ * 要素を 2 分探索木の幅優先の順 (ノード k の子が 2k, 2k + 1) に並べ替えて持つ。
+ * 探索で読む位置が配列の先頭に集まるので上の段はキャッシュに残り、さらに数段先の子孫をまとめてプリフェッチする。
+ * 探索は比較結果を添字に足すだけで分岐しない。
+ * 結果は元の列での位置 (std::lower_bound などが返すイテレータの先頭からの距離) で返す。
+ */
+template <std::copyable T, typename Comp = std::ranges::less>
+    requires std::strict_weak_order<Comp&, const T&, const T&>
+class EytzingerIndex
+{
+public:
+    EytzingerIndex() = default;
+
+    /**
+     * @brief sorted は comp の順でソート済みであること
+     */
+    template <std::ranges::input_range R>
+        requires std::convertible_to<std::ranges::range_reference_t<R>, T>
+    explicit EytzingerIndex(
+        R&&  sorted,
+        Comp comp = {}
+    )
+        : comp_(std::move(comp))
+    {
+        auto values = std::vector<T>();
+        for (auto&& x : sorted)
+        {
+            values.push_back(std::forward<decltype(x)>(x));
+        }
+        if (values.empty())
+        {
+            return;
+        }
+
+        // keys_[0] は使わない
+        keys_.assign(values.size() + 1, values.front());
+        rank_.assign(values.size() + 1, 0);
+        std::size_t i = 0;
+        Build(values, i, 1);
+    }
+
+    [[nodiscard]] auto size() const -> std::size_t { return rank_.empty() ? 0 : rank_.size() - 1; }
+
+    [[nodiscard]] auto empty() const -> bool { return size() == 0; }
+
+    /**
+     * @brief 元の列で key 以上の最初の位置 (std::lower_bound)
+     */
+    [[nodiscard]] auto lower_bound(
+        const T& key
+    ) const -> std::size_t
+    {
+        return Search([&](const T& x) { return std::invoke(comp_, x, key); });
+    }
+
+    /**
+     * @brief 元の列で key より大きい最初の位置 (std::upper_bound)
+     */
+    [[nodiscard]] auto upper_bound(
+        const T& key
+    ) const -> std::size_t
+    {
+        return Search([&](const T& x) { return !std::invoke(comp_, key, x); });
+    }
+
+    [[nodiscard]] auto equal_range(
+        const T& key
+    ) const -> std::pair<std::size_t, std::size_t>
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    [[nodiscard]] auto contains(
+        const T& key
+    ) const -> bool
+    {
+        const auto k = Descend([&](const T& x) { return std::invoke(comp_, x, key); });
+        return k != 0 && !std::invoke(comp_, key, keys_[k]);
+    }
+
+private:
+    // 中順になぞると元の列の順になるように埋める
+    void Build(
+        const std::vector<T>& values,
+        std::size_t&          i,
+        std::size_t           k
+    )
+    {
+        if (k >= keys_.size())
+        {
+            return;
+        }
+        Build(values, i, 2 * k);
+        keys_[k] = values[i];
+        rank_[k] = i++;
+        Build(values, i, (2 * k) + 1);
+    }
+
+    /**
+     * @brief go_right(x) が true なら右へ進んで葉まで降り、最後に左へ進んだノードを返す (なければ 0)
+     *
+     * 降りた道は k のビット列そのものなので、末尾の「右へ進んだ」1 の並びと最後の左 (0) を落とせばよい
+     */
+    template <typename GoRight>
+    [[nodiscard]] auto Descend(
+        GoRight go_right
+    ) const -> std::size_t
+    {
+        constexpr auto STRIDE = detail::PREFETCH_STRIDE<T>;
+
+        const auto  n = size();
+        const auto* keys = keys_.data();
+        std::size_t k = 1;
+        while (k <= n)
+        {
+            __builtin_prefetch(keys + std::min(k * STRIDE, n)); // NOLINT
+            k = (2 * k) + static_cast<std::size_t>(go_right(keys[k]));
+        }
+        return k >> (std::countr_one(k) + 1);
+    }
+
+    template <typename GoRight>
+    [[nodiscard]] auto Search(
+        GoRight go_right
+    ) const -> std::size_t
+    {
+        const auto k = Descend(go_right);
+        return (k == 0) ? size() : rank_[k];
+    }
+
+    std::vector<T>           keys_;
+    std::vector<std::size_t> rank_;
+    Comp                     comp_;
+};
+
+template <std::ranges::input_range R, typename Comp = std::ranges::less>
+EytzingerIndex(R&&, Comp = {}) -> EytzingerIndex<std::ranges::range_value_t<R>, Comp>;
+
+} // namespace cppreference
@@ -0,0 +1,1153 @@
+#pragma once
+
+#include "simd_search.hpp"
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace cppreference
+{
+
+namespace detail
+{
+
+/**
+ * @brief 制御バイト: 空 / 削除済み / 使用中 (ハッシュ値の下位 7 bit)
+ *
+ * 空と削除済みは最上位 bit が立っているので、使用中かどうかは符号で判定できる
+ */
+using ctrl_t = std::int8_t;
+
+inline constexpr ctrl_t      CTRL_EMPTY = -128; // 0b1000'0000
+inline constexpr ctrl_t      CTRL_DELETED = -2; // 0b1111'1110
+inline constexpr std::size_t GROUP_WIDTH = 16;
+inline constexpr std::size_t MIN_CAPACITY = GROUP_WIDTH;
+
+[[nodiscard]] inline auto IsFull(
+    ctrl_t c
+) -> bool
+{
+    return c >= 0;
+}
+
+/**
+ * @brief std::hash<int> のような恒等写像でも H1 / H2 に偏りが出ないように 128 bit 積で混ぜる
+ *
+ * 積の下位 64 bit は下位のビットほど h の上位ビットの影響を受けないので、32 bit 回して
+ * よく混ざった中ほどのビットを H1 (>> 7 から上) に持ってくる
+ */
+[[nodiscard]] inline auto MixHash(
+    std::size_t h
+) -> std::size_t
+{
+    constexpr unsigned __int128 K = 0x9E37'79B9'7F4A'7C15ULL;
+    const auto                  m = static_cast<unsigned __int128>(h) * K;
+    return std::rotl(static_cast<std::size_t>(m), 32) ^ static_cast<std::size_t>(m >> 64U); // NOLINT
+}
+
+/**
+ * @brief 連続する 16 個の制御バイトをまとめて比べる
+ *
+ * x86-64 では SSE2 (ベースライン) の 1 回の比較 + movemask、それ以外ではバイトごとのループ。
+ * 結果は i bit 目が i 番目の制御バイトに対応するビットマスク
+ */
+class CtrlGroup
+{
+public:
+    explicit CtrlGroup(
+        const ctrl_t* p
+    )
+    {
+#if CPPREFERENCE_SIMD_X86
+        ctrl_ = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); // NOLINT
+#else
+        std::copy_n(p, GROUP_WIDTH, ctrl_);
+#endif
+    }
+
+    [[nodiscard]] auto Match(
+        ctrl_t h2
+    ) const -> std::uint32_t
+    {
+#if CPPREFERENCE_SIMD_X86
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl_, _mm_set1_epi8(h2))));
+#else
+        return MatchIf([h2](ctrl_t c) { return c == h2; });
+#endif
+    }
+
+    [[nodiscard]] auto MatchEmpty() const -> std::uint32_t { return Match(CTRL_EMPTY); }
+
+    [[nodiscard]] auto MatchEmptyOrDeleted() const -> std::uint32_t
+    {
+#if CPPREFERENCE_SIMD_X86
+        // 空と削除済みだけが -1 より小さい
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), ctrl_)));
+#else
+        return MatchIf([](ctrl_t c) { return !IsFull(c); });
+#endif
+    }
+
+private:
+#if CPPREFERENCE_SIMD_X86
+    __m128i ctrl_;
+#else
+    template <typename Pred>
+    [[nodiscard]] auto MatchIf(
+        Pred pred
+    ) const -> std::uint32_t
+    {
+        std::uint32_t mask = 0;
+        for (std::size_t i = 0; i < GROUP_WIDTH; ++i)
+        {
+            mask |= static_cast<std::uint32_t>(pred(ctrl_[i])) << i;
+        }
+        return mask;
+    }
+
+    ctrl_t ctrl_[GROUP_WIDTH]; // NOLINT
+#endif
+};
+
+/**
+ * @brief 異種キーでの検索 (std::unordered_map の C++20 の規則と同じく、両方が is_transparent を持つとき)
+ */
+template <typename Hash, typename KeyEqual>
+concept Transparent = requires {
+    typename Hash::is_transparent;
+    typename KeyEqual::is_transparent;
+};
+
+struct NoOp
+{
+    void operator()() const {}
+};
+
+template <typename Key>
+struct SetPolicy
+{
+    using key_type = Key;
+    using value_type = Key;
+    using node_value = Key; // extract したときに持つ値
+
+    static auto GetKey(
+        const value_type& v
+    ) -> const key_type&
+    {
+        return v;
+    }
+};
+
+template <typename Key, typename T>
+struct MapPolicy
+{
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<const Key, T>;
+    using node_value = std::pair<Key, T>;
+
+    static auto GetKey(
+        const value_type& v
+    ) -> const key_type&
+    {
+        return v.first;
+    }
+};
+
+/**
+ * @brief extract で取り出した要素を持つ (std::unordered_xxx::node_type 相当。要素はコピーせずムーブで移す)
+ */
+template <typename Policy>
+class FlatNode
+{
+public:
+    using value_type = typename Policy::node_value;
+
+    FlatNode() = default;
+
+    explicit FlatNode(
+        value_type&& v
+    )
+        : value_(std::move(v))
+    {
+    }
+
+    [[nodiscard]] auto empty() const -> bool { return !value_.has_value(); }
+
+    explicit operator bool() const { return value_.has_value(); }
+
+    auto value() const -> value_type&
+        requires std::same_as<Policy, SetPolicy<value_type>>
+    {
+        return *value_;
+    }
+
+    auto key() const -> typename Policy::key_type&
+        requires(!std::same_as<Policy, SetPolicy<value_type>>)
+    {
+        return value_->first;
+    }
+
+    auto mapped() const -> auto&
+        requires(!std::same_as<Policy, SetPolicy<value_type>>)
+    {
+        return value_->second;
+    }
+
+    /**
+     * @brief 中身を取り出して空にする
+     */
+    auto Take() -> value_type
+    {
+        auto v = std::move(*value_);
+        value_.reset();
+        return v;
+    }
+
+private:
+    mutable std::optional<value_type> value_;
+};
+
+/**
+ * @brief オープンアドレス法のハッシュ表 (Swiss table 風)
+ *
+ * 要素とは別に 1 byte の制御バイトの配列を持ち、ハッシュ値の上位 (H1) で探索の開始位置を決め、
+ * 下位 7 bit (H2) を制御バイトに入れておく。探索は 16 個の制御バイトを SIMD で H2 と比べ、
+ * 一致した位置の要素だけキーを比べる。グループ内に空があればそこで打ち切る。
+ * 容量は 2 の冪で、制御バイトの先頭 16 個を末尾に複製しておくので、どの位置からでも 16 個を読める。
+ * 要素は配列に直接置くので、rehash で要素のアドレスは変わる (ポインタ・参照・イテレータは無効になる)。
+ */
+template <typename Policy, typename Hash, typename KeyEqual>
+class FlatHashTable
+{
+public:
+    using key_type = typename Policy::key_type;
+    using value_type = typename Policy::value_type;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using node_type = FlatNode<Policy>;
+
+    template <bool Const>
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename Policy::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+        using reference = std::conditional_t<Const, const value_type&, value_type&>;
+
+        Iterator() = default;
+
+        template <bool C>
+            requires(Const && !C)
+        Iterator( // NOLINT
+            const Iterator<C>& other
+        )
+            : table_(other.table_), i_(other.i_)
+        {
+        }
+
+        auto operator*() const -> reference { return table_->slots_[i_]; }
+
+        auto operator->() const -> pointer { return &table_->slots_[i_]; }
+
+        auto operator++() -> Iterator&
+        {
+            i_ = table_->NextFull(i_ + 1);
+            return *this;
+        }
+
+        auto operator++(int) -> Iterator
+        {
+            auto old = *this;
+            ++*this;
+            return old;
+        }
+
+        friend auto operator==(
+            const Iterator& a,
+            const Iterator& b
+        ) -> bool
+        {
+            return a.i_ == b.i_;
+        }
+
+    private:
+        friend class FlatHashTable;
+        friend class Iterator<!Const>;
+
+        using Table = std::conditional_t<Const, const FlatHashTable, FlatHashTable>;
+
+        Iterator(
+            Table*    table,
+            size_type i
+        )
+            : table_(table), i_(i)
+        {
+        }
+
+        Table*    table_ = nullptr;
+        size_type i_ = 0;
+    };
+
+    // 集合の要素 (キー) は書き換えられないので iterator も const
+    using iterator = std::conditional_t<std::same_as<Policy, SetPolicy<key_type>>, Iterator<true>, Iterator<false>>;
+    using const_iterator = Iterator<true>;
+
+    struct insert_return_type
+    {
+        iterator  position;
+        bool      inserted;
+        node_type node;
+    };
+
+    FlatHashTable() = default;
+
+    explicit FlatHashTable(
+        size_type       bucket_count,
+        const Hash&     hash = Hash(),
+        const KeyEqual& equal = KeyEqual()
+    )
+        : hash_(hash), equal_(equal)
+    {
+        reserve(bucket_count);
+    }
+
+    template <std::input_iterator It>
+    FlatHashTable(
+        It first,
+        It last
+    )
+    {
+        insert(first, last);
+    }
+
+    FlatHashTable(
+        std::initializer_list<value_type> values
+    )
+        : FlatHashTable(values.begin(), values.end())
+    {
+    }
+
+    FlatHashTable(
+        const FlatHashTable& other
+    )
+        : hash_(other.hash_), equal_(other.equal_)
+    {
+        reserve(other.size());
+        insert(other.begin(), other.end());
+    }
+
+    FlatHashTable(
+        FlatHashTable&& other
+    ) noexcept
+        : hash_(std::move(other.hash_)), equal_(std::move(other.equal_))
+    {
+        Adopt(other);
+    }
+
+    auto operator=(
+        const FlatHashTable& other
+    ) -> FlatHashTable&
+    {
+        if (this != &other)
+        {
+            auto copy = other;
+            swap(copy);
+        }
+        return *this;
+    }
+
+    auto operator=(
+        FlatHashTable&& other
+    ) noexcept -> FlatHashTable&
+    {
+        if (this != &other)
+        {
+            Release();
+            hash_ = std::move(other.hash_);
+            equal_ = std::move(other.equal_);
+            Adopt(other);
+        }
+        return *this;
+    }
+
+    ~FlatHashTable() { Release(); }
+
+    [[nodiscard]] auto begin() -> iterator { return {this, NextFull(0)}; }
+
+    [[nodiscard]] auto begin() const -> const_iterator { return {this, NextFull(0)}; }
+
+    [[nodiscard]] auto end() -> iterator { return {this, capacity_}; }
+
+    [[nodiscard]] auto end() const -> const_iterator { return {this, capacity_}; }
+
+    [[nodiscard]] auto empty() const -> bool { return size_ == 0; }
+
+    [[nodiscard]] auto size() const -> size_type { return size_; }
+
+    /**
+     * @brief スロット数 (2 の冪、または 0)
+     */
+    [[nodiscard]] auto bucket_count() const -> size_type { return capacity_; }
+
+    [[nodiscard]] auto load_factor() const -> float
+    {
+        return capacity_ == 0 ? 0.0F : static_cast<float>(size_) / static_cast<float>(capacity_);
+    }
+
+    /**
+     * @brief 最大負荷率は 7/8 固定
+     */
+    [[nodiscard]] auto max_load_factor() const -> float { return 0.875F; } // NOLINT
+
+    [[nodiscard]] auto hash_function() const -> hasher { return hash_; }
+
+    /**
+     * @brief 要素を置いた配列を作り直した回数 (診断用)
+     */
+    [[nodiscard]] auto rehash_count() const -> size_type { return rehash_count_; }
+
+    /**
+     * @brief key の探索で制御バイトのグループをいくつ調べるか (診断用。ないキーは空のあるグループまで)
+     */
+    [[nodiscard]] auto probe_length(
+        const key_type& key
+    ) const -> size_type
+    {
+        size_type groups = 0;
+        Find(key, HashOf(key), [&groups]() { ++groups; });
+        return groups;
+    }
+
+    /**
+     * @brief key の探索を始めるスロット (診断用。std::unordered_xxx::bucket に相当し、ないキーでも良い)
+     */
+    [[nodiscard]] auto bucket(
+        const key_type& key
+    ) const -> size_type
+    {
+        return capacity_ == 0 ? 0 : Start(HashOf(key));
+    }
+
+    [[nodiscard]] auto key_eq() const -> key_equal { return equal_; }
+
+    void clear()
+    {
+        Release();
+        capacity_ = 0;
+        size_ = 0;
+        growth_left_ = 0;
+    }
+
+    /**
+     * @brief n 要素まで rehash せずに入るようにする
+     */
+    void reserve(
+        size_type n
+    )
+    {
+        if (n > size_ + growth_left_)
+        {
+            Resize(CapacityFor(n));
+        }
+    }
+
+    template <typename... Args>
+    auto emplace(
+        Args&&... args
+    ) -> std::pair<iterator, bool>
+    {
+        // キーを取り出すために先に構築する (insert(value) はキーで先に探すので構築しない)
+        auto v = value_type(std::forward<Args>(args)...);
+        return Insert(Policy::GetKey(v), std::move(v));
+    }
+
+    auto insert(
+        const value_type& value
+    ) -> std::pair<iterator, bool>
+    {
+        return Insert(Policy::GetKey(value), value);
+    }
+
+    auto insert(
+        value_type&& value
+    ) -> std::pair<iterator, bool>
+    {
+        return Insert(Policy::GetKey(value), std::move(value));
+    }
+
+    template <std::input_iterator It>
+    void insert(
+        It first,
+        It last
+    )
+    {
+        if constexpr (std::forward_iterator<It>)
+        {
+            reserve(size_ + static_cast<size_type>(std::distance(first, last)));
+        }
+        for (; first != last; ++first)
+        {
+            insert(*first);
+        }
+    }
+
+    void insert(
+        std::initializer_list<value_type> values
+    )
+    {
+        insert(values.begin(), values.end());
+    }
+
+    auto insert(
+        node_type&& node
+    ) -> insert_return_type
+    {
+        if (node.empty())
+        {
+            return {end(), false, node_type()};
+        }
+        const auto i = Find(NodeKey(node));
+        if (i != capacity_)
+        {
+            return {{this, i}, false, std::move(node)};
+        }
+        auto [it, inserted] = emplace(node.Take());
+        return {it, inserted, node_type()};
+    }
+
+    [[nodiscard]] auto find(
+        const key_type& key
+    ) -> iterator
+    {
+        return {this, Find(key)};
+    }
+
+    [[nodiscard]] auto find(
+        const key_type& key
+    ) const -> const_iterator
+    {
+        return {this, Find(key)};
+    }
+
+    [[nodiscard]] auto contains(
+        const key_type& key
+    ) const -> bool
+    {
+        return Find(key) != capacity_;
+    }
+
+    [[nodiscard]] auto count(
+        const key_type& key
+    ) const -> size_type
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    /**
+     * @brief Hash と KeyEqual が is_transparent を持てば key_type を作らずに K で探す (例: string_view)
+     */
+    template <typename K>
+        requires Transparent<Hash, KeyEqual>
+    [[nodiscard]] auto find(
+        const K& key
+    ) -> iterator
+    {
+        return {this, Find(key)};
+    }
+
+    template <typename K>
+        requires Transparent<Hash, KeyEqual>
+    [[nodiscard]] auto find(
+        const K& key
+    ) const -> const_iterator
+    {
+        return {this, Find(key)};
+    }
+
+    template <typename K>
+        requires Transparent<Hash, KeyEqual>
+    [[nodiscard]] auto contains(
+        const K& key
+    ) const -> bool
+    {
+        return Find(key) != capacity_;
+    }
+
+    template <typename K>
+        requires Transparent<Hash, KeyEqual>
+    [[nodiscard]] auto count(
+        const K& key
+    ) const -> size_type
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    auto erase(
+        const_iterator pos
+    ) -> iterator
+    {
+        EraseAt(pos.i_);
+        return {this, NextFull(pos.i_ + 1)};
+    }
+
+    auto erase(
+        iterator pos
+    ) -> iterator
+        requires(!std::same_as<iterator, const_iterator>)
+    {
+        return erase(const_iterator(pos));
+    }
+
+    auto erase(
+        const key_type& key
+    ) -> size_type
+    {
+        const auto i = Find(key);
+        if (i == capacity_)
+        {
+            return 0;
+        }
+        EraseAt(i);
+        return 1;
+    }
+
+    auto extract(
+        const_iterator pos
+    ) -> node_type
+    {
+        auto node = node_type(typename Policy::node_value(std::move(slots_[pos.i_])));
+        EraseAt(pos.i_);
+        return node;
+    }
+
+    auto extract(
+        const key_type& key
+    ) -> node_type
+    {
+        const auto i = Find(key);
+        return i == capacity_ ? node_type() : extract(const_iterator(this, i));
+    }
+
+    /**
+     * @brief source にあってこちらにないキーの要素をムーブで移す (移した要素は source から消える)
+     */
+    template <typename H, typename E>
+    void merge(
+        FlatHashTable<Policy, H, E>& source
+    )
+    {
+        for (auto it = source.begin(); it != source.end();)
+        {
+            if (contains(Policy::GetKey(*it)))
+            {
+                ++it;
+            }
+            else
+            {
+                insert(source.extract(it++));
+            }
+        }
+    }
+
+    template <typename H, typename E>
+    void merge(
+        FlatHashTable<Policy, H, E>&& source
+    )
+    {
+        merge(source);
+    }
+
+    void swap(
+        FlatHashTable& other
+    ) noexcept
+    {
+        using std::swap;
+        swap(ctrl_, other.ctrl_);
+        swap(slots_, other.slots_);
+        swap(capacity_, other.capacity_);
+        swap(size_, other.size_);
+        swap(growth_left_, other.growth_left_);
+        swap(rehash_count_, other.rehash_count_);
+        swap(hash_, other.hash_);
+        swap(equal_, other.equal_);
+    }
+
+    friend auto operator==(
+        const FlatHashTable& a,
+        const FlatHashTable& b
+    ) -> bool
+    {
+        if (a.size() != b.size())
+        {
+            return false;
+        }
+        return std::ranges::all_of(a, [&](const value_type& v) {
+            const auto it = b.find(Policy::GetKey(v));
+            return it != b.end() && *it == v;
+        });
+    }
+
+protected:
+    /**
+     * @brief key を探し、なければ make() で作った値を入れる
+     */
+    template <typename K, typename Make>
+    auto FindOrInsert(
+        const K& key,
+        Make&&   make
+    ) -> std::pair<iterator, bool>
+    {
+        const auto h = HashOf(key);
+        const auto i = Find(key, h);
+        if (i != capacity_)
+        {
+            return {{this, i}, false};
+        }
+        const auto j = PrepareInsert(h);
+        std::construct_at(slots_ + j, make());
+        growth_left_ -= static_cast<size_type>(ctrl_[j] == CTRL_EMPTY);
+        SetCtrl(j, H2(h));
+        ++size_;
+        return {{this, j}, true};
+    }
+
+private:
+    template <typename P, typename H, typename E>
+    friend class FlatHashTable;
+
+    using Alloc = std::allocator<value_type>;
+
+    static auto NodeKey(
+        const node_type& node
+    ) -> const key_type&
+    {
+        if constexpr (std::same_as<Policy, SetPolicy<key_type>>)
+        {
+            return node.value();
+        }
+        else
+        {
+            return node.key();
+        }
+    }
+
+    template <typename K>
+    auto HashOf(
+        const K& key
+    ) const -> std::size_t
+    {
+        return MixHash(std::invoke(hash_, key));
+    }
+
+    static auto H1(
+        std::size_t h
+    ) -> std::size_t
+    {
+        return h >> 7U; // NOLINT
+    }
+
+    static auto H2(
+        std::size_t h
+    ) -> ctrl_t
+    {
+        return static_cast<ctrl_t>(h & 0x7FU); // NOLINT
+    }
+
+    /**
+     * @brief 要素数 n を負荷率 7/8 以下で収める容量
+     */
+    static auto CapacityFor(
+        size_type n
+    ) -> size_type
+    {
+        return std::max(MIN_CAPACITY, std::bit_ceil(n + ((n + 6) / 7))); // NOLINT
+    }
+
+    static auto GrowthFor(
+        size_type capacity
+    ) -> size_type
+    {
+        return capacity - (capacity / 8); // NOLINT
+    }
+
+    // 位置 i の制御バイトを書き、先頭 16 個なら末尾の複製も書く
+    void SetCtrl(
+        size_type i,
+        ctrl_t    c
+    )
+    {
+        ctrl_[i] = c;
+        if (i < GROUP_WIDTH)
+        {
+            ctrl_[capacity_ + i] = c;
+        }
+    }
+
+    auto Start(
+        std::size_t h
+    ) const -> size_type
+    {
+        return H1(h) & (capacity_ - 1);
+    }
+
+    /**
+     * @brief 探索列: 16 個ずつのグループを三角数の間隔で飛ぶ (容量が 2 の冪なので全グループを一巡する)
+     */
+    template <typename Fn>
+    auto Probe(
+        std::size_t h,
+        Fn&&        fn
+    ) const -> size_type
+    {
+        const auto mask = capacity_ - 1;
+        auto       pos = Start(h);
+        for (size_type step = GROUP_WIDTH;; step += GROUP_WIDTH)
+        {
+            if (const auto found = fn(pos, CtrlGroup(ctrl_ + pos)))
+            {
+                return *found;
+            }
+            pos = (pos + step) & mask;
+        }
+    }
+
+    template <typename K>
+    auto Find(
+        const K& key
+    ) const -> size_type
+    {
+        return capacity_ == 0 ? capacity_ : Find(key, HashOf(key));
+    }
+
+    /**
+     * @brief key の位置 (なければ capacity_)。グループを 1 つ調べるごとに on_group() を呼ぶ
+     */
+    template <typename K, typename OnGroup = NoOp>
+    auto Find(
+        const K&    key,
+        std::size_t h,
+        OnGroup     on_group = {}
+    ) const -> size_type
+    {
+        if (capacity_ == 0)
+        {
+            return capacity_;
+        }
+        const auto mask = capacity_ - 1;
+        const auto h2 = H2(h);
+        return Probe(h, [&](size_type pos, const CtrlGroup& g) -> std::optional<size_type> {
+            on_group();
+            for (auto m = g.Match(h2); m != 0; m &= m - 1)
+            {
+                const auto i = (pos + static_cast<size_type>(std::countr_zero(m))) & mask;
+                if (std::invoke(equal_, Policy::GetKey(slots_[i]), key))
+                {
+                    return i;
+                }
+            }
+            if (g.MatchEmpty() != 0)
+            {
+                return capacity_;
+            }
+            return std::nullopt;
+        });
+    }
+
+    // h の探索列で最初の空き (空または削除済み)
+    auto FindFree(
+        std::size_t h
+    ) const -> size_type
+    {
+        const auto mask = capacity_ - 1;
+        return Probe(h, [&](size_type pos, const CtrlGroup& g) -> std::optional<size_type> {
+            if (const auto m = g.MatchEmptyOrDeleted(); m != 0)
+            {
+                return (pos + static_cast<size_type>(std::countr_zero(m))) & mask;
+            }
+            return std::nullopt;
+        });
+    }
+
+    /**
+     * @brief ハッシュ値 h の要素を置く位置を確保する
+     *
+     * 空きを使い切ったら、削除済みが半分以上なら同じ容量で、そうでなければ 2 倍の容量で作り直す。
+     * 要素の構築と制御バイトの書き込みは呼び出し側で、構築が例外を投げても表が壊れないよう構築後に行う
+     */
+    auto PrepareInsert(
+        std::size_t h
+    ) -> size_type
+    {
+        auto i = capacity_ == 0 ? 0 : FindFree(h);
+        if (capacity_ == 0 || (growth_left_ == 0 && ctrl_[i] == CTRL_EMPTY))
+        {
+            Resize(capacity_ == 0 ? MIN_CAPACITY : (size_ * 2 <= GrowthFor(capacity_) ? capacity_ : capacity_ * 2));
+            i = FindFree(h);
+        }
+        return i;
+    }
+
+    template <typename V>
+    auto Insert(
+        const key_type& key,
+        V&&             value
+    ) -> std::pair<iterator, bool>
+    {
+        return FindOrInsert(key, [&]() -> V&& { return std::forward<V>(value); });
+    }
+
+    /**
+     * @brief 前後に空があり、その間の使用中・削除済みの並びが 16 個未満なら、
+     *        この位置を通り越して探索した要素はないので空に戻せる (削除済みの目印を残さない)
+     */
+    void EraseAt(
+        size_type i
+    )
+    {
+        std::destroy_at(slots_ + i);
+        --size_;
+
+        const auto before = CtrlGroup(ctrl_ + ((i - GROUP_WIDTH) & (capacity_ - 1))).MatchEmpty();
+        const auto after = CtrlGroup(ctrl_ + i).MatchEmpty();
+        const auto gap = std::countr_zero(after) + std::countl_zero(static_cast<std::uint16_t>(before));
+        if (before != 0 && after != 0 && static_cast<size_type>(gap) < GROUP_WIDTH)
+        {
+            SetCtrl(i, CTRL_EMPTY);
+            ++growth_left_;
+        }
+        else
+        {
+            SetCtrl(i, CTRL_DELETED);
+        }
+    }
+
+    // i 以降で最初の使用中の位置 (なければ capacity_)
+    auto NextFull(
+        size_type i
+    ) const -> size_type
+    {
+        while (i < capacity_ && !IsFull(ctrl_[i]))
+        {
+            ++i;
+        }
+        return i;
+    }
+
+    void Resize(
+        size_type capacity
+    )
+    {
+        auto*      old_ctrl = ctrl_;
+        auto*      old_slots = slots_;
+        const auto old_capacity = capacity_;
+
+        // 両方の確保に成功してから差し替える (途中で投げても元の表はそのまま)
+        auto alloc = Alloc();
+        const auto ctrl_size = capacity + GROUP_WIDTH;
+        auto       ctrl = std::make_unique_for_overwrite<ctrl_t[]>(ctrl_size); // 0 で埋めずに EMPTY で 1 度だけ書く
+        std::fill_n(ctrl.get(), ctrl_size, CTRL_EMPTY);
+        auto* slots = std::allocator_traits<Alloc>::allocate(alloc, capacity);
+        ctrl_ = ctrl.release();
+        slots_ = slots;
+        capacity_ = capacity;
+        growth_left_ = GrowthFor(capacity) - size_;
+        rehash_count_ += static_cast<size_type>(old_capacity != 0);
+
+        for (size_type i = 0; i < old_capacity; ++i)
+        {
+            if (IsFull(old_ctrl[i]))
+            {
+                const auto h = HashOf(Policy::GetKey(old_slots[i]));
+                const auto j = FindFree(h);
+                SetCtrl(j, H2(h));
+                std::construct_at(slots_ + j, std::move(old_slots[i]));
+                std::destroy_at(old_slots + i);
+            }
+        }
+        if (old_ctrl != nullptr)
+        {
+            std::allocator_traits<Alloc>::deallocate(alloc, old_slots, old_capacity);
+            delete[] old_ctrl;
+        }
+    }
+
+    void Release()
+    {
+        if (ctrl_ == nullptr)
+        {
+            return;
+        }
+        for (size_type i = 0; i < capacity_; ++i)
+        {
+            if (IsFull(ctrl_[i]))
+            {
+                std::destroy_at(slots_ + i);
+            }
+        }
+        auto alloc = Alloc();
+        std::allocator_traits<Alloc>::deallocate(alloc, slots_, capacity_);
+        delete[] ctrl_;
+        ctrl_ = nullptr;
+        slots_ = nullptr;
+    }
+
+    void Adopt(
+        FlatHashTable& other
+    )
+    {
+        ctrl_ = std::exchange(other.ctrl_, nullptr);
+        slots_ = std::exchange(other.slots_, nullptr);
+        capacity_ = std::exchange(other.capacity_, 0);
+        size_ = std::exchange(other.size_, 0);
+        growth_left_ = std::exchange(other.growth_left_, 0);
+        rehash_count_ = std::exchange(other.rehash_count_, 0);
+    }
+
+    ctrl_t*     ctrl_ = nullptr;  // capacity_ + 16 個 (末尾 16 個は先頭の複製)
+    value_type* slots_ = nullptr; // capacity_ 個
+    size_type   capacity_ = 0;
+    size_type   size_ = 0;
+    size_type   growth_left_ = 0; // rehash せずに空から使用中にできる残り数
+    size_type   rehash_count_ = 0;
+    Hash        hash_;
+    KeyEqual    equal_;
+};
+
+} // namespace detail
+
+/**
+ * @brief std::unordered_set と同じインターフェイスのオープンアドレス法のハッシュ集合
+ *
+ * ノードを確保しないので、キャッシュミスは制御バイトと要素の 2 か所程度で済む。
+ * 要素のアドレスは rehash で変わる (std::unordered_set と違いポインタの安定性はない)
+ */
+template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class FlatHashSet : public detail::FlatHashTable<detail::SetPolicy<Key>, Hash, KeyEqual>
+{
+    using Base = detail::FlatHashTable<detail::SetPolicy<Key>, Hash, KeyEqual>;
+
+public:
+    using Base::Base;
+};
+
+/**
+ * @brief std::unordered_map と同じインターフェイスのオープンアドレス法のハッシュ表
+ *
+ * 要素は std::pair<const Key, T> で、rehash のときキーはコピーされる。
+ * 要素のアドレスは rehash で変わる (std::unordered_map と違いポインタの安定性はない)
+ */
+template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class FlatHashMap : public detail::FlatHashTable<detail::MapPolicy<Key, T>, Hash, KeyEqual>
+{
+    using Base = detail::FlatHashTable<detail::MapPolicy<Key, T>, Hash, KeyEqual>;
+
+public:
+    using mapped_type = T;
+    using typename Base::iterator;
+    using typename Base::size_type;
+
+    using Base::Base;
+
+    /**
+     * @brief key がなければ T(args...) を入れる (あれば args は使わない)
+     */
+    template <typename... Args>
+    auto try_emplace(
+        const Key& key,
+        Args&&... args
+    ) -> std::pair<iterator, bool>
+    {
+        return this->FindOrInsert(key, [&]() {
+            return std::pair<const Key, T>(
+                std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...)
+            );
+        });
+    }
+
+    template <typename... Args>
+    auto try_emplace(
+        Key&& key,
+        Args&&... args
+    ) -> std::pair<iterator, bool>
+    {
+        return this->FindOrInsert(key, [&]() {
+            return std::pair<const Key, T>(
+                std::piecewise_construct,
+                std::forward_as_tuple(std::move(key)),
+                std::forward_as_tuple(std::forward<Args>(args)...)
+            );
+        });
+    }
+
+    template <typename M>
+    auto insert_or_assign(
+        const Key& key,
+        M&&        obj
+    ) -> std::pair<iterator, bool>
+    {
+        auto result = try_emplace(key, std::forward<M>(obj));
+        if (!result.second)
+        {
+            result.first->second = std::forward<M>(obj);
+        }
+        return result;
+    }
+
+    auto operator[](
+        const Key& key
+    ) -> T&
+    {
+        return try_emplace(key).first->second;
+    }
+
+    auto operator[](
+        Key&& key
+    ) -> T&
+    {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    auto at(
+        const Key& key
+    ) -> T&
+    {
+        const auto it = this->find(key);
+        if (it == this->end())
+        {
+            throw std::out_of_range("FlatHashMap::at");
+        }
+        return it->second;
+    }
+
+    auto at(
+        const Key& key
+    ) const -> const T&
+    {
+        const auto it = this->find(key);
+        if (it == this->end())
+        {
+            throw std::out_of_range("FlatHashMap::at");
+        }
+        return it->second;
+    }
+};
+
+} // namespace cppreference
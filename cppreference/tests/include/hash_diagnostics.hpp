@@ -0,0 +1,242 @@
+#pragma once
+
+#include "flat_hash.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ostream>
+#include <vector>
+
+namespace cppreference
+{
+
+/**
+ * @brief ハッシュ表の偏りの統計
+ *
+ * プローブ長は要素を見つけるまでに調べる量で、チェイン法 (std::unordered_xxx) ではキーの比較回数
+ * (チェインの何番目か)、FlatHashSet / FlatHashMap では調べた制御バイトのグループ数。
+ * histogram[k] はプローブ長が k の要素数、occupancy[k] は要素が k 個あるバケツの数
+ * (FlatHashXxx では k 個の要素が探索を始める位置の数)。
+ */
+struct HashStats
+{
+    std::size_t              size = 0;
+    std::size_t              bucket_count = 0;
+    float                    load_factor = 0;
+    std::size_t              distinct_hashes = 0; // 要素のハッシュ値の種類数
+    std::size_t              used_buckets = 0;    // 要素が 1 つ以上あるバケツ (FlatHashXxx では探索の開始グループ)
+    std::size_t              max_probe = 0;
+    double                   mean_probe = 0;
+    std::vector<std::size_t> histogram;
+    std::vector<std::size_t> occupancy;
+    std::size_t              rehash_count = 0;
+
+    /**
+     * @brief 一様なハッシュではまず起きない偏りか
+     *
+     * - ハッシュ値の種類が要素数の半分未満 (std::hash<Scp> のような定数ハッシュ)
+     * - 使っているバケツが一様な場合の期待値 b (1 - e^{-n/b}) の半分未満 (値は違うが同じバケツに落ちる)
+     * - 最大プローブ長が MAX_PROBE を超える、または平均が MAX_MEAN_PROBE を超える
+     */
+    [[nodiscard]] auto pathological() const -> bool;
+
+    static constexpr std::size_t MAX_PROBE = 16;
+    static constexpr double      MAX_MEAN_PROBE = 3.0;
+};
+
+namespace detail
+{
+
+inline void Finish(
+    HashStats&                stats,
+    std::vector<std::size_t>& hashes,
+    const std::size_t         probe_sum
+)
+{
+    std::ranges::sort(hashes);
+    const auto duplicates = std::ranges::unique(hashes);
+    stats.distinct_hashes = static_cast<std::size_t>(std::distance(hashes.begin(), duplicates.begin()));
+    stats.max_probe = stats.histogram.empty() ? 0 : stats.histogram.size() - 1;
+    stats.mean_probe = stats.size == 0 ? 0 : static_cast<double>(probe_sum) / static_cast<double>(stats.size);
+}
+
+} // namespace detail
+
+inline auto HashStats::pathological() const -> bool
+{
+    if (size == 0)
+    {
+        return false;
+    }
+    const auto n = static_cast<double>(size);
+    const auto b = static_cast<double>(bucket_count);
+    const auto expected_used = b * -std::expm1(-n / b);
+    return distinct_hashes * 2 < size || static_cast<double>(used_buckets) * 2 < expected_used ||
+           max_probe > MAX_PROBE || mean_probe > MAX_MEAN_PROBE;
+}
+
+/**
+ * @brief チェイン法のハッシュ表 (bucket インターフェイスを持つ std::unordered_xxx) の統計
+ *
+ * 標準のコンテナは rehash の回数を持たないので rehash_count は 0 (RehashWatcher で数える)
+ */
+template <typename C>
+    requires requires(const C& c) { c.bucket_size(0); }
+auto AnalyzeHash(
+    const C& c
+) -> HashStats
+{
+    auto stats = HashStats{.size = c.size(), .bucket_count = c.bucket_count(), .load_factor = c.load_factor()};
+
+    auto        hashes = std::vector<std::size_t>();
+    std::size_t probe_sum = 0;
+    hashes.reserve(c.size());
+    for (std::size_t b = 0; b < c.bucket_count(); ++b)
+    {
+        const auto chain = c.bucket_size(b);
+        stats.used_buckets += static_cast<std::size_t>(chain != 0);
+        if (stats.histogram.size() <= chain)
+        {
+            stats.histogram.resize(chain + 1);
+            stats.occupancy.resize(chain + 1);
+        }
+        ++stats.occupancy[chain];
+        // チェインの k 番目の要素はキーを k 回比べて見つかる
+        for (std::size_t k = 1; k <= chain; ++k)
+        {
+            ++stats.histogram[k];
+            probe_sum += k;
+        }
+        for (auto it = c.begin(b); it != c.end(b); ++it)
+        {
+            if constexpr (requires { typename C::mapped_type; })
+            {
+                hashes.push_back(std::invoke(c.hash_function(), it->first));
+            }
+            else
+            {
+                hashes.push_back(std::invoke(c.hash_function(), *it));
+            }
+        }
+    }
+    detail::Finish(stats, hashes, probe_sum);
+    return stats;
+}
+
+/**
+ * @brief FlatHashSet / FlatHashMap の統計
+ */
+template <typename Policy, typename Hash, typename KeyEqual>
+auto AnalyzeHash(
+    const detail::FlatHashTable<Policy, Hash, KeyEqual>& c
+) -> HashStats
+{
+    auto stats = HashStats{
+        .size = c.size(),
+        .bucket_count = c.bucket_count(),
+        .load_factor = c.load_factor(),
+        .rehash_count = c.rehash_count(),
+    };
+
+    auto        hashes = std::vector<std::size_t>();
+    auto        starts = std::vector<std::size_t>();
+    std::size_t probe_sum = 0;
+    hashes.reserve(c.size());
+    for (const auto& v : c)
+    {
+        const auto& key = Policy::GetKey(v);
+        const auto  h = std::invoke(c.hash_function(), key);
+        hashes.push_back(h);
+        starts.push_back(c.bucket(key));
+
+        const auto probe = c.probe_length(key);
+        if (stats.histogram.size() <= probe)
+        {
+            stats.histogram.resize(probe + 1);
+        }
+        ++stats.histogram[probe];
+        probe_sum += probe;
+    }
+    std::ranges::sort(starts);
+    stats.occupancy.push_back(c.bucket_count());
+    for (auto it = starts.begin(); it != starts.end();)
+    {
+        const auto next = std::ranges::upper_bound(it, starts.end(), *it);
+        const auto n = static_cast<std::size_t>(std::distance(it, next));
+        if (stats.occupancy.size() <= n)
+        {
+            stats.occupancy.resize(n + 1);
+        }
+        --stats.occupancy[0];
+        ++stats.occupancy[n];
+        ++stats.used_buckets;
+        it = next;
+    }
+    detail::Finish(stats, hashes, probe_sum);
+    return stats;
+}
+
+/**
+ * @brief 操作のたびに Observe() を呼んで、bucket_count の変化から rehash の回数を数える
+ */
+template <typename C>
+class RehashWatcher
+{
+public:
+    explicit RehashWatcher(
+        const C& c
+    )
+        : c_(c), last_(c.bucket_count())
+    {
+    }
+
+    void Observe()
+    {
+        if (c_.bucket_count() != last_)
+        {
+            ++count_;
+            last_ = c_.bucket_count();
+        }
+    }
+
+    [[nodiscard]] auto count() const -> std::size_t { return count_; }
+
+    /**
+     * @brief AnalyzeHash に数えた rehash の回数を入れたもの
+     */
+    [[nodiscard]] auto Analyze() const -> HashStats
+    {
+        auto stats = AnalyzeHash(c_);
+        stats.rehash_count = count_;
+        return stats;
+    }
+
+private:
+    const C&    c_;
+    std::size_t last_;
+    std::size_t count_ = 0;
+};
+
+inline auto operator<<(
+    std::ostream&    os,
+    const HashStats& s
+) -> std::ostream&
+{
+    os << "size=" << s.size << " buckets=" << s.bucket_count << " load=" << s.load_factor
+       << " distinct_hashes=" << s.distinct_hashes << " used_buckets=" << s.used_buckets << " max_probe=" << s.max_probe
+       << " mean_probe=" << s.mean_probe << " rehash=" << s.rehash_count << " histogram=[";
+    for (std::size_t k = 1; k < s.histogram.size(); ++k)
+    {
+        os << (k == 1 ? "" : " ") << k << ':' << s.histogram[k];
+    }
+    os << "] occupancy=[";
+    for (std::size_t k = 0; k < s.occupancy.size(); ++k)
+    {
+        os << (k == 0 ? "" : " ") << k << ':' << s.occupancy[k];
+    }
+    return os << ']' << (s.pathological() ? " PATHOLOGICAL" : "");
+}
+
+} // namespace cppreference
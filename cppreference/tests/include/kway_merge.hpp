@@ -0,0 +1,513 @@
+#pragma once
+
+#include "execution.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cppreference
+{
+
+/**
+ * @brief kway_merge の入力: ソート済みの列の列
+ *
+ * 各列のイテレータを保持したまま走査するので、列は左辺値か borrowed_range である必要がある
+ */
+template <typename Runs>
+concept SortedRuns = std::ranges::forward_range<Runs> &&
+                     std::ranges::forward_range<std::ranges::range_reference_t<Runs>> &&
+                     (std::is_lvalue_reference_v<std::ranges::range_reference_t<Runs>> ||
+                      std::ranges::borrowed_range<std::ranges::range_reference_t<Runs>>);
+
+namespace detail
+{
+
+/**
+ * @brief 尽きた列に番兵の値を置ける要素 (< で比べる算術型。番兵はどの値よりも前に出ない値)
+ */
+template <typename V, typename Comp>
+concept HasMergeSentinel =
+    std::is_arithmetic_v<V> &&
+    (std::same_as<Comp, std::ranges::less> || std::same_as<Comp, std::less<>> || std::same_as<Comp, std::less<V>>);
+
+template <typename V>
+constexpr auto MergeSentinel() -> V
+{
+    if constexpr (std::numeric_limits<V>::has_infinity)
+    {
+        return std::numeric_limits<V>::infinity();
+    }
+    else
+    {
+        return std::numeric_limits<V>::max();
+    }
+}
+
+/**
+ * @brief 敗者木 (トーナメント木)
+ *
+ * tree_[1..k) の内部ノードに対戦の敗者の列の番号を、tree_[0] に優勝者 (次に出力する列) を持つ。
+ * 列 i の葉はノード k + i とみなす。優勝者を 1 つ進めたら葉から根まで敗者と対戦し直すだけなので、
+ * 1 要素あたりの比較は log2(k) 回で済む。
+ * 列の先頭の値は keys_ に複製して、対戦のたびに列のイテレータをたどらないようにする。
+ * 対戦は (値, 列の番号) の辞書式順なので安定 (同じ値は番号の小さい列が先)。
+ * 空の列は最初から除くので、葉の数 k は空でない列の数。
+ */
+template <std::forward_iterator It, std::sentinel_for<It> S, typename Comp>
+class LoserTree
+{
+public:
+    LoserTree(
+        const std::vector<std::pair<It, S>>& runs,
+        Comp&                                comp
+    )
+        : comp_(comp)
+    {
+        for (const auto& r : runs)
+        {
+            if (r.first != r.second)
+            {
+                runs_.push_back(r);
+            }
+        }
+        if (runs_.size() <= 2)
+        {
+            return;
+        }
+
+        const auto k = runs_.size();
+        keys_.reserve(k);
+        for (const auto& r : runs_)
+        {
+            keys_.push_back(*r.first);
+        }
+        tree_.resize(k);
+        tree_[0] = Build(1);
+    }
+
+    template <typename Out>
+    auto Merge(
+        Out out
+    ) -> Out
+    {
+        // 2 本以下なら std::ranges::merge と同じ (同じ値は 1 本目が先)
+        switch (runs_.size())
+        {
+        case 0:
+            return out;
+        case 1:
+            return std::ranges::copy(runs_[0].first, runs_[0].second, std::move(out)).out;
+        case 2:
+            return std::ranges::merge(
+                       runs_[0].first, runs_[0].second, runs_[1].first, runs_[1].second, std::move(out), comp_
+            )
+                .out;
+        default:
+            break;
+        }
+
+        if constexpr (HasMergeSentinel<V, Comp>)
+        {
+            return MergeWithSentinel(std::move(out));
+        }
+        else
+        {
+            return MergeWithFlags(std::move(out));
+        }
+    }
+
+private:
+    using V = std::iter_value_t<It>;
+
+    /**
+     * @brief 尽きた列の値を番兵にして、1 回の対戦を値の比較だけにする
+     *
+     * 対戦の勝敗は予測できないので、分岐せずにマスクで勝者を選ぶ。勝者の値はレジスタに持ち続ける。
+     * 番兵と同じ値の要素が残っていると、尽きた列が同点で勝つことがある。そのときは番兵と同じ値しか
+     * 残っていないので、残りを列の順に写して終える。
+     */
+    template <typename Out>
+    auto MergeWithSentinel(
+        Out out
+    ) -> Out
+    {
+        const auto k = runs_.size();
+        auto       w = tree_[0];
+        auto       key = keys_[w];
+        while (key != MergeSentinel<V>() || runs_[w].first != runs_[w].second)
+        {
+            *out = key;
+            ++out;
+
+            auto& run = runs_[w];
+            key = (++run.first == run.second) ? MergeSentinel<V>() : *run.first;
+            keys_[w] = key;
+
+            for (auto node = (w + k) / 2; node > 0; node /= 2)
+            {
+                const auto other = tree_[node];
+                const auto other_key = keys_[other];
+                const bool beats = (other_key < key) | ((other_key == key) & (other < w));
+                const auto swap = (other ^ w) & (std::size_t{0} - beats);
+                tree_[node] = other ^ swap;
+                w ^= swap;
+                key = beats ? other_key : key;
+            }
+        }
+        for (auto& run : runs_)
+        {
+            out = std::ranges::copy(run.first, run.second, std::move(out)).out;
+        }
+        return out;
+    }
+
+    /**
+     * @brief 番兵を置けない要素: 尽きた列かどうかを対戦のたびに確かめる
+     */
+    template <typename Out>
+    auto MergeWithFlags(
+        Out out
+    ) -> Out
+    {
+        const auto k = runs_.size();
+        for (auto w = tree_[0]; !Exhausted(w);)
+        {
+            *out = std::move(keys_[w]);
+            ++out;
+
+            auto& run = runs_[w];
+            if (++run.first != run.second)
+            {
+                keys_[w] = *run.first;
+            }
+
+            for (auto node = (w + k) / 2; node > 0; node /= 2)
+            {
+                if (Beats(tree_[node], w))
+                {
+                    std::swap(tree_[node], w);
+                }
+            }
+        }
+        return out;
+    }
+
+    [[nodiscard]] auto Exhausted(
+        std::size_t i
+    ) const -> bool
+    {
+        return runs_[i].first == runs_[i].second;
+    }
+
+    // 列 a が列 b より先に出るか (尽きた列は常に負ける)
+    auto Beats(
+        std::size_t a,
+        std::size_t b
+    ) -> bool
+    {
+        if (Exhausted(a) || Exhausted(b))
+        {
+            return !Exhausted(a);
+        }
+        // 同じ値はまれなので、予測できない分岐は最初の比較の 1 回だけになるように並べる
+        if (std::invoke(comp_, keys_[b], keys_[a]))
+        {
+            return false;
+        }
+        return std::invoke(comp_, keys_[a], keys_[b]) || (a < b);
+    }
+
+    auto Build(
+        std::size_t node
+    ) -> std::size_t
+    {
+        const auto k = runs_.size();
+        if (node >= k)
+        {
+            return node - k;
+        }
+        const auto l = Build(2 * node);
+        const auto r = Build((2 * node) + 1);
+        if (Beats(l, r))
+        {
+            tree_[node] = r;
+            return l;
+        }
+        tree_[node] = l;
+        return r;
+    }
+
+    std::vector<std::pair<It, S>> runs_;
+    std::vector<V>                keys_;
+    std::vector<std::size_t>      tree_;
+    Comp&                         comp_;
+};
+
+template <typename Runs>
+using RunIterator = std::ranges::iterator_t<std::ranges::range_reference_t<Runs>>;
+
+template <typename Runs>
+using RunSentinel = std::ranges::sentinel_t<std::ranges::range_reference_t<Runs>>;
+
+/**
+ * @brief items のうち precedes の順で重みの累計が全体の半分に達する要素 (重み付きの中央値)
+ *
+ * nth_element で半分ずつに絞るので、比較は平均 O(items の数) 回。items は並べ替える
+ */
+template <typename Weight, typename Precedes>
+auto WeightedMedian(
+    std::vector<std::size_t>& items,
+    std::size_t               total,
+    Weight                    weight,
+    Precedes                  precedes
+) -> std::size_t
+{
+    // [first, last) に中央値があり、それより前の要素の重みの和が ahead
+    auto        first = items.begin();
+    auto        last = items.end();
+    std::size_t ahead = 0;
+    while (true)
+    {
+        const auto nth = first + ((last - first) / 2);
+        std::ranges::nth_element(first, nth, last, precedes);
+        auto left = ahead;
+        for (auto it = first; it != nth; ++it)
+        {
+            left += weight(*it);
+        }
+        if (2 * left >= total)
+        {
+            last = nth;
+        }
+        else if (2 * (left + weight(*nth)) >= total)
+        {
+            return *nth;
+        }
+        else
+        {
+            ahead = left + weight(*nth);
+            first = nth + 1;
+        }
+    }
+}
+
+/**
+ * @brief 全ての列を並べた出力のうち rank 番目の位置で、各列をどこで切るか (co-ranking)
+ *
+ * 値が同じなら番号の小さい列を先とする順序で、各列の区間 [lo, hi) に切れ目があることを保ちながら、
+ * pivot より前に出る要素を数えて全ての区間を狭めていく。pivot はふだんは最も広い区間の中央の要素にする。
+ * 区間の長さの和が 3/4 以下に減らなかった次の回は、各区間の中央の要素のうち区間の長さを重みにした
+ * 中央値を pivot にする。このとき重みの半分以上を持つ列が区間の半分以上を捨てるので、和は必ず 3/4 以下になる。
+ * よって回数は O(log n)、1 回の手間は空でない区間の二分探索で O(k log n)。
+ */
+template <std::random_access_iterator It, typename Comp>
+auto CoRank(
+    const std::vector<std::pair<It, It>>& runs,
+    std::size_t                           rank,
+    Comp&                                 comp
+) -> std::vector<std::size_t>
+{
+    const auto k = runs.size();
+    auto       lo = std::vector<std::size_t>(k, 0);
+    auto       hi = std::vector<std::size_t>(k);
+    for (std::size_t i = 0; i < k; ++i)
+    {
+        hi[i] = static_cast<std::size_t>(runs[i].second - runs[i].first);
+    }
+    auto before = std::vector<std::size_t>(k);
+    auto open = std::vector<std::size_t>();
+    open.reserve(k);
+    auto prev = std::numeric_limits<std::size_t>::max(); // 前の回の区間の長さの和
+
+    const auto width = [&](std::size_t i) { return hi[i] - lo[i]; };
+    const auto mid = [&](std::size_t i) { return lo[i] + (width(i) / 2); };
+    const auto precedes = [&](std::size_t a, std::size_t b) {
+        const auto& x = runs[a].first[mid(a)];
+        const auto& y = runs[b].first[mid(b)];
+        return std::invoke(comp, x, y) || (!std::invoke(comp, y, x) && a < b);
+    };
+
+    while (true)
+    {
+        open.clear();
+        std::size_t weight = 0;
+        for (std::size_t i = 0; i < k; ++i)
+        {
+            if (lo[i] < hi[i])
+            {
+                open.push_back(i);
+                weight += width(i);
+            }
+        }
+        if (open.empty())
+        {
+            return lo;
+        }
+
+        std::size_t j = open.front();
+        if (weight > prev - (prev / 4))
+        {
+            j = WeightedMedian(open, weight, width, precedes);
+        }
+        else
+        {
+            for (const auto i : open)
+            {
+                j = (width(i) > width(j)) ? i : j;
+            }
+        }
+        prev = weight;
+
+        // pivot より前に出る要素の数を列ごとに数える (区間が空の列は切れ目が決まっている)
+        const auto  m = mid(j);
+        const auto& pivot = runs[j].first[m];
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < k; ++i)
+        {
+            const auto first = runs[i].first;
+            if (i == j)
+            {
+                before[i] = m;
+            }
+            else if (lo[i] == hi[i])
+            {
+                before[i] = lo[i];
+            }
+            else if (i < j)
+            {
+                before[i] = std::upper_bound(first + lo[i], first + hi[i], pivot, comp) - first;
+            }
+            else
+            {
+                before[i] = std::lower_bound(first + lo[i], first + hi[i], pivot, comp) - first;
+            }
+            total += before[i];
+        }
+
+        if (total < rank)
+        {
+            // pivot は前半に入る
+            for (const auto i : open)
+            {
+                lo[i] = std::max(lo[i], before[i]);
+            }
+            lo[j] = m + 1;
+        }
+        else
+        {
+            for (const auto i : open)
+            {
+                hi[i] = std::min(hi[i], before[i]);
+            }
+            hi[j] = m;
+        }
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief k 本のソート済みの列をまとめてマージする
+ *
+ * 敗者木で 1 要素あたり log2(k) 回の比較で次の要素を選ぶ。std::merge と同様に安定
+ * (同じ値は番号の小さい列の要素が先)。敗者木に列の先頭の値を複製するので、要素はコピーできる必要がある。
+ */
+template <SortedRuns Runs, std::weakly_incrementable Out, typename Comp = std::ranges::less>
+    requires std::copyable<std::iter_value_t<detail::RunIterator<Runs>>> &&
+             std::indirectly_writable<Out, const std::iter_value_t<detail::RunIterator<Runs>>&> &&
+             std::indirect_strict_weak_order<Comp, detail::RunIterator<Runs>>
+auto kway_merge(
+    Runs&& runs,
+    Out    out,
+    Comp   comp = {}
+) -> Out
+{
+    using It = detail::RunIterator<Runs>;
+    using S = detail::RunSentinel<Runs>;
+
+    auto cursors = std::vector<std::pair<It, S>>();
+    for (auto&& r : runs)
+    {
+        cursors.emplace_back(std::ranges::begin(r), std::ranges::end(r));
+    }
+    return detail::LoserTree<It, S, Comp>(cursors, comp).Merge(std::move(out));
+}
+
+/**
+ * @brief kway_merge (ThreadPool 版)
+ *
+ * 出力を grain ごとに区切り、各区切りで co-ranking により各列の切れ目を求めて、区切りごとに並列にマージする。
+ * 列と出力が RandomAccess でなければ逐次版で実行する。
+ */
+template <SortedRuns Runs, std::weakly_incrementable Out, typename Comp = std::ranges::less>
+    requires std::copyable<std::iter_value_t<detail::RunIterator<Runs>>> &&
+             std::indirectly_writable<Out, const std::iter_value_t<detail::RunIterator<Runs>>&> &&
+             std::indirect_strict_weak_order<Comp, detail::RunIterator<Runs>>
+auto kway_merge(
+    const execution::PoolPolicy& policy,
+    Runs&&                       runs,
+    Out                          out,
+    Comp                         comp = {}
+) -> Out
+{
+    using It = detail::RunIterator<Runs>;
+
+    if constexpr (
+        !std::ranges::random_access_range<std::ranges::range_reference_t<Runs>> ||
+        !std::ranges::common_range<std::ranges::range_reference_t<Runs>> || !std::random_access_iterator<Out>
+    )
+    {
+        return cppreference::kway_merge(std::forward<Runs>(runs), std::move(out), std::move(comp));
+    }
+    else
+    {
+        auto        whole = std::vector<std::pair<It, It>>();
+        std::size_t n = 0;
+        for (auto&& r : runs)
+        {
+            whole.emplace_back(std::ranges::begin(r), std::ranges::end(r));
+            n += static_cast<std::size_t>(std::ranges::size(r));
+        }
+
+        const auto grain = policy.grain(n);
+        const auto parts = (n + grain - 1) / grain;
+        if (parts <= 1 || policy.pool().size() == 1)
+        {
+            return detail::LoserTree<It, It, Comp>(whole, comp).Merge(std::move(out));
+        }
+
+        // splits[p]: 出力の p * grain 番目の位置での各列の切れ目
+        auto splits = std::vector<std::vector<std::size_t>>(parts + 1);
+        splits[0] = std::vector<std::size_t>(whole.size(), 0);
+        policy.pool().ParallelFor(1, parts + 1, 1, [&](std::size_t b, std::size_t e) {
+            for (auto p = b; p < e; ++p)
+            {
+                splits[p] = detail::CoRank(whole, std::min(n, p * grain), comp);
+            }
+        });
+
+        policy.pool().ParallelFor(0, parts, 1, [&](std::size_t b, std::size_t e) {
+            for (auto p = b; p < e; ++p)
+            {
+                auto part = std::vector<std::pair<It, It>>();
+                part.reserve(whole.size());
+                for (std::size_t i = 0; i < whole.size(); ++i)
+                {
+                    part.emplace_back(whole[i].first + splits[p][i], whole[i].first + splits[p + 1][i]);
+                }
+                detail::LoserTree<It, It, Comp>(part, comp).Merge(out + (p * grain));
+            }
+        });
+        return out + n;
+    }
+}
+
+} // namespace cppreference
@@ -0,0 +1,383 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cppreference
+{
+
+namespace detail
+{
+
+// 16 バイト刻みの大きさのクラスごとにブロックを管理する (16, 32, ..., 256 バイト)
+constexpr std::size_t NODE_ALIGN = 16;
+constexpr std::size_t NODE_CLASSES = 16;
+constexpr std::size_t MAX_NODE_SIZE = NODE_ALIGN * NODE_CLASSES;
+constexpr std::size_t SLAB_SIZE = 64 * 1024; // NOLINT
+
+struct FreeBlock
+{
+    FreeBlock* next;
+};
+
+constexpr auto NodeClass(
+    std::size_t bytes
+) -> std::size_t
+{
+    return (bytes + NODE_ALIGN - 1) / NODE_ALIGN - 1;
+}
+
+// クラス c のスラブ 1 つ分のブロック数。スレッドごとの空きリストはこれを超えたら半分を NodePoolDepot に戻す
+constexpr auto SlabBlocks(
+    std::size_t c
+) -> std::size_t
+{
+    return SLAB_SIZE / ((c + 1) * NODE_ALIGN);
+}
+
+/**
+ * @brief 全スレッドで共有するスラブと、終了したスレッドから引き取った空きブロック
+ *
+ * スラブはプロセスの終了まで返さない (他のスレッドに渡したノードが残っていても良いように)。
+ * depot 自体も破棄しない: static / thread_local のコンテナは depot より後に破棄されうるので、
+ * その解放がスラブや depot を使えるようにしておく。
+ */
+class NodePoolDepot
+{
+public:
+    static auto Instance() -> NodePoolDepot&
+    {
+        static auto* depot = new NodePoolDepot(); // NOLINT(cppcoreguidelines-owning-memory)
+        return *depot;
+    }
+
+    NodePoolDepot(const NodePoolDepot&) = delete;
+    auto operator=(const NodePoolDepot&) -> NodePoolDepot& = delete;
+    NodePoolDepot(NodePoolDepot&&) = delete;
+    auto operator=(NodePoolDepot&&) -> NodePoolDepot& = delete;
+
+    ~NodePoolDepot() = delete;
+
+    auto NewSlab() -> std::byte*
+    {
+        auto* slab = static_cast<std::byte*>(::operator new(SLAB_SIZE, std::align_val_t{NODE_ALIGN}));
+        const auto lock = std::scoped_lock(mutex_);
+        slabs_.push_back(slab);
+        return slab;
+    }
+
+    /**
+     * @brief 引き取った空きブロックを先頭から max 個まで渡す (なければ {nullptr, 0})
+     */
+    auto Take(
+        std::size_t c,
+        std::size_t max
+    ) -> std::pair<FreeBlock*, std::size_t>
+    {
+        const auto lock = std::scoped_lock(mutex_);
+        auto*      head = free_[c];
+        if (head == nullptr)
+        {
+            return {nullptr, 0};
+        }
+        auto*       tail = head;
+        std::size_t n = 1;
+        for (; n < max && tail->next != nullptr; ++n)
+        {
+            tail = tail->next;
+        }
+        free_[c] = tail->next;
+        tail->next = nullptr;
+        return {head, n};
+    }
+
+    void Give(
+        std::size_t c,
+        FreeBlock*  head,
+        FreeBlock*  tail
+    ) noexcept
+    {
+        const auto lock = std::scoped_lock(mutex_);
+        tail->next = free_[c];
+        free_[c] = head;
+    }
+
+    [[nodiscard]] auto slab_count() -> std::size_t
+    {
+        const auto lock = std::scoped_lock(mutex_);
+        return slabs_.size();
+    }
+
+private:
+    NodePoolDepot() = default;
+
+    std::mutex                           mutex_;
+    std::array<FreeBlock*, NODE_CLASSES> free_{};
+    std::vector<std::byte*>              slabs_;
+};
+
+/**
+ * @brief スレッドごとの空きブロックのリスト
+ *
+ * 確保も解放もロックなしで先頭を付け替えるだけ。リストが空になったら、NodePoolDepot の空きブロックを
+ * 引き取るか、新しいスラブを切り分けて補充する。別のスレッドで確保したブロックの解放が続いてリストが
+ * スラブ 1 つ分 (SlabBlocks) を超えたら、半分を残して NodePoolDepot に戻し、確保する側のスレッドが使えるようにする。
+ * NodePool 自体は破棄しない (trivially destructible) ので、スレッドの終了処理中や、main スレッドなら
+ * static オブジェクトの破棄中にも使える。スレッドの終了時には別の thread_local (ExitHook) が空きブロックを
+ * NodePoolDepot に渡す。それ以降に解放したブロックや補充で余ったブロックは、その場で NodePoolDepot に戻す。
+ */
+class NodePool
+{
+public:
+    static auto Local() -> NodePool&
+    {
+        thread_local constinit auto pool = NodePool();
+        if (!pool.registered_)
+        {
+            pool.Register();
+        }
+        return pool;
+    }
+
+    NodePool(const NodePool&) = delete;
+    auto operator=(const NodePool&) -> NodePool& = delete;
+    NodePool(NodePool&&) = delete;
+    auto operator=(NodePool&&) -> NodePool& = delete;
+
+    ~NodePool() = default;
+
+    auto Allocate(
+        std::size_t c
+    ) -> void*
+    {
+        if (free_[c] == nullptr)
+        {
+            Refill(c);
+        }
+        auto* block = free_[c];
+        free_[c] = block->next;
+        --count_[c];
+        if (retired_)
+        {
+            GiveBack(c);
+        }
+        return block;
+    }
+
+    void Deallocate(
+        void*       p,
+        std::size_t c
+    ) noexcept
+    {
+        auto* block = static_cast<FreeBlock*>(p);
+        if (retired_)
+        {
+            NodePoolDepot::Instance().Give(c, block, block);
+            return;
+        }
+        block->next = free_[c];
+        free_[c] = block;
+        if (++count_[c] > SlabBlocks(c))
+        {
+            Trim(c);
+        }
+    }
+
+private:
+    constexpr NodePool() = default;
+
+    // スレッドの終了時に Retire を呼ぶ thread_local を作る (Local で最初に使われたときに 1 度だけ)
+    void Register()
+    {
+        registered_ = true;
+
+        struct ExitHook
+        {
+            NodePool* pool;
+
+            explicit ExitHook(
+                NodePool* owner
+            )
+                : pool(owner)
+            {
+            }
+
+            ExitHook(const ExitHook&) = delete;
+            auto operator=(const ExitHook&) -> ExitHook& = delete;
+            ExitHook(ExitHook&&) = delete;
+            auto operator=(ExitHook&&) -> ExitHook& = delete;
+
+            ~ExitHook() { pool->Retire(); }
+        };
+        thread_local auto hook = ExitHook(this);
+    }
+
+    void Retire()
+    {
+        retired_ = true;
+        for (std::size_t c = 0; c < NODE_CLASSES; ++c)
+        {
+            GiveBack(c);
+        }
+    }
+
+    // クラス c の空きブロックを全て NodePoolDepot に渡す
+    void GiveBack(
+        std::size_t c
+    )
+    {
+        if (free_[c] == nullptr)
+        {
+            return;
+        }
+        auto* tail = free_[c];
+        while (tail->next != nullptr)
+        {
+            tail = tail->next;
+        }
+        NodePoolDepot::Instance().Give(c, free_[c], tail);
+        free_[c] = nullptr;
+        count_[c] = 0;
+    }
+
+    // クラス c の空きブロックを先頭の SlabBlocks(c) / 2 個だけ残し、残りを NodePoolDepot に渡す
+    void Trim(
+        std::size_t c
+    ) noexcept
+    {
+        const auto keep = SlabBlocks(c) / 2;
+        auto*      last = free_[c];
+        for (std::size_t i = 1; i < keep; ++i)
+        {
+            last = last->next;
+        }
+        auto* head = last->next;
+        auto* tail = head;
+        while (tail->next != nullptr)
+        {
+            tail = tail->next;
+        }
+        last->next = nullptr;
+        NodePoolDepot::Instance().Give(c, head, tail);
+        count_[c] = keep;
+    }
+
+    void Refill(
+        std::size_t c
+    )
+    {
+        std::tie(free_[c], count_[c]) = NodePoolDepot::Instance().Take(c, SlabBlocks(c) / 2);
+        if (free_[c] != nullptr)
+        {
+            return;
+        }
+
+        // スラブを大きさ (c + 1) * NODE_ALIGN のブロックに切り分け、先頭から順に取り出すようにつなぐ
+        auto*      slab = NodePoolDepot::Instance().NewSlab();
+        const auto size = (c + 1) * NODE_ALIGN;
+        FreeBlock* head = nullptr;
+        for (auto offset = (SLAB_SIZE / size - 1) * size;; offset -= size)
+        {
+            head = ::new (slab + offset) FreeBlock{head};
+            if (offset == 0)
+            {
+                break;
+            }
+        }
+        free_[c] = head;
+        count_[c] = SLAB_SIZE / size;
+    }
+
+    std::array<FreeBlock*, NODE_CLASSES>  free_{};
+    std::array<std::size_t, NODE_CLASSES> count_{}; // free_ のブロック数
+    bool                                  registered_ = false;
+    bool                                  retired_ = false; // 空きブロックを NodePoolDepot に渡し終えた
+};
+
+static_assert(std::is_trivially_destructible_v<NodePool>);
+
+} // namespace detail
+
+/**
+ * @brief ノードを 1 つずつ確保するコンテナ (std::list, std::forward_list, std::unordered_xxx) 用のアロケータ
+ *
+ * 1 要素ずつの確保で MAX_NODE_SIZE バイト以下なら、スレッドごとの大きさのクラス別の空きリストから取り出す。
+ * 空きリストはスラブ (SLAB_SIZE バイト) を切り分けて補充し、ロックを取るのは補充するときだけ。
+ * それ以外の確保 (std::unordered_xxx のバケツの配列など) は std::allocator に任せる。
+ * 状態を持たないので、全てのインスタンスは等しい (別のスレッドで解放しても良い)。
+ */
+template <typename T>
+class NodePoolAllocator
+{
+public:
+    using value_type = T;
+
+    NodePoolAllocator() = default;
+
+    template <typename U>
+    NodePoolAllocator(
+        const NodePoolAllocator<U>& /*other*/
+    ) noexcept
+    {
+    }
+
+    [[nodiscard]] auto allocate(
+        std::size_t n
+    ) -> T*
+    {
+        if (Pooled(n))
+        {
+            return static_cast<T*>(detail::NodePool::Local().Allocate(CLASS));
+        }
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(
+        T*          p,
+        std::size_t n
+    ) noexcept
+    {
+        if (Pooled(n))
+        {
+            detail::NodePool::Local().Deallocate(p, CLASS);
+            return;
+        }
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    template <typename U>
+    friend auto operator==(
+        const NodePoolAllocator& /*a*/,
+        const NodePoolAllocator<U>& /*b*/
+    ) -> bool
+    {
+        return true;
+    }
+
+private:
+    static constexpr std::size_t CLASS = detail::NodeClass(sizeof(T));
+
+    static constexpr auto Pooled(
+        std::size_t n
+    ) -> bool
+    {
+        return n == 1 && sizeof(T) <= detail::MAX_NODE_SIZE && alignof(T) <= detail::NODE_ALIGN;
+    }
+};
+
+/**
+ * @brief NodePoolAllocator がこれまでに確保したスラブの数 (全スレッドの合計)
+ */
+inline auto NodePoolSlabCount() -> std::size_t
+{
+    return detail::NodePoolDepot::Instance().slab_count();
+}
+
+} // namespace cppreference
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace cppreference
+{
+
+/**
+ * @brief 取り出すキーが単調非減少な場合の最小ヒープ (radix heap)
+ *
+ * 最後に取り出したキー last と push するキー k の最上位の異なるビットの位置 bit_width(k ^ last) ごとに
+ * バケツを分ける。バケツ 0 (k == last) が空になったら、次に空でないバケツの最小値を新しい last にして、
+ * そのバケツの要素をより下位のバケツに配り直す。各要素はバケツの番号が下がる方向にしか動かないので、
+ * push は O(1)、pop は償却 O(log C) (C はキーのビット数)。
+ * Dijkstra 法やタイマーのように、push するキーが最後に取り出したキー以上であることが前提。
+ */
+template <std::unsigned_integral Key, typename Value>
+class RadixHeap
+{
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<Key, Value>;
+    using size_type = std::size_t;
+
+    [[nodiscard]] auto empty() const -> bool { return size_ == 0; }
+
+    [[nodiscard]] auto size() const -> size_type { return size_; }
+
+    /**
+     * @brief キーが最小の要素
+     *
+     * 下位のバケツへの配り直しをここで行うので const ではない
+     */
+    [[nodiscard]] auto top() -> const value_type&
+    {
+        Refill();
+        return buckets_[0].back();
+    }
+
+    /**
+     * @brief key は最後に取り出したキー以上であること
+     */
+    void push(
+        Key          key,
+        const Value& value
+    )
+    {
+        emplace(key, value);
+    }
+
+    void push(
+        Key     key,
+        Value&& value
+    )
+    {
+        emplace(key, std::move(value));
+    }
+
+    template <typename... Args>
+    void emplace(
+        Key key,
+        Args&&... args
+    )
+    {
+        buckets_[Bucket(key)].emplace_back(
+            std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...)
+        );
+        ++size_;
+    }
+
+    void pop()
+    {
+        Refill();
+        buckets_[0].pop_back();
+        --size_;
+    }
+
+    void clear()
+    {
+        for (auto& b : buckets_)
+        {
+            b.clear();
+        }
+        size_ = 0;
+        last_ = 0;
+    }
+
+private:
+    static constexpr std::size_t BITS = std::numeric_limits<Key>::digits;
+
+    [[nodiscard]] auto Bucket(
+        Key key
+    ) const -> std::size_t
+    {
+        return static_cast<std::size_t>(std::bit_width(static_cast<Key>(key ^ last_)));
+    }
+
+    void Refill()
+    {
+        if (!buckets_[0].empty())
+        {
+            return;
+        }
+
+        std::size_t i = 1;
+        while (buckets_[i].empty())
+        {
+            ++i;
+        }
+        auto& from = buckets_[i];
+        last_ = std::ranges::min_element(from, {}, &value_type::first)->first;
+        for (auto& e : from)
+        {
+            buckets_[Bucket(e.first)].push_back(std::move(e));
+        }
+        from.clear();
+    }
+
+    std::array<std::vector<value_type>, BITS + 1> buckets_;
+    size_type                                     size_ = 0;
+    Key                                           last_ = 0;
+};
+
+} // namespace cppreference
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace cppreference
+{
+
+/**
+ * @brief 基数ソートできるキー (bool 以外の整数と IEEE 754 の float/double)
+ */
+template <typename T>
+concept RadixKey = (std::integral<T> && !std::same_as<T, bool>) ||
+                   (std::floating_point<T> && std::numeric_limits<T>::is_iec559 && (sizeof(T) == 4 || sizeof(T) == 8));
+
+namespace detail
+{
+
+// 昇順 / 降順として基数ソートに置き換えられる比較
+template <typename Comp, typename K>
+inline constexpr bool IS_LESS = std::same_as<Comp, std::ranges::less> || std::same_as<Comp, std::less<>> ||
+                                std::same_as<Comp, std::less<K>>;
+
+template <typename Comp, typename K>
+inline constexpr bool IS_GREATER = std::same_as<Comp, std::ranges::greater> || std::same_as<Comp, std::greater<>> ||
+                                   std::same_as<Comp, std::greater<K>>;
+
+// これより短い区間はヒストグラムの初期化の方が高くつくので std::sort に任せる
+inline constexpr std::ptrdiff_t RADIX_SORT_THRESHOLD = 256;
+
+/**
+ * @brief キーを大小関係が保たれる符号なし整数に写す
+ *
+ * 符号付き整数は符号ビットを反転し、浮動小数点数は負なら全ビット、非負なら符号ビットを反転する
+ */
+template <RadixKey K>
+constexpr auto RadixBits(
+    K key
+)
+{
+    using U = std::conditional_t<sizeof(K) == 1, std::uint8_t,
+              std::conditional_t<sizeof(K) == 2, std::uint16_t,
+              std::conditional_t<sizeof(K) == 4, std::uint32_t, std::uint64_t>>>;
+    constexpr auto SIGN = U{1} << ((sizeof(U) * 8) - 1);
+
+    if constexpr (std::floating_point<K>)
+    {
+        const auto u = std::bit_cast<U>(key);
+        return static_cast<U>(((u & SIGN) != 0) ? ~u : (u | SIGN));
+    }
+    else if constexpr (std::signed_integral<K>)
+    {
+        return static_cast<U>(static_cast<U>(key) ^ SIGN);
+    }
+    else
+    {
+        return static_cast<U>(key);
+    }
+}
+
+/**
+ * @brief 8 bit ずつの LSD 基数ソート
+ *
+ * 全桁のヒストグラムを 1 回の走査でまとめて作り、全要素が同じ値を持つ桁は飛ばす。
+ * 作業領域として要素数分のバッファを確保し、元の区間と交互に書き込む。
+ */
+template <std::random_access_iterator It, typename Proj, bool Descending>
+void RadixSort(
+    It   first,
+    It   last,
+    Proj proj
+)
+{
+    using V = std::iter_value_t<It>;
+    using K = std::remove_cvref_t<std::invoke_result_t<Proj&, std::iter_reference_t<It>>>;
+
+    constexpr std::size_t PASSES = sizeof(K);
+    constexpr std::size_t RADIX = 256;
+
+    const auto n = static_cast<std::size_t>(last - first);
+    const auto digit = [&](V& v, std::size_t pass) {
+        auto bits = RadixBits<K>(std::invoke(proj, v));
+        if constexpr (Descending)
+        {
+            bits = static_cast<decltype(bits)>(~bits);
+        }
+        return static_cast<std::size_t>((bits >> (pass * 8)) & 0xFF); // NOLINT
+    };
+
+    auto counts = std::array<std::array<std::size_t, RADIX>, PASSES>{};
+    for (auto it = first; it != last; ++it)
+    {
+        for (std::size_t p = 0; p < PASSES; ++p)
+        {
+            ++counts[p][digit(*it, p)];
+        }
+    }
+
+    auto buffer = std::make_unique_for_overwrite<V[]>(n); // NOLINT
+    auto src = std::to_address(first);
+    auto dst = buffer.get();
+    bool in_buffer = false;
+
+    for (std::size_t p = 0; p < PASSES; ++p)
+    {
+        auto& count = counts[p];
+        if (std::ranges::find(count, n) != count.end())
+        {
+            continue;
+        }
+
+        auto offset = std::array<std::size_t, RADIX>{};
+        std::exclusive_scan(count.begin(), count.end(), offset.begin(), std::size_t{0});
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            dst[offset[digit(src[i], p)]++] = std::move(src[i]);
+        }
+        std::swap(src, dst);
+        in_buffer = !in_buffer;
+    }
+
+    if (in_buffer)
+    {
+        std::move(src, src + n, std::to_address(first));
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief LSD 基数ソート
+ *
+ * std::ranges::sort と同じ形で comp と proj を受け取る。基数ソートに切り替えるのは次の場合だけで、
+ * それ以外は std::ranges::sort で並べる。
+ *   - contiguous な区間で、要素がデフォルト構築とムーブ代入できる
+ *   - proj の結果が RadixKey
+ *   - comp が less 系 (昇順) または greater 系 (降順)
+ *
+ * 基数ソートの場合は安定ソートになるが、std::sort と同じく安定性は保証しない。
+ * NaN を含む浮動小数点数の並びも std::sort と同じく未規定。
+ */
+template <
+    std::random_access_iterator It,
+    std::sentinel_for<It>       S,
+    typename Comp = std::ranges::less,
+    typename Proj = std::identity>
+    requires std::sortable<It, Comp, Proj>
+auto radix_sort(
+    It   first,
+    S    last,
+    Comp comp = {},
+    Proj proj = {}
+) -> It
+{
+    using V = std::iter_value_t<It>;
+    using K = std::remove_cvref_t<std::invoke_result_t<Proj&, std::iter_reference_t<It>>>;
+
+    auto tail = std::ranges::next(first, last);
+    if constexpr (
+        std::contiguous_iterator<It> && RadixKey<K> && std::default_initializable<V> && std::movable<V> &&
+        (detail::IS_LESS<Comp, K> || detail::IS_GREATER<Comp, K>)
+    )
+    {
+        if (tail - first >= detail::RADIX_SORT_THRESHOLD)
+        {
+            detail::RadixSort<It, Proj, detail::IS_GREATER<Comp, K>>(first, tail, std::move(proj));
+            return tail;
+        }
+    }
+    return std::ranges::sort(first, tail, std::move(comp), std::move(proj));
+}
+
+template <std::ranges::random_access_range R, typename Comp = std::ranges::less, typename Proj = std::identity>
+    requires std::sortable<std::ranges::iterator_t<R>, Comp, Proj>
+auto radix_sort(
+    R&&  r,
+    Comp comp = {},
+    Proj proj = {}
+) -> std::ranges::borrowed_iterator_t<R>
+{
+    return cppreference::radix_sort(std::ranges::begin(r), std::ranges::end(r), std::move(comp), std::move(proj));
+}
+
+} // namespace cppreference
@@ -0,0 +1,807 @@
+#pragma once
+
+#include "trivially_relocatable.hpp"
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#define CPPREFERENCE_MREMAP 1
+#else
+#define CPPREFERENCE_MREMAP 0
+#endif
+
+namespace cppreference
+{
+
+namespace detail
+{
+
+// これ以上の領域は mmap で確保し、mremap で伸ばす (ページを付け替えるだけで中身を写さない)
+constexpr std::size_t MREMAP_THRESHOLD = std::size_t{1} << 20U;
+
+#if CPPREFERENCE_MREMAP
+inline auto RoundUpToPage(
+    std::size_t bytes
+) -> std::size_t
+{
+    static const auto page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    return (bytes + page - 1) / page * page;
+}
+#endif
+
+/**
+ * @brief bytes 以上の領域を確保し、bytes を実際の大きさにする (bytes > 0)
+ */
+inline auto AllocateBytes(
+    std::size_t& bytes
+) -> void*
+{
+#if CPPREFERENCE_MREMAP
+    if (bytes >= MREMAP_THRESHOLD)
+    {
+        bytes = RoundUpToPage(bytes);
+        void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED) // NOLINT
+        {
+            throw std::bad_alloc();
+        }
+        return p;
+    }
+#endif
+    void* p = std::malloc(bytes); // NOLINT
+    if (p == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+inline void DeallocateBytes(
+    void*       p,
+    std::size_t bytes
+)
+{
+#if CPPREFERENCE_MREMAP
+    if (bytes >= MREMAP_THRESHOLD)
+    {
+        ::munmap(p, bytes);
+        return;
+    }
+#endif
+    std::free(p); // NOLINT
+}
+
+/**
+ * @brief 先頭 used バイトの中身を保ったまま領域の大きさを変え、bytes を実際の大きさにする
+ *
+ * 大きな領域同士は mremap、小さな領域同士は realloc (その場で伸びればコピーしない)、境界をまたぐときは memcpy
+ */
+inline auto ReallocateBytes(
+    void*        p,
+    std::size_t  used,
+    std::size_t  old_bytes,
+    std::size_t& bytes
+) -> void*
+{
+#if CPPREFERENCE_MREMAP
+    const auto old_mapped = old_bytes >= MREMAP_THRESHOLD;
+    const auto mapped = bytes >= MREMAP_THRESHOLD;
+    if (old_mapped && mapped)
+    {
+        bytes = RoundUpToPage(bytes);
+        void* q = ::mremap(p, old_bytes, bytes, MREMAP_MAYMOVE);
+        if (q == MAP_FAILED) // NOLINT
+        {
+            throw std::bad_alloc();
+        }
+        return q;
+    }
+    if (old_mapped != mapped)
+    {
+        void* q = AllocateBytes(bytes);
+        std::memcpy(q, p, used);
+        DeallocateBytes(p, old_bytes);
+        return q;
+    }
+#else
+    (void)used;
+    (void)old_bytes;
+#endif
+    void* q = std::realloc(p, bytes); // NOLINT
+    if (q == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return q;
+}
+
+} // namespace detail
+
+/**
+ * @brief 要素がトリビアルに再配置できれば、バイト列のコピーで要素を動かす vector
+ *
+ * TriviallyRelocatable な T では、容量の拡大を realloc / mremap で、insert / erase の要素の移動を memmove で行い、
+ * 要素ごとのムーブ構築とデストラクトを呼ばない。それ以外の T では std::vector と同じく要素ごとにムーブする。
+ * 容量は std::vector と同じく 2 倍ずつ増やす。MREMAP_THRESHOLD 以上の領域はページ単位で確保するので、
+ * capacity() は要求より大きくなることがある。
+ */
+template <typename T>
+    requires(alignof(T) <= alignof(std::max_align_t))
+class RelocatableVector
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    RelocatableVector() = default;
+
+    explicit RelocatableVector(
+        size_type n
+    )
+    {
+        reserve(n);
+        resize(n);
+    }
+
+    RelocatableVector(
+        size_type n,
+        const T&  value
+    )
+    {
+        assign(n, value);
+    }
+
+    template <std::input_iterator It>
+    RelocatableVector(
+        It first,
+        It last
+    )
+    {
+        assign(first, last);
+    }
+
+    RelocatableVector(
+        std::initializer_list<T> values
+    )
+        : RelocatableVector(values.begin(), values.end())
+    {
+    }
+
+    RelocatableVector(
+        const RelocatableVector& other
+    )
+        : RelocatableVector(other.begin(), other.end())
+    {
+    }
+
+    RelocatableVector(
+        RelocatableVector&& other
+    ) noexcept
+        : data_(std::exchange(other.data_, nullptr)),
+          size_(std::exchange(other.size_, 0)),
+          capacity_(std::exchange(other.capacity_, 0))
+    {
+    }
+
+    auto operator=(
+        const RelocatableVector& other
+    ) -> RelocatableVector&
+    {
+        if (this != &other)
+        {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    auto operator=(
+        RelocatableVector&& other
+    ) noexcept -> RelocatableVector&
+    {
+        if (this != &other)
+        {
+            auto moved = std::move(other);
+            swap(moved);
+        }
+        return *this;
+    }
+
+    auto operator=(
+        std::initializer_list<T> values
+    ) -> RelocatableVector&
+    {
+        assign(values);
+        return *this;
+    }
+
+    ~RelocatableVector()
+    {
+        clear();
+        Release();
+    }
+
+    void assign(
+        size_type n,
+        const T&  value
+    )
+    {
+        const auto copy = T(value);
+        clear();
+        reserve(n);
+        std::uninitialized_fill_n(data_, n, copy);
+        size_ = n;
+    }
+
+    template <std::input_iterator It>
+    void assign(
+        It first,
+        It last
+    )
+    {
+        clear();
+        if constexpr (std::forward_iterator<It>)
+        {
+            reserve(static_cast<size_type>(std::distance(first, last)));
+        }
+        for (; first != last; ++first)
+        {
+            emplace_back(*first);
+        }
+    }
+
+    void assign(
+        std::initializer_list<T> values
+    )
+    {
+        assign(values.begin(), values.end());
+    }
+
+    [[nodiscard]] auto at(
+        size_type i
+    ) -> T&
+    {
+        if (i >= size_)
+        {
+            throw std::out_of_range("RelocatableVector::at");
+        }
+        return data_[i];
+    }
+
+    [[nodiscard]] auto at(
+        size_type i
+    ) const -> const T&
+    {
+        if (i >= size_)
+        {
+            throw std::out_of_range("RelocatableVector::at");
+        }
+        return data_[i];
+    }
+
+    [[nodiscard]] auto operator[](
+        size_type i
+    ) -> T&
+    {
+        return data_[i];
+    }
+
+    [[nodiscard]] auto operator[](
+        size_type i
+    ) const -> const T&
+    {
+        return data_[i];
+    }
+
+    [[nodiscard]] auto front() -> T& { return data_[0]; }
+
+    [[nodiscard]] auto front() const -> const T& { return data_[0]; }
+
+    [[nodiscard]] auto back() -> T& { return data_[size_ - 1]; }
+
+    [[nodiscard]] auto back() const -> const T& { return data_[size_ - 1]; }
+
+    [[nodiscard]] auto data() -> T* { return data_; }
+
+    [[nodiscard]] auto data() const -> const T* { return data_; }
+
+    [[nodiscard]] auto begin() -> iterator { return data_; }
+
+    [[nodiscard]] auto begin() const -> const_iterator { return data_; }
+
+    [[nodiscard]] auto end() -> iterator { return data_ + size_; }
+
+    [[nodiscard]] auto end() const -> const_iterator { return data_ + size_; }
+
+    [[nodiscard]] auto cbegin() const -> const_iterator { return begin(); }
+
+    [[nodiscard]] auto cend() const -> const_iterator { return end(); }
+
+    [[nodiscard]] auto rbegin() -> reverse_iterator { return reverse_iterator(end()); }
+
+    [[nodiscard]] auto rbegin() const -> const_reverse_iterator { return const_reverse_iterator(end()); }
+
+    [[nodiscard]] auto rend() -> reverse_iterator { return reverse_iterator(begin()); }
+
+    [[nodiscard]] auto rend() const -> const_reverse_iterator { return const_reverse_iterator(begin()); }
+
+    [[nodiscard]] auto empty() const -> bool { return size_ == 0; }
+
+    [[nodiscard]] auto size() const -> size_type { return size_; }
+
+    [[nodiscard]] auto max_size() const -> size_type
+    {
+        return std::allocator_traits<std::allocator<T>>::max_size(std::allocator<T>());
+    }
+
+    [[nodiscard]] auto capacity() const -> size_type { return capacity_; }
+
+    void reserve(
+        size_type n
+    )
+    {
+        if (n > capacity_)
+        {
+            Reallocate(n);
+        }
+    }
+
+    void shrink_to_fit()
+    {
+        if (size_ == 0)
+        {
+            Release();
+        }
+        else if (size_ < capacity_)
+        {
+            Reallocate(size_);
+        }
+    }
+
+    void clear()
+    {
+        std::destroy(data_, data_ + size_);
+        size_ = 0;
+    }
+
+    /**
+     * @brief 挿入位置より後ろの要素を memmove でずらす (TriviallyRelocatable でなければ末尾に作って回転させる)
+     */
+    template <typename... Args>
+    auto emplace(
+        const_iterator pos,
+        Args&&... args
+    ) -> iterator
+    {
+        const auto i = static_cast<size_type>(pos - cbegin());
+        if constexpr (RELOCATE)
+        {
+            // args が要素を指していても良いように、ずらす前に脇で作っておいてバイト列で置く
+            alignas(T) std::array<std::byte, sizeof(T)> storage;
+            auto* slot = reinterpret_cast<T*>(storage.data()); // NOLINT
+            auto* value = std::construct_at(slot, std::forward<Args>(args)...);
+            try
+            {
+                OpenGap(i, 1);
+            }
+            catch (...)
+            {
+                std::destroy_at(value);
+                throw;
+            }
+            std::memcpy(static_cast<void*>(data_ + i), value, sizeof(T));
+            ++size_;
+        }
+        else
+        {
+            emplace_back(std::forward<Args>(args)...);
+            std::rotate(begin() + i, end() - 1, end());
+        }
+        return begin() + i;
+    }
+
+    auto insert(
+        const_iterator pos,
+        const T&       value
+    ) -> iterator
+    {
+        return emplace(pos, value);
+    }
+
+    auto insert(
+        const_iterator pos,
+        T&&            value
+    ) -> iterator
+    {
+        return emplace(pos, std::move(value));
+    }
+
+    auto insert(
+        const_iterator pos,
+        size_type      n,
+        const T&       value
+    ) -> iterator
+    {
+        const auto i = static_cast<size_type>(pos - cbegin());
+        const auto copy = T(value);
+        if constexpr (RELOCATE)
+        {
+            OpenGap(i, n);
+            try
+            {
+                std::uninitialized_fill_n(data_ + i, n, copy);
+            }
+            catch (...)
+            {
+                CloseGap(i, n, size_ - i);
+                throw;
+            }
+            size_ += n;
+        }
+        else
+        {
+            const auto old_size = size_;
+            if (size_ + n > capacity_)
+            {
+                reserve(Grown(size_ + n));
+            }
+            std::uninitialized_fill_n(end(), n, copy);
+            size_ += n;
+            std::rotate(begin() + i, begin() + old_size, end());
+        }
+        return begin() + i;
+    }
+
+    /**
+     * @brief [first, last) はこの配列の要素を指さないこと
+     */
+    template <std::input_iterator It>
+    auto insert(
+        const_iterator pos,
+        It             first,
+        It             last
+    ) -> iterator
+    {
+        const auto i = static_cast<size_type>(pos - cbegin());
+        if constexpr (RELOCATE && std::forward_iterator<It>)
+        {
+            const auto n = static_cast<size_type>(std::distance(first, last));
+            OpenGap(i, n);
+            try
+            {
+                std::uninitialized_copy(first, last, data_ + i);
+            }
+            catch (...)
+            {
+                CloseGap(i, n, size_ - i);
+                throw;
+            }
+            size_ += n;
+        }
+        else
+        {
+            const auto old_size = size_;
+            for (; first != last; ++first)
+            {
+                emplace_back(*first);
+            }
+            std::rotate(begin() + i, begin() + old_size, end());
+        }
+        return begin() + i;
+    }
+
+    auto insert(
+        const_iterator           pos,
+        std::initializer_list<T> values
+    ) -> iterator
+    {
+        return insert(pos, values.begin(), values.end());
+    }
+
+    auto erase(
+        const_iterator pos
+    ) -> iterator
+    {
+        return erase(pos, pos + 1);
+    }
+
+    auto erase(
+        const_iterator first,
+        const_iterator last
+    ) -> iterator
+    {
+        const auto i = static_cast<size_type>(first - cbegin());
+        const auto n = static_cast<size_type>(last - first);
+        if constexpr (RELOCATE)
+        {
+            std::destroy(begin() + i, begin() + i + n);
+            CloseGap(i, n, size_ - i - n);
+        }
+        else
+        {
+            std::move(begin() + i + n, end(), begin() + i);
+            std::destroy(end() - n, end());
+        }
+        size_ -= n;
+        return begin() + i;
+    }
+
+    void push_back(
+        const T& value
+    )
+    {
+        emplace_back(value);
+    }
+
+    void push_back(
+        T&& value
+    )
+    {
+        emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    auto emplace_back(
+        Args&&... args
+    ) -> T&
+    {
+        if (size_ < capacity_)
+        {
+            std::construct_at(data_ + size_, std::forward<Args>(args)...);
+            ++size_;
+            return back();
+        }
+        if constexpr (RELOCATE)
+        {
+            // realloc で元の領域が解放されても良いように、脇で作ってからバイト列で置く
+            alignas(T) std::array<std::byte, sizeof(T)> storage;
+            auto* slot = reinterpret_cast<T*>(storage.data()); // NOLINT
+            auto* value = std::construct_at(slot, std::forward<Args>(args)...);
+            try
+            {
+                Reallocate(Grown(size_ + 1));
+            }
+            catch (...)
+            {
+                std::destroy_at(value);
+                throw;
+            }
+            std::memcpy(static_cast<void*>(data_ + size_), value, sizeof(T));
+        }
+        else
+        {
+            // 新しい領域に先に作ってから移す (args が要素を指していても良い)
+            auto  bytes = Grown(size_ + 1) * sizeof(T);
+            auto* fresh = static_cast<T*>(detail::AllocateBytes(bytes));
+            try
+            {
+                std::construct_at(fresh + size_, std::forward<Args>(args)...);
+                try
+                {
+                    MoveInto(fresh);
+                }
+                catch (...)
+                {
+                    std::destroy_at(fresh + size_);
+                    throw;
+                }
+            }
+            catch (...)
+            {
+                detail::DeallocateBytes(fresh, bytes);
+                throw;
+            }
+            Replace(fresh, bytes);
+        }
+        ++size_;
+        return back();
+    }
+
+    void pop_back()
+    {
+        --size_;
+        std::destroy_at(data_ + size_);
+    }
+
+    void resize(
+        size_type n
+    )
+    {
+        if (n <= size_)
+        {
+            std::destroy(data_ + n, data_ + size_);
+            size_ = n;
+            return;
+        }
+        if (n > capacity_)
+        {
+            reserve(Grown(n));
+        }
+        std::uninitialized_value_construct(data_ + size_, data_ + n);
+        size_ = n;
+    }
+
+    void resize(
+        size_type n,
+        const T&  value
+    )
+    {
+        if (n <= size_)
+        {
+            resize(n);
+            return;
+        }
+        insert(end(), n - size_, value);
+    }
+
+    void swap(
+        RelocatableVector& other
+    ) noexcept
+    {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+    }
+
+    friend void swap(
+        RelocatableVector& a,
+        RelocatableVector& b
+    ) noexcept
+    {
+        a.swap(b);
+    }
+
+    friend auto operator==(
+        const RelocatableVector& a,
+        const RelocatableVector& b
+    ) -> bool
+    {
+        return std::ranges::equal(a, b);
+    }
+
+    friend auto operator<=>(
+        const RelocatableVector& a,
+        const RelocatableVector& b
+    )
+        requires std::three_way_comparable<T>
+    {
+        return std::lexicographical_compare_three_way(a.begin(), a.end(), b.begin(), b.end());
+    }
+
+private:
+    static constexpr bool RELOCATE = TriviallyRelocatable<T>;
+
+    [[nodiscard]] auto Grown(
+        size_type n
+    ) const -> size_type
+    {
+        return std::max(n, 2 * capacity_);
+    }
+
+    /**
+     * @brief 容量を capacity (>= size()) 以上にする
+     */
+    void Reallocate(
+        size_type capacity
+    )
+    {
+        auto bytes = capacity * sizeof(T);
+        if constexpr (RELOCATE)
+        {
+            data_ = static_cast<T*>(
+                capacity_ == 0 ? detail::AllocateBytes(bytes)
+                               : detail::ReallocateBytes(data_, size_ * sizeof(T), capacity_ * sizeof(T), bytes)
+            );
+            capacity_ = bytes / sizeof(T);
+        }
+        else
+        {
+            auto* fresh = static_cast<T*>(detail::AllocateBytes(bytes));
+            try
+            {
+                MoveInto(fresh);
+            }
+            catch (...)
+            {
+                detail::DeallocateBytes(fresh, bytes);
+                throw;
+            }
+            Replace(fresh, bytes);
+        }
+    }
+
+    /**
+     * @brief ムーブが例外を投げうるならコピーで移す (移している途中で失敗しても元の要素は残る)
+     */
+    void MoveInto(
+        T* fresh
+    )
+    {
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+        {
+            std::uninitialized_move(begin(), end(), fresh);
+        }
+        else
+        {
+            std::uninitialized_copy(begin(), end(), fresh);
+        }
+    }
+
+    /**
+     * @brief 今の要素を破棄して、fresh に移した要素 (size() 個) と取り替える
+     */
+    void Replace(
+        T*          fresh,
+        std::size_t bytes
+    )
+    {
+        std::destroy(begin(), end());
+        Release();
+        data_ = fresh;
+        capacity_ = bytes / sizeof(T);
+    }
+
+    void Release()
+    {
+        if (data_ != nullptr)
+        {
+            detail::DeallocateBytes(data_, capacity_ * sizeof(T));
+            data_ = nullptr;
+            capacity_ = 0;
+        }
+    }
+
+    /**
+     * @brief [i, size()) を n 要素後ろにずらし、[i, i + n) を未初期化の隙間にする (size() は変えない)
+     */
+    void OpenGap(
+        size_type i,
+        size_type n
+    )
+    {
+        if (size_ + n > capacity_)
+        {
+            Reallocate(Grown(size_ + n));
+        }
+        std::memmove(static_cast<void*>(data_ + i + n), data_ + i, (size_ - i) * sizeof(T));
+    }
+
+    /**
+     * @brief OpenGap の逆で、隙間 [i, i + n) の後ろの tail 要素を i に詰める
+     */
+    void CloseGap(
+        size_type i,
+        size_type n,
+        size_type tail
+    )
+    {
+        std::memmove(static_cast<void*>(data_ + i), data_ + i + n, tail * sizeof(T));
+    }
+
+    T*        data_ = nullptr;
+    size_type size_ = 0;
+    size_type capacity_ = 0;
+};
+
+} // namespace cppreference
@@ -0,0 +1,295 @@
+#pragma once
+
+#include "execution.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace cppreference
+{
+
+/**
+ * @brief 作業領域の上限を設けない
+ */
+inline constexpr std::size_t UNBOUNDED_SCRATCH = std::numeric_limits<std::size_t>::max();
+
+namespace detail
+{
+
+// これ以下の区間は std::sort で逐次に並べる
+inline constexpr std::size_t SERIAL_SORT_THRESHOLD = std::size_t{1} << 14;
+
+// splitter 1 つあたりのサンプル数
+inline constexpr std::size_t OVERSAMPLING = 16;
+
+inline constexpr std::uint32_t SAMPLE_SEED = 0x5A3D;
+
+/**
+ * @brief pred を満たす要素を前に集める並列 partition
+ *
+ * grain ごとのブロックを並列に partition したあと、境界をまたいで取り残された要素同士を並列に swap する。
+ * 追加のメモリはブロック数に比例する分だけ。
+ *
+ * @return pred を満たす要素数
+ */
+template <std::random_access_iterator It, typename Pred>
+auto ParallelPartition(
+    ThreadPool& pool,
+    It          first,
+    std::size_t n,
+    std::size_t grain,
+    Pred        pred
+) -> std::size_t
+{
+    const auto blocks = (n + grain - 1) / grain;
+    auto       mids = std::vector<std::size_t>(blocks);
+    pool.ParallelFor(0, blocks, 1, [&](std::size_t b, std::size_t e) {
+        for (auto k = b; k < e; ++k)
+        {
+            const auto head = first + (k * grain);
+            const auto tail = first + std::min(n, (k + 1) * grain);
+            mids[k] = (k * grain) + (std::partition(head, tail, pred) - head);
+        }
+    });
+
+    std::size_t left = 0;
+    for (std::size_t k = 0; k < blocks; ++k)
+    {
+        left += mids[k] - (k * grain);
+    }
+
+    // 前半に残った偽の区間と、後半に残った真の区間を列挙する (始点, 累積長)
+    struct Segment
+    {
+        std::size_t begin;
+        std::size_t offset;
+    };
+    auto        wrong_left = std::vector<Segment>();
+    auto        wrong_right = std::vector<Segment>();
+    std::size_t misplaced = 0;
+    std::size_t misplaced_right = 0;
+    for (std::size_t k = 0; k < blocks; ++k)
+    {
+        const auto head = k * grain;
+        const auto tail = std::min(n, (k + 1) * grain);
+        if (const auto b = mids[k], e = std::min(tail, left); b < e)
+        {
+            wrong_left.push_back({b, misplaced});
+            misplaced += e - b;
+        }
+        if (const auto b = std::max(head, left), e = mids[k]; b < e)
+        {
+            wrong_right.push_back({b, misplaced_right});
+            misplaced_right += e - b;
+        }
+    }
+
+    // i 番目の取り残された要素の位置
+    const auto position = [](const std::vector<Segment>& segments, std::size_t i) {
+        const auto it = std::ranges::upper_bound(segments, i, std::less{}, &Segment::offset) - 1;
+        return it->begin + (i - it->offset);
+    };
+    pool.ParallelFor(0, misplaced, grain, [&](std::size_t b, std::size_t e) {
+        for (auto i = b; i < e; ++i)
+        {
+            std::iter_swap(first + position(wrong_left, i), first + position(wrong_right, i));
+        }
+    });
+    return left;
+}
+
+/**
+ * @brief 作業領域を使うサンプルソート
+ *
+ * サンプルから選んだ splitter で要素をバケットに振り分けて作業領域へ移し、バケットごとに並列にソートして書き戻す。
+ */
+template <std::random_access_iterator It, typename Comp>
+void SampleSortOutOfPlace(
+    ThreadPool& pool,
+    It          first,
+    std::size_t n,
+    std::size_t grain,
+    Comp&       comp
+)
+{
+    using V = std::iter_value_t<It>;
+
+    const auto buckets = std::clamp(n / SERIAL_SORT_THRESHOLD, std::size_t{2}, pool.size() * 8); // NOLINT
+
+    auto gen = std::mt19937_64{SAMPLE_SEED};
+    auto dist = std::uniform_int_distribution<std::size_t>(0, n - 1);
+    auto sample = std::vector<V>();
+    sample.reserve(buckets * OVERSAMPLING);
+    for (std::size_t i = 0; i < buckets * OVERSAMPLING; ++i)
+    {
+        sample.push_back(first[dist(gen)]);
+    }
+    std::sort(sample.begin(), sample.end(), comp);
+
+    auto splitters = std::vector<V>();
+    splitters.reserve(buckets - 1);
+    for (std::size_t j = 1; j < buckets; ++j)
+    {
+        splitters.push_back(sample[j * OVERSAMPLING]);
+    }
+    const auto bucket_of = [&](const V& v) {
+        return static_cast<std::size_t>(std::upper_bound(splitters.begin(), splitters.end(), v, comp) - splitters.begin());
+    };
+
+    // counts[k * buckets + j]: ブロック k のうちバケット j に入る要素数 -> 書き込み先
+    const auto blocks = (n + grain - 1) / grain;
+    auto       counts = std::vector<std::size_t>(blocks * buckets);
+    pool.ParallelFor(0, blocks, 1, [&](std::size_t b, std::size_t e) {
+        for (auto k = b; k < e; ++k)
+        {
+            for (auto i = k * grain; i < std::min(n, (k + 1) * grain); ++i)
+            {
+                ++counts[(k * buckets) + bucket_of(first[i])];
+            }
+        }
+    });
+
+    auto bounds = std::vector<std::size_t>(buckets + 1);
+    for (std::size_t j = 0, offset = 0; j < buckets; ++j)
+    {
+        bounds[j] = offset;
+        for (std::size_t k = 0; k < blocks; ++k)
+        {
+            offset += std::exchange(counts[(k * buckets) + j], offset);
+        }
+    }
+    bounds[buckets] = n;
+
+    auto buffer = std::make_unique_for_overwrite<V[]>(n); // NOLINT
+    pool.ParallelFor(0, blocks, 1, [&](std::size_t b, std::size_t e) {
+        for (auto k = b; k < e; ++k)
+        {
+            for (auto i = k * grain; i < std::min(n, (k + 1) * grain); ++i)
+            {
+                buffer[counts[(k * buckets) + bucket_of(first[i])]++] = std::move(first[i]);
+            }
+        }
+    });
+
+    pool.ParallelFor(0, buckets, 1, [&](std::size_t b, std::size_t e) {
+        for (auto j = b; j < e; ++j)
+        {
+            std::sort(&buffer[bounds[j]], &buffer[bounds[j + 1]], comp);
+            std::move(&buffer[bounds[j]], &buffer[bounds[j + 1]], first + bounds[j]);
+        }
+    });
+}
+
+/**
+ * @brief 作業領域が足りない区間は in-place に 2 分割してから再帰する
+ *
+ * 作業領域を使う区間は 1 つずつ処理するので、同時に確保する作業領域は scratch 要素以下に収まる。
+ * scratch が逐次ソートのしきい値以下なら作業領域は一切確保しないので、分割した両側を並列に処理する。
+ */
+template <std::random_access_iterator It, typename Comp>
+void SampleSort(
+    ThreadPool& pool,
+    It          first,
+    std::size_t n,
+    std::size_t grain,
+    std::size_t scratch,
+    Comp&       comp
+)
+{
+    using V = std::iter_value_t<It>;
+
+    if (n <= SERIAL_SORT_THRESHOLD)
+    {
+        std::sort(first, first + n, comp);
+        return;
+    }
+    if (n <= scratch)
+    {
+        SampleSortOutOfPlace(pool, first, n, grain, comp);
+        return;
+    }
+
+    // サンプルの中央値で分割する。pivot が最小値だと前半が空になるので、そのときは pivot と等しい要素を前に集める
+    auto gen = std::mt19937_64{SAMPLE_SEED ^ n};
+    auto dist = std::uniform_int_distribution<std::size_t>(0, n - 1);
+    auto sample = std::vector<V>();
+    for (std::size_t i = 0; i < OVERSAMPLING * 2; ++i)
+    {
+        sample.push_back(first[dist(gen)]);
+    }
+    std::nth_element(sample.begin(), sample.begin() + OVERSAMPLING, sample.end(), comp);
+    const auto& pivot = sample[OVERSAMPLING];
+
+    auto left = ParallelPartition(pool, first, n, grain, [&](const V& v) { return comp(v, pivot); });
+    auto right_first = left;
+    if (left == 0)
+    {
+        right_first = ParallelPartition(pool, first, n, grain, [&](const V& v) { return !comp(pivot, v); });
+    }
+
+    const auto recurse = [&](std::size_t side) {
+        if (side == 0)
+        {
+            SampleSort(pool, first, left, grain, scratch, comp);
+        }
+        else
+        {
+            SampleSort(pool, first + right_first, n - right_first, grain, scratch, comp);
+        }
+    };
+    if (scratch <= SERIAL_SORT_THRESHOLD)
+    {
+        pool.ParallelFor(0, 2, 1, [&](std::size_t b, std::size_t) { recurse(b); });
+    }
+    else
+    {
+        recurse(0);
+        recurse(1);
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief sort (ThreadPool 版、サンプルソート)
+ *
+ * max_scratch_bytes は同時に確保する作業領域の上限。区間全体が収まればそのままサンプルソートし、
+ * 収まらなければ in-place に分割してから収まる大きさごとにサンプルソートする。
+ * 要素がコピー構築・デフォルト構築できない場合とワーカーが 1 つの場合は std::sort で逐次に並べる。
+ * std::sort と同様に安定ではない。
+ */
+template <std::random_access_iterator It, typename Comp = std::ranges::less>
+    requires std::sortable<It, Comp>
+void sort(
+    const execution::PoolPolicy& policy,
+    It                           first,
+    It                           last,
+    Comp                         comp = {},
+    std::size_t                  max_scratch_bytes = UNBOUNDED_SCRATCH
+)
+{
+    using V = std::iter_value_t<It>;
+
+    const auto n = static_cast<std::size_t>(last - first);
+    auto&      pool = policy.pool();
+    if constexpr (std::copy_constructible<V> && std::default_initializable<V>)
+    {
+        if (pool.size() > 1)
+        {
+            detail::SampleSort(pool, first, n, policy.grain(n), max_scratch_bytes / sizeof(V), comp);
+            return;
+        }
+    }
+    std::sort(first, last, comp);
+}
+
+} // namespace cppreference
@@ -0,0 +1,315 @@
+#pragma once
+
+#include "simd_search.hpp"
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+namespace cppreference
+{
+
+/**
+ * @brief 連続したブロックを並べたコンテナ (std::deque など) の反復子を、ブロックとブロック内の位置に分ける
+ *
+ * 反復子の ++ は毎回ブロックの境界を確かめるので、アルゴリズムをブロックごとの連続した区間 (ポインタ) の
+ * 内側のループに分ければ、境界の確認はブロックごとに 1 回で済み、内側のループはベクトル化できる。
+ * 分けられる反復子では次を定義する (Austern の segmented iterator と同じ形)。
+ *   segment_iterator: ブロックを指す値、local_iterator: ブロック内の要素を指すポインタ
+ *   segment(it), local(it), begin(seg), end(seg), next(seg), compose(seg, local)
+ * 既定ではメンバ型 segmented_iterator_traits を持つ反復子が該当し、それ以外の型はこのテンプレートを特殊化する。
+ */
+template <typename It>
+struct SegmentedIteratorTraits
+{
+    using is_segmented = std::false_type;
+};
+
+template <typename It>
+    requires requires { typename It::segmented_iterator_traits; }
+struct SegmentedIteratorTraits<It> : It::segmented_iterator_traits
+{
+};
+
+#if defined(__GLIBCXX__)
+// libstdc++ の std::deque は 512 バイトのブロックの配列 (map) を持ち、反復子はブロックの中と map の位置を持つ
+template <typename T, typename Ref, typename Ptr>
+struct SegmentedIteratorTraits<std::_Deque_iterator<T, Ref, Ptr>>
+{
+    using is_segmented = std::true_type;
+    using iterator = std::_Deque_iterator<T, Ref, Ptr>;
+    using segment_iterator = typename iterator::_Map_pointer;
+    using local_iterator = Ptr;
+
+    static auto segment(
+        const iterator& it
+    ) -> segment_iterator
+    {
+        return it._M_node;
+    }
+
+    static auto local(
+        const iterator& it
+    ) -> local_iterator
+    {
+        return it._M_cur;
+    }
+
+    static auto begin(
+        segment_iterator seg
+    ) -> local_iterator
+    {
+        return *seg;
+    }
+
+    static auto end(
+        segment_iterator seg
+    ) -> local_iterator
+    {
+        return *seg + iterator::_S_buffer_size();
+    }
+
+    static auto next(
+        segment_iterator seg
+    ) -> segment_iterator
+    {
+        return seg + 1;
+    }
+
+    /**
+     * @brief ブロックの末尾を指すなら次のブロックの先頭にする (deque の反復子はブロックの末尾を指さない)
+     */
+    static auto compose(
+        segment_iterator seg,
+        local_iterator   p
+    ) -> iterator
+    {
+        if (p == end(seg))
+        {
+            return iterator(*(seg + 1), seg + 1);
+        }
+        return iterator(const_cast<T*>(p), seg); // NOLINT
+    }
+};
+#endif
+
+template <typename It>
+concept SegmentedIterator = std::forward_iterator<It> && SegmentedIteratorTraits<It>::is_segmented::value;
+
+namespace detail
+{
+
+/**
+ * @brief [first, last) をブロックごとの連続した区間 [b, e) に分けて、先頭から順に f(b, e) を呼ぶ
+ */
+template <SegmentedIterator It, typename F>
+void ForEachSegment(
+    It  first,
+    It  last,
+    F&& f
+)
+{
+    using Traits = SegmentedIteratorTraits<It>;
+
+    auto       seg = Traits::segment(first);
+    const auto last_seg = Traits::segment(last);
+    if (seg == last_seg)
+    {
+        f(Traits::local(first), Traits::local(last));
+        return;
+    }
+    f(Traits::local(first), Traits::end(seg));
+    for (seg = Traits::next(seg); seg != last_seg; seg = Traits::next(seg))
+    {
+        f(Traits::begin(seg), Traits::end(seg));
+    }
+    f(Traits::begin(last_seg), Traits::local(last));
+}
+
+/**
+ * @brief 連続した区間 [b, e) を d_first にコピーする (出力もブロックに分けられるなら、出力のブロックごとに分ける)
+ */
+template <typename P, typename Out>
+auto CopyContiguous(
+    P   b,
+    P   e,
+    Out d_first
+) -> Out
+{
+    if (b == e)
+    {
+        return d_first; // 末尾の空のブロック: d_first が end() でもたどらない
+    }
+    if constexpr (SegmentedIterator<Out>)
+    {
+        using Traits = SegmentedIteratorTraits<Out>;
+
+        auto seg = Traits::segment(d_first);
+        auto out = Traits::local(d_first);
+        while (b != e)
+        {
+            if (out == Traits::end(seg))
+            {
+                seg = Traits::next(seg);
+                out = Traits::begin(seg);
+            }
+            const auto k = std::min<std::ptrdiff_t>(e - b, Traits::end(seg) - out);
+            out = std::copy(b, b + k, out);
+            b += k;
+        }
+        return Traits::compose(seg, out);
+    }
+    else
+    {
+        return std::copy(b, e, d_first);
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief std::for_each 互換。SegmentedIterator ならブロックごとの内側のループにする
+ */
+template <std::forward_iterator It, typename F>
+auto for_each(
+    It first,
+    It last,
+    F  f
+) -> F
+{
+    if constexpr (SegmentedIterator<It>)
+    {
+        detail::ForEachSegment(first, last, [&](auto b, auto e) { std::for_each(b, e, std::ref(f)); });
+        return f;
+    }
+    else
+    {
+        return std::for_each(first, last, std::move(f));
+    }
+}
+
+/**
+ * @brief std::fill 互換
+ */
+template <std::forward_iterator It, typename T>
+void fill(
+    It       first,
+    It       last,
+    const T& value
+)
+{
+    if constexpr (SegmentedIterator<It>)
+    {
+        detail::ForEachSegment(first, last, [&](auto b, auto e) { std::fill(b, e, value); });
+    }
+    else
+    {
+        std::fill(first, last, value);
+    }
+}
+
+/**
+ * @brief std::copy 互換。入力のブロックごとに、出力もブロックに分けられるなら出力のブロックごとにコピーする
+ */
+template <std::forward_iterator It, typename Out>
+auto copy(
+    It  first,
+    It  last,
+    Out d_first
+) -> Out
+{
+    if constexpr (SegmentedIterator<It>)
+    {
+        detail::ForEachSegment(first, last, [&](auto b, auto e) { d_first = detail::CopyContiguous(b, e, d_first); });
+        return d_first;
+    }
+    else
+    {
+        return std::copy(first, last, d_first);
+    }
+}
+
+/**
+ * @brief std::find 互換。ブロックの中は simd::find で探す
+ */
+template <std::forward_iterator It, typename T>
+auto find(
+    It       first,
+    It       last,
+    const T& value
+) -> It
+{
+    if constexpr (SegmentedIterator<It>)
+    {
+        using Traits = SegmentedIteratorTraits<It>;
+
+        auto       seg = Traits::segment(first);
+        const auto last_seg = Traits::segment(last);
+        auto       b = Traits::local(first);
+        while (true)
+        {
+            const auto e = (seg == last_seg) ? Traits::local(last) : Traits::end(seg);
+            const auto p = simd::find(b, e, value);
+            if (p != e)
+            {
+                return Traits::compose(seg, p);
+            }
+            if (seg == last_seg)
+            {
+                return last;
+            }
+            seg = Traits::next(seg);
+            b = Traits::begin(seg);
+        }
+    }
+    else
+    {
+        return std::find(first, last, value);
+    }
+}
+
+/**
+ * @brief std::reduce 互換。std::reduce と同様に op は結合的かつ可換である必要がある
+ */
+template <std::forward_iterator It, typename T, typename BinaryOp>
+auto reduce(
+    It       first,
+    It       last,
+    T        init,
+    BinaryOp op
+) -> T
+{
+    if constexpr (SegmentedIterator<It>)
+    {
+        detail::ForEachSegment(first, last, [&](auto b, auto e) { init = std::reduce(b, e, std::move(init), op); });
+        return init;
+    }
+    else
+    {
+        return std::reduce(first, last, std::move(init), op);
+    }
+}
+
+template <std::forward_iterator It, typename T>
+auto reduce(
+    It first,
+    It last,
+    T  init
+) -> T
+{
+    return cppreference::reduce(first, last, std::move(init), std::plus<>());
+}
+
+template <std::forward_iterator It>
+auto reduce(
+    It first,
+    It last
+) -> std::iter_value_t<It>
+{
+    return cppreference::reduce(first, last, std::iter_value_t<It>{}, std::plus<>());
+}
+
+} // namespace cppreference
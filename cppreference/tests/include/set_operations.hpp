@@ -0,0 +1,410 @@
+#pragma once
+
+#include "radix_sort.hpp"
+#include "simd_search.hpp"
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace cppreference
+{
+
+/**
+ * @brief 入力の各列に同じ値が 2 つ以上ないことを示すタグ (std::sorted_unique と同じ意味)
+ */
+struct sorted_unique_t
+{
+    explicit sorted_unique_t() = default;
+};
+
+inline constexpr sorted_unique_t sorted_unique{};
+
+namespace detail
+{
+
+// 長い方が短い方のこの倍以上なら、短い方の各要素で長い方を指数探索する
+inline constexpr std::size_t GALLOP_RATIO = 32;
+
+// 重複がなければ SIMD のブロック比較が使えるので、指数探索に切り替える比はもっと大きい
+inline constexpr std::size_t SIMD_GALLOP_RATIO = 128;
+
+// SIMD のブロック比較ができる要素
+template <typename T, typename Comp>
+concept SimdSetElement = std::integral<T> && sizeof(T) == 4 && IS_LESS<Comp, T>;
+
+/**
+ * @brief [first, last) で value 以上の最初の位置 (first から 1, 2, 4, ... と離れた位置を見てから二分探索する)
+ *
+ * 答えが first から d 離れていれば比較は O(log d) 回で済む
+ */
+template <std::random_access_iterator It, typename T, typename Comp>
+auto Gallop(
+    It       first,
+    It       last,
+    const T& value,
+    Comp&    comp
+) -> It
+{
+    if (first == last || !std::invoke(comp, *first, value))
+    {
+        return first;
+    }
+
+    // first[lo] < value を保つ
+    const auto                 n = last - first;
+    std::iter_difference_t<It> lo = 0;
+    std::iter_difference_t<It> step = 1;
+    while (step < n - lo && std::invoke(comp, first[lo + step], value))
+    {
+        lo += step;
+        step *= 2;
+    }
+    return std::lower_bound(first + lo + 1, first + std::min(n, lo + step), value, comp);
+}
+
+/**
+ * @brief 短い列 small の各要素で長い列 large を指数探索する共通部分
+ *
+ * 同じ値が並んでいても、一致した large の要素を 1 つずつ進めるので std::set_intersection と同じ個数を出す。
+ * 出力するのは常に 1 つ目の列の要素。
+ */
+template <bool SmallIsFirst, typename ItS, typename ItL, typename Out, typename Comp>
+auto GallopIntersection(
+    ItS   small_first,
+    ItS   small_last,
+    ItL   large_first,
+    ItL   large_last,
+    Out   out,
+    Comp& comp
+) -> Out
+{
+    for (; small_first != small_last; ++small_first)
+    {
+        large_first = Gallop(large_first, large_last, *small_first, comp);
+        if (large_first == large_last)
+        {
+            break;
+        }
+        if (!std::invoke(comp, *small_first, *large_first))
+        {
+            if constexpr (SmallIsFirst)
+            {
+                *out = *small_first;
+            }
+            else
+            {
+                *out = *large_first;
+            }
+            ++out;
+            ++large_first;
+        }
+    }
+    return out;
+}
+
+/**
+ * @brief 短い列 small の各要素の間に入る large の区間を指数探索で見つけてまとめてコピーする和集合
+ *
+ * 出力の順序と個数は std::set_union と同じ
+ */
+template <bool SmallIsFirst, typename ItS, typename ItL, typename Out, typename Comp>
+auto GallopUnion(
+    ItS   small_first,
+    ItS   small_last,
+    ItL   large_first,
+    ItL   large_last,
+    Out   out,
+    Comp& comp
+) -> Out
+{
+    for (; small_first != small_last; ++small_first)
+    {
+        const auto pos = Gallop(large_first, large_last, *small_first, comp);
+        out = std::copy(large_first, pos, out);
+        large_first = pos;
+        if (large_first != large_last && !std::invoke(comp, *small_first, *large_first))
+        {
+            if constexpr (SmallIsFirst)
+            {
+                *out = *small_first;
+            }
+            else
+            {
+                *out = *large_first;
+            }
+            ++large_first;
+        }
+        else
+        {
+            *out = *small_first;
+        }
+        ++out;
+    }
+    return std::copy(large_first, large_last, out);
+}
+
+// 長さの比が ratio 以上か
+inline auto IsSkewed(
+    std::size_t n1,
+    std::size_t n2,
+    std::size_t ratio
+) -> bool
+{
+    return std::max(n1, n2) / ratio >= std::max<std::size_t>(1, std::min(n1, n2));
+}
+
+#if CPPREFERENCE_SIMD_X86
+// mask の立っているビットに対応する a の要素を出力する
+template <typename T, typename Out>
+[[gnu::always_inline]] inline auto EmitMatches(
+    const T*      a,
+    std::uint32_t mask,
+    Out           out
+) -> Out
+{
+    for (; mask != 0; mask &= mask - 1)
+    {
+        *out = a[std::countr_zero(mask)];
+        ++out;
+    }
+    return out;
+}
+
+/**
+ * @brief 4 要素ずつのブロック同士を総当たりで比べる共通部分
+ *
+ * b を 1 要素ずつ回転させて 4 回比べれば、a の各要素が b のブロックに含まれるかが分かる。
+ * 最大値の小さい方のブロックを進める (等しければ両方)。重複がないので同じ要素を 2 回出すことはない。
+ */
+template <typename T, typename Out>
+[[gnu::target("sse4.2")]] auto IntersectSse42(
+    const T* a,
+    const T* a_last,
+    const T* b,
+    const T* b_last,
+    Out      out
+) -> Out
+{
+    constexpr std::ptrdiff_t W = 4;
+    constexpr int            ROTATE1 = 0x39; // (1, 2, 3, 0)
+    constexpr int            ROTATE2 = 0x4E; // (2, 3, 0, 1)
+    constexpr int            ROTATE3 = 0x93; // (3, 0, 1, 2)
+
+    while (a_last - a >= W && b_last - b >= W)
+    {
+        const auto va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a)); // NOLINT
+        const auto vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b)); // NOLINT
+        const auto eq = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi32(va, vb), _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, ROTATE1))),
+            _mm_or_si128(
+                _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, ROTATE2)), _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, ROTATE3))
+            )
+        );
+        out = EmitMatches(a, static_cast<std::uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(eq))), out);
+
+        const auto a_max = a[W - 1];
+        const auto b_max = b[W - 1];
+        a += (a_max <= b_max) ? W : 0;
+        b += (b_max <= a_max) ? W : 0;
+    }
+    return std::set_intersection(a, a_last, b, b_last, out);
+}
+
+/**
+ * @brief IntersectSse42 の 8 要素版
+ *
+ * 128 bit レーン内の回転 4 通りと、レーンを入れ替えたものの回転 4 通りで 8 通りを比べる
+ */
+template <typename T, typename Out>
+[[gnu::target("avx2")]] auto IntersectAvx2(
+    const T* a,
+    const T* a_last,
+    const T* b,
+    const T* b_last,
+    Out      out
+) -> Out
+{
+    constexpr std::ptrdiff_t W = 8;
+    constexpr int            ROTATE1 = 0x39;
+    constexpr int            ROTATE2 = 0x4E;
+    constexpr int            ROTATE3 = 0x93;
+    constexpr int            SWAP_LANES = 0x01;
+
+    while (a_last - a >= W && b_last - b >= W)
+    {
+        const auto va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a)); // NOLINT
+        const auto vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b)); // NOLINT
+        const auto vs = _mm256_permute2x128_si256(vb, vb, SWAP_LANES);
+        const auto eq_lane = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi32(va, vb), _mm256_cmpeq_epi32(va, _mm256_shuffle_epi32(vb, ROTATE1))),
+            _mm256_or_si256(
+                _mm256_cmpeq_epi32(va, _mm256_shuffle_epi32(vb, ROTATE2)),
+                _mm256_cmpeq_epi32(va, _mm256_shuffle_epi32(vb, ROTATE3))
+            )
+        );
+        const auto eq_swap = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi32(va, vs), _mm256_cmpeq_epi32(va, _mm256_shuffle_epi32(vs, ROTATE1))),
+            _mm256_or_si256(
+                _mm256_cmpeq_epi32(va, _mm256_shuffle_epi32(vs, ROTATE2)),
+                _mm256_cmpeq_epi32(va, _mm256_shuffle_epi32(vs, ROTATE3))
+            )
+        );
+        const auto eq = _mm256_or_si256(eq_lane, eq_swap);
+        out = EmitMatches(a, static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(eq))), out);
+
+        const auto a_max = a[W - 1];
+        const auto b_max = b[W - 1];
+        a += (a_max <= b_max) ? W : 0;
+        b += (b_max <= a_max) ? W : 0;
+    }
+    return std::set_intersection(a, a_last, b, b_last, out);
+}
+#endif // CPPREFERENCE_SIMD_X86
+
+template <typename T, typename Out>
+auto IntersectDispatch(
+    const T* a,
+    const T* a_last,
+    const T* b,
+    const T* b_last,
+    Out      out
+) -> Out
+{
+#if CPPREFERENCE_SIMD_X86
+    switch (simd::CurrentIsa())
+    {
+    case simd::Isa::Avx2:
+        return IntersectAvx2(a, a_last, b, b_last, std::move(out));
+    case simd::Isa::Sse42:
+        return IntersectSse42(a, a_last, b, b_last, std::move(out));
+    case simd::Isa::Scalar:
+        break;
+    }
+#endif
+    return std::set_intersection(a, a_last, b, b_last, std::move(out));
+}
+
+} // namespace detail
+
+/**
+ * @brief std::set_intersection と同じ結果を返す共通部分
+ *
+ * 長さの比が大きい (転置インデックスのポスティングリストのような) 入力では、
+ * 短い方の各要素で長い方を指数探索するので O(m log(n / m)) で済む。そうでなければ std::set_intersection
+ */
+template <
+    std::input_iterator       It1,
+    std::input_iterator       It2,
+    std::weakly_incrementable Out,
+    typename Comp = std::ranges::less>
+    requires std::mergeable<It1, It2, Out, Comp>
+auto set_intersection(
+    It1  first1,
+    It1  last1,
+    It2  first2,
+    It2  last2,
+    Out  out,
+    Comp comp = {}
+) -> Out
+{
+    if constexpr (std::random_access_iterator<It1> && std::random_access_iterator<It2>)
+    {
+        const auto n1 = static_cast<std::size_t>(last1 - first1);
+        const auto n2 = static_cast<std::size_t>(last2 - first2);
+        if (detail::IsSkewed(n1, n2, detail::GALLOP_RATIO))
+        {
+            if (n1 <= n2)
+            {
+                return detail::GallopIntersection<true>(first1, last1, first2, last2, std::move(out), comp);
+            }
+            return detail::GallopIntersection<false>(first2, last2, first1, last1, std::move(out), comp);
+        }
+    }
+    return std::set_intersection(first1, last1, first2, last2, std::move(out), comp);
+}
+
+/**
+ * @brief set_intersection (重複なしの入力)
+ *
+ * 4 byte 整数の連続した列を昇順で比べるときは、長さの比が小さければ SIMD でブロック同士を比べ、
+ * 大きければ指数探索する。命令セットは simd::CurrentIsa() に従い、Scalar なら重複を許す版と同じ。
+ * それ以外は重複を許す版と同じ。列に重複があると結果は不定
+ */
+template <
+    std::input_iterator       It1,
+    std::input_iterator       It2,
+    std::weakly_incrementable Out,
+    typename Comp = std::ranges::less>
+    requires std::mergeable<It1, It2, Out, Comp>
+auto set_intersection(
+    sorted_unique_t /* tag */,
+    It1  first1,
+    It1  last1,
+    It2  first2,
+    It2  last2,
+    Out  out,
+    Comp comp = {}
+) -> Out
+{
+    using T = std::iter_value_t<It1>;
+    if constexpr (
+        std::contiguous_iterator<It1> && std::contiguous_iterator<It2> && std::same_as<T, std::iter_value_t<It2>> &&
+        detail::SimdSetElement<T, Comp>
+    )
+    {
+        const auto n1 = static_cast<std::size_t>(last1 - first1);
+        const auto n2 = static_cast<std::size_t>(last2 - first2);
+        if (simd::CurrentIsa() != simd::Isa::Scalar && !detail::IsSkewed(n1, n2, detail::SIMD_GALLOP_RATIO))
+        {
+            return detail::IntersectDispatch(
+                std::to_address(first1), std::to_address(last1), std::to_address(first2), std::to_address(last2),
+                std::move(out)
+            );
+        }
+    }
+    return cppreference::set_intersection(first1, last1, first2, last2, std::move(out), std::move(comp));
+}
+
+/**
+ * @brief std::set_union と同じ結果を返す和集合
+ *
+ * 長さの比が大きければ、短い方の各要素の間に入る長い方の区間を指数探索で見つけてまとめてコピーする
+ */
+template <
+    std::input_iterator       It1,
+    std::input_iterator       It2,
+    std::weakly_incrementable Out,
+    typename Comp = std::ranges::less>
+    requires std::mergeable<It1, It2, Out, Comp>
+auto set_union(
+    It1  first1,
+    It1  last1,
+    It2  first2,
+    It2  last2,
+    Out  out,
+    Comp comp = {}
+) -> Out
+{
+    if constexpr (std::random_access_iterator<It1> && std::random_access_iterator<It2>)
+    {
+        const auto n1 = static_cast<std::size_t>(last1 - first1);
+        const auto n2 = static_cast<std::size_t>(last2 - first2);
+        if (detail::IsSkewed(n1, n2, detail::GALLOP_RATIO))
+        {
+            if (n1 <= n2)
+            {
+                return detail::GallopUnion<true>(first1, last1, first2, last2, std::move(out), comp);
+            }
+            return detail::GallopUnion<false>(first2, last2, first1, last1, std::move(out), comp);
+        }
+    }
+    return std::set_union(first1, last1, first2, last2, std::move(out), comp);
+}
+
+} // namespace cppreference
@@ -0,0 +1,979 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define CPPREFERENCE_SIMD_X86 1
+#else
+#define CPPREFERENCE_SIMD_X86 0
+#endif
+
+namespace cppreference::simd
+{
+
+/**
+ * @brief 実行時に選択する命令セット
+ */
+enum class Isa : std::uint8_t
+{
+    Scalar,
+    Sse42,
+    Avx2,
+};
+
+/**
+ * @brief CPU が対応している最上位の命令セット
+ */
+inline auto DetectIsa() -> Isa
+{
+#if CPPREFERENCE_SIMD_X86
+    static const auto isa = []() {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+        {
+            return Isa::Avx2;
+        }
+        if (__builtin_cpu_supports("sse4.2"))
+        {
+            return Isa::Sse42;
+        }
+        return Isa::Scalar;
+    }();
+    return isa;
+#else
+    return Isa::Scalar;
+#endif
+}
+
+namespace detail
+{
+inline auto IsaLimit() -> std::atomic<Isa>&
+{
+    static auto limit = std::atomic<Isa>(Isa::Avx2);
+    return limit;
+}
+} // namespace detail
+
+/**
+ * @brief 使用する命令セットの上限を設定する (テスト・ベンチマークでの比較用)
+ */
+inline void SetIsa(
+    Isa isa
+)
+{
+    detail::IsaLimit().store(isa);
+}
+
+/**
+ * @brief 現在ディスパッチされる命令セット
+ */
+inline auto CurrentIsa() -> Isa
+{
+    return std::min(DetectIsa(), detail::IsaLimit().load(std::memory_order_relaxed));
+}
+
+/**
+ * @brief SIMD 化の対象になる要素型 (bool 以外の 1/2/4/8 byte の算術型)
+ */
+template <typename T>
+concept Element = std::is_arithmetic_v<T> && !std::same_as<T, bool> &&
+                  (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+enum class Op : std::uint8_t
+{
+    Eq,
+    Ne,
+    Lt,
+    Le,
+    Gt,
+    Ge,
+};
+
+/**
+ * @brief 「要素 op value」の形の単純な述語
+ *
+ * この形の述語だけが SIMD の比較命令に落とせる
+ */
+template <Op O, Element T>
+struct Compare
+{
+    T value;
+
+    constexpr auto operator()(
+        const T& x
+    ) const -> bool
+    {
+        if constexpr (O == Op::Eq)
+        {
+            return x == value;
+        }
+        else if constexpr (O == Op::Ne)
+        {
+            return x != value;
+        }
+        else if constexpr (O == Op::Lt)
+        {
+            return x < value;
+        }
+        else if constexpr (O == Op::Le)
+        {
+            return x <= value;
+        }
+        else if constexpr (O == Op::Gt)
+        {
+            return x > value;
+        }
+        else
+        {
+            return x >= value;
+        }
+    }
+};
+
+template <Element T>
+constexpr auto eq(
+    T v
+) -> Compare<Op::Eq, T>
+{
+    return {v};
+}
+
+template <Element T>
+constexpr auto ne(
+    T v
+) -> Compare<Op::Ne, T>
+{
+    return {v};
+}
+
+template <Element T>
+constexpr auto lt(
+    T v
+) -> Compare<Op::Lt, T>
+{
+    return {v};
+}
+
+template <Element T>
+constexpr auto le(
+    T v
+) -> Compare<Op::Le, T>
+{
+    return {v};
+}
+
+template <Element T>
+constexpr auto gt(
+    T v
+) -> Compare<Op::Gt, T>
+{
+    return {v};
+}
+
+template <Element T>
+constexpr auto ge(
+    T v
+) -> Compare<Op::Ge, T>
+{
+    return {v};
+}
+
+namespace detail
+{
+
+template <typename T>
+struct IsCompare : std::false_type
+{
+};
+
+template <Op O, typename T>
+struct IsCompare<Compare<O, T>> : std::true_type
+{
+    using value_type = T;
+};
+
+/**
+ * @brief SIMD 版に落とせる (連続メモリの範囲 × 要素型と同じ型の Compare) か
+ */
+template <typename It, typename Pred>
+concept Vectorizable = std::contiguous_iterator<It> && IsCompare<std::remove_cvref_t<Pred>>::value &&
+                       std::same_as<std::iter_value_t<It>, typename IsCompare<std::remove_cvref_t<Pred>>::value_type>;
+
+// ---- scalar ----
+
+template <typename T, typename Pred>
+auto FindScalar(
+    const T* first,
+    const T* last,
+    Pred     pred,
+    bool     want
+) -> const T*
+{
+    for (; first != last; ++first)
+    {
+        if (pred(*first) == want)
+        {
+            return first;
+        }
+    }
+    return last;
+}
+
+template <typename T, typename Pred>
+auto CountScalar(
+    const T* first,
+    const T* last,
+    Pred     pred
+) -> std::ptrdiff_t
+{
+    std::ptrdiff_t n = 0;
+    for (; first != last; ++first)
+    {
+        n += pred(*first) ? 1 : 0;
+    }
+    return n;
+}
+
+template <typename T>
+auto MismatchScalar(
+    const T* first1,
+    const T* last1,
+    const T* first2
+) -> const T*
+{
+    for (; first1 != last1; ++first1, ++first2)
+    {
+        if (!(*first1 == *first2))
+        {
+            return first1;
+        }
+    }
+    return last1;
+}
+
+#if CPPREFERENCE_SIMD_X86
+
+// 比較結果は movemask_epi8 のバイト単位マスクで扱う
+// 1 要素 = sizeof(T) ビットなので、位置は countr_zero / sizeof(T)、個数は popcount / sizeof(T)
+
+// ---- SSE4.2 (128 bit) ----
+
+template <typename T>
+[[gnu::target("sse4.2")]] inline auto Sse42Broadcast(
+    T v
+) -> __m128i
+{
+    if constexpr (std::is_same_v<T, float>)
+    {
+        return _mm_castps_si128(_mm_set1_ps(v));
+    }
+    else if constexpr (std::is_same_v<T, double>)
+    {
+        return _mm_castpd_si128(_mm_set1_pd(v));
+    }
+    else if constexpr (sizeof(T) == 1)
+    {
+        return _mm_set1_epi8(static_cast<char>(v));
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        return _mm_set1_epi16(static_cast<short>(v));
+    }
+    else if constexpr (sizeof(T) == 4)
+    {
+        return _mm_set1_epi32(static_cast<int>(v));
+    }
+    else
+    {
+        return _mm_set1_epi64x(static_cast<long long>(v));
+    }
+}
+
+template <typename T>
+[[gnu::target("sse4.2")]] inline auto Sse42Eq(
+    __m128i a,
+    __m128i b
+) -> __m128i
+{
+    if constexpr (sizeof(T) == 1)
+    {
+        return _mm_cmpeq_epi8(a, b);
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        return _mm_cmpeq_epi16(a, b);
+    }
+    else if constexpr (sizeof(T) == 4)
+    {
+        return _mm_cmpeq_epi32(a, b);
+    }
+    else
+    {
+        return _mm_cmpeq_epi64(a, b);
+    }
+}
+
+// a > b (整数)。符号なしは符号ビットを反転して符号付き比較にする
+template <typename T>
+[[gnu::target("sse4.2")]] inline auto Sse42Gt(
+    __m128i a,
+    __m128i b
+) -> __m128i
+{
+    if constexpr (std::is_unsigned_v<T>)
+    {
+        using S = std::make_signed_t<T>;
+        const auto bias = Sse42Broadcast<S>(std::numeric_limits<S>::min());
+        return Sse42Gt<S>(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias));
+    }
+    else if constexpr (sizeof(T) == 1)
+    {
+        return _mm_cmpgt_epi8(a, b);
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        return _mm_cmpgt_epi16(a, b);
+    }
+    else if constexpr (sizeof(T) == 4)
+    {
+        return _mm_cmpgt_epi32(a, b);
+    }
+    else
+    {
+        return _mm_cmpgt_epi64(a, b);
+    }
+}
+
+[[gnu::target("sse4.2")]] inline auto Sse42MoveMask(
+    __m128i m
+) -> std::uint32_t
+{
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(m));
+}
+
+template <Op O, typename T>
+[[gnu::target("sse4.2")]] inline auto Sse42Mask(
+    __m128i x,
+    __m128i v
+) -> std::uint32_t
+{
+    constexpr std::uint32_t FULL = 0xFFFF;
+
+    if constexpr (std::is_same_v<T, float>)
+    {
+        const auto a = _mm_castsi128_ps(x);
+        const auto b = _mm_castsi128_ps(v);
+        if constexpr (O == Op::Eq)
+        {
+            return Sse42MoveMask(_mm_castps_si128(_mm_cmpeq_ps(a, b)));
+        }
+        else if constexpr (O == Op::Ne)
+        {
+            return Sse42MoveMask(_mm_castps_si128(_mm_cmpneq_ps(a, b)));
+        }
+        else if constexpr (O == Op::Lt)
+        {
+            return Sse42MoveMask(_mm_castps_si128(_mm_cmplt_ps(a, b)));
+        }
+        else if constexpr (O == Op::Le)
+        {
+            return Sse42MoveMask(_mm_castps_si128(_mm_cmple_ps(a, b)));
+        }
+        else if constexpr (O == Op::Gt)
+        {
+            return Sse42MoveMask(_mm_castps_si128(_mm_cmpgt_ps(a, b)));
+        }
+        else
+        {
+            return Sse42MoveMask(_mm_castps_si128(_mm_cmpge_ps(a, b)));
+        }
+    }
+    else if constexpr (std::is_same_v<T, double>)
+    {
+        const auto a = _mm_castsi128_pd(x);
+        const auto b = _mm_castsi128_pd(v);
+        if constexpr (O == Op::Eq)
+        {
+            return Sse42MoveMask(_mm_castpd_si128(_mm_cmpeq_pd(a, b)));
+        }
+        else if constexpr (O == Op::Ne)
+        {
+            return Sse42MoveMask(_mm_castpd_si128(_mm_cmpneq_pd(a, b)));
+        }
+        else if constexpr (O == Op::Lt)
+        {
+            return Sse42MoveMask(_mm_castpd_si128(_mm_cmplt_pd(a, b)));
+        }
+        else if constexpr (O == Op::Le)
+        {
+            return Sse42MoveMask(_mm_castpd_si128(_mm_cmple_pd(a, b)));
+        }
+        else if constexpr (O == Op::Gt)
+        {
+            return Sse42MoveMask(_mm_castpd_si128(_mm_cmpgt_pd(a, b)));
+        }
+        else
+        {
+            return Sse42MoveMask(_mm_castpd_si128(_mm_cmpge_pd(a, b)));
+        }
+    }
+    else if constexpr (O == Op::Eq)
+    {
+        return Sse42MoveMask(Sse42Eq<T>(x, v));
+    }
+    else if constexpr (O == Op::Ne)
+    {
+        return ~Sse42MoveMask(Sse42Eq<T>(x, v)) & FULL;
+    }
+    else if constexpr (O == Op::Gt)
+    {
+        return Sse42MoveMask(Sse42Gt<T>(x, v));
+    }
+    else if constexpr (O == Op::Le)
+    {
+        return ~Sse42MoveMask(Sse42Gt<T>(x, v)) & FULL;
+    }
+    else if constexpr (O == Op::Lt)
+    {
+        return Sse42MoveMask(Sse42Gt<T>(v, x));
+    }
+    else
+    {
+        return ~Sse42MoveMask(Sse42Gt<T>(v, x)) & FULL;
+    }
+}
+
+template <Op O, typename T>
+[[gnu::target("sse4.2")]] auto FindSse42(
+    const T*      first,
+    const T*      last,
+    Compare<O, T> pred,
+    bool          want
+) -> const T*
+{
+    constexpr std::ptrdiff_t W = 16 / sizeof(T);
+    constexpr std::uint32_t  FULL = 0xFFFF;
+
+    const auto v = Sse42Broadcast<T>(pred.value);
+    for (; last - first >= W; first += W)
+    {
+        auto m = Sse42Mask<O, T>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)), v); // NOLINT
+        m = want ? m : (~m & FULL);
+        if (m != 0)
+        {
+            return first + (std::countr_zero(m) / sizeof(T));
+        }
+    }
+    return FindScalar(first, last, pred, want);
+}
+
+template <Op O, typename T>
+[[gnu::target("sse4.2")]] auto CountSse42(
+    const T*      first,
+    const T*      last,
+    Compare<O, T> pred
+) -> std::ptrdiff_t
+{
+    constexpr std::ptrdiff_t W = 16 / sizeof(T);
+
+    const auto  v = Sse42Broadcast<T>(pred.value);
+    std::size_t bits = 0;
+    for (; last - first >= W; first += W)
+    {
+        bits += std::popcount(Sse42Mask<O, T>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)), v)); // NOLINT
+    }
+    return static_cast<std::ptrdiff_t>(bits / sizeof(T)) + CountScalar(first, last, pred);
+}
+
+template <typename T>
+[[gnu::target("sse4.2")]] auto MismatchSse42(
+    const T* first1,
+    const T* last1,
+    const T* first2
+) -> const T*
+{
+    constexpr std::ptrdiff_t W = 16 / sizeof(T);
+    constexpr std::uint32_t  FULL = 0xFFFF;
+
+    for (; last1 - first1 >= W; first1 += W, first2 += W)
+    {
+        const auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first1)); // NOLINT
+        const auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first2)); // NOLINT
+        const auto m = ~Sse42Mask<Op::Eq, T>(a, b) & FULL;
+        if (m != 0)
+        {
+            return first1 + (std::countr_zero(m) / sizeof(T));
+        }
+    }
+    return MismatchScalar(first1, last1, first2);
+}
+
+// ---- AVX2 (256 bit) ----
+
+template <typename T>
+[[gnu::target("avx2")]] inline auto Avx2Broadcast(
+    T v
+) -> __m256i
+{
+    if constexpr (std::is_same_v<T, float>)
+    {
+        return _mm256_castps_si256(_mm256_set1_ps(v));
+    }
+    else if constexpr (std::is_same_v<T, double>)
+    {
+        return _mm256_castpd_si256(_mm256_set1_pd(v));
+    }
+    else if constexpr (sizeof(T) == 1)
+    {
+        return _mm256_set1_epi8(static_cast<char>(v));
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        return _mm256_set1_epi16(static_cast<short>(v));
+    }
+    else if constexpr (sizeof(T) == 4)
+    {
+        return _mm256_set1_epi32(static_cast<int>(v));
+    }
+    else
+    {
+        return _mm256_set1_epi64x(static_cast<long long>(v));
+    }
+}
+
+template <typename T>
+[[gnu::target("avx2")]] inline auto Avx2Eq(
+    __m256i a,
+    __m256i b
+) -> __m256i
+{
+    if constexpr (sizeof(T) == 1)
+    {
+        return _mm256_cmpeq_epi8(a, b);
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        return _mm256_cmpeq_epi16(a, b);
+    }
+    else if constexpr (sizeof(T) == 4)
+    {
+        return _mm256_cmpeq_epi32(a, b);
+    }
+    else
+    {
+        return _mm256_cmpeq_epi64(a, b);
+    }
+}
+
+template <typename T>
+[[gnu::target("avx2")]] inline auto Avx2Gt(
+    __m256i a,
+    __m256i b
+) -> __m256i
+{
+    if constexpr (std::is_unsigned_v<T>)
+    {
+        using S = std::make_signed_t<T>;
+        const auto bias = Avx2Broadcast<S>(std::numeric_limits<S>::min());
+        return Avx2Gt<S>(_mm256_xor_si256(a, bias), _mm256_xor_si256(b, bias));
+    }
+    else if constexpr (sizeof(T) == 1)
+    {
+        return _mm256_cmpgt_epi8(a, b);
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        return _mm256_cmpgt_epi16(a, b);
+    }
+    else if constexpr (sizeof(T) == 4)
+    {
+        return _mm256_cmpgt_epi32(a, b);
+    }
+    else
+    {
+        return _mm256_cmpgt_epi64(a, b);
+    }
+}
+
+template <Op O>
+constexpr auto AvxPredicate() -> int
+{
+    if constexpr (O == Op::Eq)
+    {
+        return _CMP_EQ_OQ;
+    }
+    else if constexpr (O == Op::Ne)
+    {
+        return _CMP_NEQ_UQ; // NaN != x は true
+    }
+    else if constexpr (O == Op::Lt)
+    {
+        return _CMP_LT_OQ;
+    }
+    else if constexpr (O == Op::Le)
+    {
+        return _CMP_LE_OQ;
+    }
+    else if constexpr (O == Op::Gt)
+    {
+        return _CMP_GT_OQ;
+    }
+    else
+    {
+        return _CMP_GE_OQ;
+    }
+}
+
+[[gnu::target("avx2")]] inline auto Avx2MoveMask(
+    __m256i m
+) -> std::uint32_t
+{
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(m));
+}
+
+template <Op O, typename T>
+[[gnu::target("avx2")]] inline auto Avx2Mask(
+    __m256i x,
+    __m256i v
+) -> std::uint32_t
+{
+    constexpr int P = AvxPredicate<O>(); // 即値で渡す必要がある
+
+    if constexpr (std::is_same_v<T, float>)
+    {
+        return Avx2MoveMask(_mm256_castps_si256(
+            _mm256_cmp_ps(_mm256_castsi256_ps(x), _mm256_castsi256_ps(v), P)
+        ));
+    }
+    else if constexpr (std::is_same_v<T, double>)
+    {
+        return Avx2MoveMask(_mm256_castpd_si256(
+            _mm256_cmp_pd(_mm256_castsi256_pd(x), _mm256_castsi256_pd(v), P)
+        ));
+    }
+    else if constexpr (O == Op::Eq)
+    {
+        return Avx2MoveMask(Avx2Eq<T>(x, v));
+    }
+    else if constexpr (O == Op::Ne)
+    {
+        return ~Avx2MoveMask(Avx2Eq<T>(x, v));
+    }
+    else if constexpr (O == Op::Gt)
+    {
+        return Avx2MoveMask(Avx2Gt<T>(x, v));
+    }
+    else if constexpr (O == Op::Le)
+    {
+        return ~Avx2MoveMask(Avx2Gt<T>(x, v));
+    }
+    else if constexpr (O == Op::Lt)
+    {
+        return Avx2MoveMask(Avx2Gt<T>(v, x));
+    }
+    else
+    {
+        return ~Avx2MoveMask(Avx2Gt<T>(v, x));
+    }
+}
+
+template <Op O, typename T>
+[[gnu::target("avx2")]] auto FindAvx2(
+    const T*      first,
+    const T*      last,
+    Compare<O, T> pred,
+    bool          want
+) -> const T*
+{
+    constexpr std::ptrdiff_t W = 32 / sizeof(T);
+
+    const auto v = Avx2Broadcast<T>(pred.value);
+    for (; last - first >= W; first += W)
+    {
+        auto m = Avx2Mask<O, T>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first)), v); // NOLINT
+        m = want ? m : ~m;
+        if (m != 0)
+        {
+            return first + (std::countr_zero(m) / sizeof(T));
+        }
+    }
+    return FindScalar(first, last, pred, want);
+}
+
+template <Op O, typename T>
+[[gnu::target("avx2")]] auto CountAvx2(
+    const T*      first,
+    const T*      last,
+    Compare<O, T> pred
+) -> std::ptrdiff_t
+{
+    constexpr std::ptrdiff_t W = 32 / sizeof(T);
+
+    const auto  v = Avx2Broadcast<T>(pred.value);
+    std::size_t bits = 0;
+    for (; last - first >= W; first += W)
+    {
+        bits += std::popcount(Avx2Mask<O, T>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first)), v)); // NOLINT
+    }
+    return static_cast<std::ptrdiff_t>(bits / sizeof(T)) + CountScalar(first, last, pred);
+}
+
+template <typename T>
+[[gnu::target("avx2")]] auto MismatchAvx2(
+    const T* first1,
+    const T* last1,
+    const T* first2
+) -> const T*
+{
+    constexpr std::ptrdiff_t W = 32 / sizeof(T);
+
+    for (; last1 - first1 >= W; first1 += W, first2 += W)
+    {
+        const auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first1)); // NOLINT
+        const auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first2)); // NOLINT
+        const auto m = ~Avx2Mask<Op::Eq, T>(a, b);
+        if (m != 0)
+        {
+            return first1 + (std::countr_zero(m) / sizeof(T));
+        }
+    }
+    return MismatchScalar(first1, last1, first2);
+}
+
+#endif // CPPREFERENCE_SIMD_X86
+
+template <Op O, typename T>
+auto FindDispatch(
+    const T*      first,
+    const T*      last,
+    Compare<O, T> pred,
+    bool          want
+) -> const T*
+{
+#if CPPREFERENCE_SIMD_X86
+    switch (CurrentIsa())
+    {
+    case Isa::Avx2:
+        return FindAvx2(first, last, pred, want);
+    case Isa::Sse42:
+        return FindSse42(first, last, pred, want);
+    case Isa::Scalar:
+        break;
+    }
+#endif
+    return FindScalar(first, last, pred, want);
+}
+
+template <Op O, typename T>
+auto CountDispatch(
+    const T*      first,
+    const T*      last,
+    Compare<O, T> pred
+) -> std::ptrdiff_t
+{
+#if CPPREFERENCE_SIMD_X86
+    switch (CurrentIsa())
+    {
+    case Isa::Avx2:
+        return CountAvx2(first, last, pred);
+    case Isa::Sse42:
+        return CountSse42(first, last, pred);
+    case Isa::Scalar:
+        break;
+    }
+#endif
+    return CountScalar(first, last, pred);
+}
+
+template <typename T>
+auto MismatchDispatch(
+    const T* first1,
+    const T* last1,
+    const T* first2
+) -> const T*
+{
+#if CPPREFERENCE_SIMD_X86
+    switch (CurrentIsa())
+    {
+    case Isa::Avx2:
+        return MismatchAvx2(first1, last1, first2);
+    case Isa::Sse42:
+        return MismatchSse42(first1, last1, first2);
+    case Isa::Scalar:
+        break;
+    }
+#endif
+    return MismatchScalar(first1, last1, first2);
+}
+
+/**
+ * @brief pred(*it) == want となる最初の位置
+ */
+template <typename It, typename Pred>
+auto FindIf(
+    It   first,
+    It   last,
+    Pred pred,
+    bool want
+) -> It
+{
+    if constexpr (Vectorizable<It, Pred>)
+    {
+        const auto* p = std::to_address(first);
+        const auto* q = FindDispatch(p, p + (last - first), pred, want);
+        return first + (q - p);
+    }
+    else
+    {
+        return std::find_if(first, last, [&](const auto& v) { return static_cast<bool>(pred(v)) == want; });
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief std::find_if 互換。連続メモリの算術型 × Compare 述語なら SIMD で走査する
+ */
+template <std::input_iterator It, typename Pred>
+auto find_if(
+    It   first,
+    It   last,
+    Pred pred
+) -> It
+{
+    return detail::FindIf(first, last, pred, true);
+}
+
+template <std::input_iterator It, typename Pred>
+auto find_if_not(
+    It   first,
+    It   last,
+    Pred pred
+) -> It
+{
+    return detail::FindIf(first, last, pred, false);
+}
+
+/**
+ * @brief std::find 互換。要素型と value の型が一致するときだけ SIMD 化する
+ */
+template <std::input_iterator It, typename T>
+auto find(
+    It       first,
+    It       last,
+    const T& value
+) -> It
+{
+    if constexpr (std::contiguous_iterator<It> && Element<std::iter_value_t<It>> &&
+                  std::same_as<std::iter_value_t<It>, T>)
+    {
+        return detail::FindIf(first, last, eq(value), true);
+    }
+    else
+    {
+        return std::find(first, last, value);
+    }
+}
+
+template <std::input_iterator It, typename Pred>
+auto count_if(
+    It   first,
+    It   last,
+    Pred pred
+) -> std::iter_difference_t<It>
+{
+    if constexpr (detail::Vectorizable<It, Pred>)
+    {
+        const auto* p = std::to_address(first);
+        return detail::CountDispatch(p, p + (last - first), pred);
+    }
+    else
+    {
+        return std::count_if(first, last, pred);
+    }
+}
+
+template <std::input_iterator It, typename T>
+auto count(
+    It       first,
+    It       last,
+    const T& value
+) -> std::iter_difference_t<It>
+{
+    if constexpr (std::contiguous_iterator<It> && Element<std::iter_value_t<It>> &&
+                  std::same_as<std::iter_value_t<It>, T>)
+    {
+        return cppreference::simd::count_if(first, last, eq(value));
+    }
+    else
+    {
+        return std::count(first, last, value);
+    }
+}
+
+template <std::input_iterator It, typename Pred>
+auto all_of(
+    It   first,
+    It   last,
+    Pred pred
+) -> bool
+{
+    return detail::FindIf(first, last, pred, false) == last;
+}
+
+template <std::input_iterator It, typename Pred>
+auto any_of(
+    It   first,
+    It   last,
+    Pred pred
+) -> bool
+{
+    return detail::FindIf(first, last, pred, true) != last;
+}
+
+template <std::input_iterator It, typename Pred>
+auto none_of(
+    It   first,
+    It   last,
+    Pred pred
+) -> bool
+{
+    return detail::FindIf(first, last, pred, true) == last;
+}
+
+/**
+ * @brief std::mismatch 互換。両方が同じ算術型の連続メモリなら SIMD で比較する
+ */
+template <std::input_iterator It1, std::input_iterator It2>
+auto mismatch(
+    It1 first1,
+    It1 last1,
+    It2 first2
+) -> std::pair<It1, It2>
+{
+    using T = std::iter_value_t<It1>;
+    if constexpr (std::contiguous_iterator<It1> && std::contiguous_iterator<It2> && Element<T> &&
+                  std::same_as<T, std::iter_value_t<It2>>)
+    {
+        const auto* p = std::to_address(first1);
+        const auto  n = detail::MismatchDispatch(p, p + (last1 - first1), std::to_address(first2)) - p;
+        return {first1 + n, first2 + n};
+    }
+    else
+    {
+        return std::mismatch(first1, last1, first2);
+    }
+}
+
+} // namespace cppreference::simd
@@ -0,0 +1,660 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace cppreference
+{
+
+/**
+ * @brief 先頭 N 要素をオブジェクト内に置く vector
+ *
+ * 要素数が N 以下の間はヒープを確保しない。N を超えたら std::vector と同じく容量を 2 倍ずつ増やして
+ * ヒープに移す。短命で小さい配列 (関数内の一時的なリストなど) の確保をなくすためのもの。
+ * オブジェクト内に要素を置くので、ムーブでも (ヒープに移っていなければ) 要素を 1 つずつムーブする。
+ */
+template <typename T, std::size_t N>
+    requires(N > 0)
+class SmallVector
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr size_type INLINE_CAPACITY = N;
+
+    SmallVector() = default;
+
+    explicit SmallVector(
+        size_type n
+    )
+    {
+        reserve(n);
+        resize(n);
+    }
+
+    SmallVector(
+        size_type n,
+        const T&  value
+    )
+    {
+        assign(n, value);
+    }
+
+    template <std::input_iterator It>
+    SmallVector(
+        It first,
+        It last
+    )
+    {
+        assign(first, last);
+    }
+
+    SmallVector(
+        std::initializer_list<T> values
+    )
+        : SmallVector(values.begin(), values.end())
+    {
+    }
+
+    SmallVector(
+        const SmallVector& other
+    )
+        : SmallVector(other.begin(), other.end())
+    {
+    }
+
+    SmallVector(
+        SmallVector&& other
+    ) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        Steal(other);
+    }
+
+    auto operator=(
+        const SmallVector& other
+    ) -> SmallVector&
+    {
+        if (this != &other)
+        {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    auto operator=(
+        SmallVector&& other
+    ) noexcept(std::is_nothrow_move_constructible_v<T>) -> SmallVector&
+    {
+        if (this != &other)
+        {
+            clear();
+            Deallocate();
+            Steal(other);
+        }
+        return *this;
+    }
+
+    auto operator=(
+        std::initializer_list<T> values
+    ) -> SmallVector&
+    {
+        assign(values);
+        return *this;
+    }
+
+    ~SmallVector()
+    {
+        clear();
+        Deallocate();
+    }
+
+    void assign(
+        size_type n,
+        const T&  value
+    )
+    {
+        if (n > capacity_)
+        {
+            Rebuild(n, [&](T* fresh) {
+                std::uninitialized_fill_n(fresh, n, value);
+                return n;
+            });
+            return;
+        }
+        std::fill_n(data_, std::min(n, size_), value);
+        if (n > size_)
+        {
+            std::uninitialized_fill_n(data_ + size_, n - size_, value);
+        }
+        else
+        {
+            std::destroy(data_ + n, data_ + size_);
+        }
+        size_ = n;
+    }
+
+    template <std::input_iterator It>
+    void assign(
+        It first,
+        It last
+    )
+    {
+        clear();
+        if constexpr (std::forward_iterator<It>)
+        {
+            reserve(static_cast<size_type>(std::distance(first, last)));
+        }
+        for (; first != last; ++first)
+        {
+            emplace_back(*first);
+        }
+    }
+
+    void assign(
+        std::initializer_list<T> values
+    )
+    {
+        assign(values.begin(), values.end());
+    }
+
+    [[nodiscard]] auto at(
+        size_type i
+    ) -> T&
+    {
+        if (i >= size_)
+        {
+            throw std::out_of_range("SmallVector::at");
+        }
+        return data_[i];
+    }
+
+    [[nodiscard]] auto at(
+        size_type i
+    ) const -> const T&
+    {
+        if (i >= size_)
+        {
+            throw std::out_of_range("SmallVector::at");
+        }
+        return data_[i];
+    }
+
+    [[nodiscard]] auto operator[](
+        size_type i
+    ) -> T&
+    {
+        return data_[i];
+    }
+
+    [[nodiscard]] auto operator[](
+        size_type i
+    ) const -> const T&
+    {
+        return data_[i];
+    }
+
+    [[nodiscard]] auto front() -> T& { return data_[0]; }
+
+    [[nodiscard]] auto front() const -> const T& { return data_[0]; }
+
+    [[nodiscard]] auto back() -> T& { return data_[size_ - 1]; }
+
+    [[nodiscard]] auto back() const -> const T& { return data_[size_ - 1]; }
+
+    [[nodiscard]] auto data() -> T* { return data_; }
+
+    [[nodiscard]] auto data() const -> const T* { return data_; }
+
+    [[nodiscard]] auto begin() -> iterator { return data_; }
+
+    [[nodiscard]] auto begin() const -> const_iterator { return data_; }
+
+    [[nodiscard]] auto end() -> iterator { return data_ + size_; }
+
+    [[nodiscard]] auto end() const -> const_iterator { return data_ + size_; }
+
+    [[nodiscard]] auto cbegin() const -> const_iterator { return begin(); }
+
+    [[nodiscard]] auto cend() const -> const_iterator { return end(); }
+
+    [[nodiscard]] auto rbegin() -> reverse_iterator { return reverse_iterator(end()); }
+
+    [[nodiscard]] auto rbegin() const -> const_reverse_iterator { return const_reverse_iterator(end()); }
+
+    [[nodiscard]] auto rend() -> reverse_iterator { return reverse_iterator(begin()); }
+
+    [[nodiscard]] auto rend() const -> const_reverse_iterator { return const_reverse_iterator(begin()); }
+
+    [[nodiscard]] auto empty() const -> bool { return size_ == 0; }
+
+    [[nodiscard]] auto size() const -> size_type { return size_; }
+
+    [[nodiscard]] auto max_size() const -> size_type
+    {
+        return std::allocator_traits<std::allocator<T>>::max_size(std::allocator<T>());
+    }
+
+    [[nodiscard]] auto capacity() const -> size_type { return capacity_; }
+
+    /**
+     * @brief 要素がオブジェクト内の領域にあるか (ヒープを確保していないか)
+     */
+    [[nodiscard]] auto is_inline() const -> bool { return data_ == Inline(); }
+
+    void reserve(
+        size_type n
+    )
+    {
+        if (n > capacity_)
+        {
+            Rebuild(n, [&](T* fresh) {
+                Relocate(data_, data_ + size_, fresh);
+                return size_;
+            });
+        }
+    }
+
+    /**
+     * @brief 余った容量を返す。N 要素に収まればオブジェクト内の領域に戻す
+     */
+    void shrink_to_fit()
+    {
+        if (is_inline() || size_ == capacity_)
+        {
+            return;
+        }
+        if (size_ > N)
+        {
+            Rebuild(size_, [&](T* fresh) {
+                Relocate(data_, data_ + size_, fresh);
+                return size_;
+            });
+            return;
+        }
+        Relocate(data_, data_ + size_, Inline());
+        std::destroy(data_, data_ + size_);
+        Deallocate();
+        data_ = Inline();
+        capacity_ = N;
+    }
+
+    void clear()
+    {
+        std::destroy(data_, data_ + size_);
+        size_ = 0;
+    }
+
+    /**
+     * @brief 末尾に作ってから pos まで回転させる (args が要素を指していても良い)
+     */
+    template <typename... Args>
+    auto emplace(
+        const_iterator pos,
+        Args&&... args
+    ) -> iterator
+    {
+        const auto i = pos - cbegin();
+        emplace_back(std::forward<Args>(args)...);
+        std::rotate(begin() + i, end() - 1, end());
+        return begin() + i;
+    }
+
+    auto insert(
+        const_iterator pos,
+        const T&       value
+    ) -> iterator
+    {
+        return emplace(pos, value);
+    }
+
+    auto insert(
+        const_iterator pos,
+        T&&            value
+    ) -> iterator
+    {
+        return emplace(pos, std::move(value));
+    }
+
+    auto insert(
+        const_iterator pos,
+        size_type      n,
+        const T&       value
+    ) -> iterator
+    {
+        const auto i = pos - cbegin();
+        const auto old_size = size_;
+        if (size_ + n > capacity_)
+        {
+            // 確保し直すと value が指す要素も動くので先に写す
+            const auto copy = T(value);
+            reserve(Grown(size_ + n));
+            std::uninitialized_fill_n(end(), n, copy);
+        }
+        else
+        {
+            std::uninitialized_fill_n(end(), n, value);
+        }
+        size_ += n;
+        std::rotate(begin() + i, begin() + old_size, end());
+        return begin() + i;
+    }
+
+    /**
+     * @brief [first, last) はこの配列の要素を指さないこと
+     */
+    template <std::input_iterator It>
+    auto insert(
+        const_iterator pos,
+        It             first,
+        It             last
+    ) -> iterator
+    {
+        const auto i = pos - cbegin();
+        const auto old_size = size_;
+        if constexpr (std::forward_iterator<It>)
+        {
+            const auto n = static_cast<size_type>(std::distance(first, last));
+            if (size_ + n > capacity_)
+            {
+                reserve(Grown(size_ + n));
+            }
+        }
+        for (; first != last; ++first)
+        {
+            emplace_back(*first);
+        }
+        std::rotate(begin() + i, begin() + old_size, end());
+        return begin() + i;
+    }
+
+    auto insert(
+        const_iterator           pos,
+        std::initializer_list<T> values
+    ) -> iterator
+    {
+        return insert(pos, values.begin(), values.end());
+    }
+
+    auto erase(
+        const_iterator pos
+    ) -> iterator
+    {
+        return erase(pos, pos + 1);
+    }
+
+    auto erase(
+        const_iterator first,
+        const_iterator last
+    ) -> iterator
+    {
+        const auto i = first - cbegin();
+        const auto n = static_cast<size_type>(last - first);
+        std::move(begin() + i + n, end(), begin() + i);
+        std::destroy(end() - n, end());
+        size_ -= n;
+        return begin() + i;
+    }
+
+    void push_back(
+        const T& value
+    )
+    {
+        emplace_back(value);
+    }
+
+    void push_back(
+        T&& value
+    )
+    {
+        emplace_back(std::move(value));
+    }
+
+    /**
+     * @brief 容量が足りなければ新しい領域に先に要素を作ってから移す (args が要素を指していても良い)
+     */
+    template <typename... Args>
+    auto emplace_back(
+        Args&&... args
+    ) -> T&
+    {
+        if (size_ == capacity_)
+        {
+            Rebuild(Grown(size_ + 1), [&](T* fresh) {
+                std::construct_at(fresh + size_, std::forward<Args>(args)...);
+                try
+                {
+                    Relocate(data_, data_ + size_, fresh);
+                }
+                catch (...)
+                {
+                    std::destroy_at(fresh + size_);
+                    throw;
+                }
+                return size_ + 1;
+            });
+        }
+        else
+        {
+            std::construct_at(data_ + size_, std::forward<Args>(args)...);
+            ++size_;
+        }
+        return back();
+    }
+
+    void pop_back()
+    {
+        --size_;
+        std::destroy_at(data_ + size_);
+    }
+
+    void resize(
+        size_type n
+    )
+    {
+        if (n <= size_)
+        {
+            std::destroy(data_ + n, data_ + size_);
+            size_ = n;
+            return;
+        }
+        if (n > capacity_)
+        {
+            reserve(Grown(n));
+        }
+        std::uninitialized_value_construct(data_ + size_, data_ + n);
+        size_ = n;
+    }
+
+    void resize(
+        size_type n,
+        const T&  value
+    )
+    {
+        if (n <= size_)
+        {
+            resize(n);
+            return;
+        }
+        insert(end(), n - size_, value);
+    }
+
+    void swap(
+        SmallVector& other
+    ) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (!is_inline() && !other.is_inline())
+        {
+            std::swap(data_, other.data_);
+            std::swap(size_, other.size_);
+            std::swap(capacity_, other.capacity_);
+            return;
+        }
+        auto tmp = std::move(other);
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+    friend void swap(
+        SmallVector& a,
+        SmallVector& b
+    ) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        a.swap(b);
+    }
+
+    friend auto operator==(
+        const SmallVector& a,
+        const SmallVector& b
+    ) -> bool
+    {
+        return std::ranges::equal(a, b);
+    }
+
+    friend auto operator<=>(
+        const SmallVector& a,
+        const SmallVector& b
+    )
+        requires std::three_way_comparable<T>
+    {
+        return std::lexicographical_compare_three_way(a.begin(), a.end(), b.begin(), b.end());
+    }
+
+private:
+    [[nodiscard]] auto Inline() -> T* { return reinterpret_cast<T*>(inline_.data()); } // NOLINT
+
+    [[nodiscard]] auto Inline() const -> const T* { return reinterpret_cast<const T*>(inline_.data()); } // NOLINT
+
+    [[nodiscard]] auto Grown(
+        size_type n
+    ) const -> size_type
+    {
+        return std::max(n, 2 * capacity_);
+    }
+
+    /**
+     * @brief ムーブが例外を投げうるならコピーで移す (移している途中で失敗しても元の要素は残る)
+     */
+    static void Relocate(
+        T* first,
+        T* last,
+        T* dest
+    )
+    {
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+        {
+            std::uninitialized_move(first, last, dest);
+        }
+        else
+        {
+            std::uninitialized_copy(first, last, dest);
+        }
+    }
+
+    /**
+     * @brief 容量 capacity の領域を確保し、fill(領域) で要素を作って (戻り値は要素数) 今の領域と取り替える
+     */
+    template <typename Fill>
+    void Rebuild(
+        size_type capacity,
+        Fill&&    fill
+    )
+    {
+        auto*     fresh = std::allocator<T>().allocate(capacity);
+        size_type size = 0;
+        try
+        {
+            size = fill(fresh);
+        }
+        catch (...)
+        {
+            std::allocator<T>().deallocate(fresh, capacity);
+            throw;
+        }
+        clear();
+        Deallocate();
+        data_ = fresh;
+        size_ = size;
+        capacity_ = capacity;
+    }
+
+    void Deallocate()
+    {
+        if (!is_inline())
+        {
+            std::allocator<T>().deallocate(data_, capacity_);
+            data_ = Inline();
+            capacity_ = N;
+        }
+    }
+
+    /**
+     * @brief other の要素を空の *this に移す。ヒープの領域は付け替え、オブジェクト内の要素はムーブする
+     */
+    void Steal(
+        SmallVector& other
+    )
+    {
+        if (other.is_inline())
+        {
+            std::uninitialized_move(other.begin(), other.end(), Inline());
+            size_ = other.size_;
+            other.clear();
+            return;
+        }
+        data_ = other.data_;
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+        other.data_ = other.Inline();
+        other.size_ = 0;
+        other.capacity_ = N;
+    }
+
+    alignas(T) std::array<std::byte, sizeof(T) * N> inline_;
+    T*                                              data_ = Inline();
+    size_type                                       size_ = 0;
+    size_type                                       capacity_ = N;
+};
+
+template <typename T, std::size_t N, typename U>
+auto erase(
+    SmallVector<T, N>& c,
+    const U&           value
+) -> typename SmallVector<T, N>::size_type
+{
+    const auto it = std::remove(c.begin(), c.end(), value);
+    const auto n = static_cast<std::size_t>(c.end() - it);
+    c.erase(it, c.end());
+    return n;
+}
+
+template <typename T, std::size_t N, typename Pred>
+auto erase_if(
+    SmallVector<T, N>& c,
+    Pred               pred
+) -> typename SmallVector<T, N>::size_type
+{
+    const auto it = std::remove_if(c.begin(), c.end(), pred);
+    const auto n = static_cast<std::size_t>(c.end() - it);
+    c.erase(it, c.end());
+    return n;
+}
+
+} // namespace cppreference
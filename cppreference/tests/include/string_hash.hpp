@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace cppreference
+{
+
+/**
+ * @brief std::string / std::string_view / const char* を同じ値にハッシュする透過的なハッシュ
+ *
+ * std::equal_to<> と組み合わせると、std::unordered_map<std::string, T> を std::string_view や文字列リテラルで
+ * 検索するときに一時的な std::string を作らない (長い文字列ではメモリ確保が起きない)。
+ * std::hash<std::string> と std::hash<std::string_view> は同じ文字列に同じ値を返すことが規格で保証されている
+ */
+struct StringHash
+{
+    using is_transparent = void;
+
+    auto operator()(
+        std::string_view s
+    ) const noexcept -> std::size_t
+    {
+        return std::hash<std::string_view>{}(s);
+    }
+};
+
+/**
+ * @brief 透過的な比較 (std::equal_to<> は std::string と std::string_view を直接比べる)
+ */
+using StringEqual = std::equal_to<>;
+
+template <typename T>
+using StringMap = std::unordered_map<std::string, T, StringHash, StringEqual>;
+
+using StringSet = std::unordered_set<std::string, StringHash, StringEqual>;
+
+} // namespace cppreference
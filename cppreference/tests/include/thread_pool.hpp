@@ -0,0 +1,281 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cppreference
+{
+
+/**
+ * @brief work-stealing スレッドプール
+ *
+ * ワーカーごとに deque を持ち、自分のキューは末尾 (LIFO) から、
+ * 他ワーカーのキューは先頭 (FIFO) から盗む。
+ * 完了待ちのスレッドもタスクを実行するので、ワーカー内から入れ子で fork-join しても詰まらない。
+ */
+class ThreadPool
+{
+public:
+    using Task = std::function<void()>;
+
+    explicit ThreadPool(
+        std::size_t n = std::thread::hardware_concurrency()
+    )
+    {
+        n = std::max<std::size_t>(n, 1);
+        queues_.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            queues_.emplace_back(std::make_unique<Queue>());
+        }
+        workers_.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            workers_.emplace_back([this, i]() { Run(i); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    auto operator=(const ThreadPool&) -> ThreadPool& = delete;
+    auto operator=(ThreadPool&&) -> ThreadPool& = delete;
+
+    ~ThreadPool()
+    {
+        {
+            const auto lock = std::scoped_lock(sleep_mutex_);
+            stop_ = true;
+        }
+        sleep_cv_.notify_all();
+        for (auto& w : workers_)
+        {
+            w.join();
+        }
+    }
+
+    /**
+     * @brief プロセス共通のプール (ハードウェアスレッド数)
+     */
+    static auto Instance() -> ThreadPool&
+    {
+        static auto pool = ThreadPool();
+        return pool;
+    }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return workers_.size(); }
+
+    /**
+     * @brief タスクを投入する
+     *
+     * ワーカーからの投入は自分のキューへ、外部スレッドからはラウンドロビンで分散する
+     */
+    void Submit(
+        Task task
+    )
+    {
+        const auto i = (worker_pool_ == this) ? worker_index_ : (next_.fetch_add(1) % queues_.size());
+
+        // 先に数えておけば queued_ が実際のタスク数を下回ることはない
+        {
+            const auto lock = std::scoped_lock(sleep_mutex_);
+            ++queued_;
+        }
+        {
+            const auto lock = std::scoped_lock(queues_[i]->mutex);
+            queues_[i]->tasks.emplace_back(std::move(task));
+        }
+        sleep_cv_.notify_one();
+    }
+
+    /**
+     * @brief キューにあるタスクを 1 つ実行する (なければ false)
+     */
+    auto TryRunOne() -> bool
+    {
+        auto task = Pop();
+        if (!task)
+        {
+            return false;
+        }
+        (*task)();
+        return true;
+    }
+
+    /**
+     * @brief [first, last) を grain 以下の区間に再帰分割して fn(begin, end) を並列実行する
+     *
+     * 呼び出し元は全区間が終わるまでタスクを手伝いながら待つ。
+     * fn が投げた例外は最初の 1 つを呼び出し元で再送出する。
+     */
+    template <typename Fn>
+    void ParallelFor(
+        std::size_t first,
+        std::size_t last,
+        std::size_t grain,
+        Fn&&        fn
+    )
+    {
+        if (first >= last)
+        {
+            return;
+        }
+        grain = std::max<std::size_t>(grain, 1);
+        if (last - first <= grain)
+        {
+            fn(first, last);
+            return;
+        }
+
+        auto state = ForState<std::remove_reference_t<Fn>>{fn, grain, last - first};
+        Split(&state, first, last);
+        while (state.done.load(std::memory_order_acquire) < state.total)
+        {
+            if (!TryRunOne())
+            {
+                std::this_thread::yield();
+            }
+        }
+        if (state.error)
+        {
+            std::rethrow_exception(state.error);
+        }
+    }
+
+private:
+    struct Queue
+    {
+        std::mutex       mutex;
+        std::deque<Task> tasks;
+    };
+
+    template <typename Fn>
+    struct ForState
+    {
+        Fn&                      fn;
+        std::size_t              grain;
+        std::size_t              total;
+        std::atomic<std::size_t> done{0};
+        std::mutex               error_mutex;
+        std::exception_ptr       error;
+    };
+
+    template <typename Fn>
+    void Split(
+        ForState<Fn>* state,
+        std::size_t   first,
+        std::size_t   last
+    )
+    {
+        // 右半分を投入して盗ませ、左半分は自分で続ける
+        while (last - first > state->grain)
+        {
+            const auto mid = first + ((last - first) / 2);
+            Submit([this, state, mid, last]() { Split(state, mid, last); });
+            last = mid;
+        }
+
+        try
+        {
+            state->fn(first, last);
+        }
+        catch (...)
+        {
+            const auto lock = std::scoped_lock(state->error_mutex);
+            if (!state->error)
+            {
+                state->error = std::current_exception();
+            }
+        }
+        state->done.fetch_add(last - first, std::memory_order_release);
+    }
+
+    auto Pop() -> std::optional<Task>
+    {
+        const auto n = queues_.size();
+        const auto self = (worker_pool_ == this) ? worker_index_ : next_.load() % n;
+
+        // 自分のキューは末尾から
+        {
+            auto& q = *queues_[self];
+            const auto lock = std::scoped_lock(q.mutex);
+            if (!q.tasks.empty())
+            {
+                auto task = std::move(q.tasks.back());
+                q.tasks.pop_back();
+                Consumed();
+                return task;
+            }
+        }
+
+        // 他のキューは先頭から盗む
+        for (std::size_t k = 1; k < n; ++k)
+        {
+            auto& q = *queues_[(self + k) % n];
+            const auto lock = std::scoped_lock(q.mutex);
+            if (!q.tasks.empty())
+            {
+                auto task = std::move(q.tasks.front());
+                q.tasks.pop_front();
+                Consumed();
+                return task;
+            }
+        }
+        return std::nullopt;
+    }
+
+    void Consumed()
+    {
+        const auto lock = std::scoped_lock(sleep_mutex_);
+        --queued_;
+    }
+
+    void Run(
+        std::size_t index
+    )
+    {
+        worker_pool_ = this;
+        worker_index_ = index;
+
+        while (true)
+        {
+            if (TryRunOne())
+            {
+                continue;
+            }
+
+            auto lock = std::unique_lock(sleep_mutex_);
+            sleep_cv_.wait(lock, [this]() { return stop_ || queued_ > 0; });
+            if (stop_ && queued_ == 0)
+            {
+                return;
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread>            workers_;
+    std::atomic<std::size_t>            next_{0};
+
+    std::mutex              sleep_mutex_;
+    std::condition_variable sleep_cv_;
+    std::size_t             queued_ = 0;
+    bool                    stop_ = false;
+
+    // 現在のスレッドがどのプールの何番目のワーカーか
+    static inline thread_local ThreadPool* worker_pool_ = nullptr;
+    static inline thread_local std::size_t worker_index_ = 0;
+};
+
+} // namespace cppreference
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <type_traits>
+
+namespace cppreference
+{
+
+/**
+ * @brief T をバイト列のコピー (memcpy / memmove / realloc) で別の場所に移し、元を破棄しなくてよいか
+ *
+ * 「新しい場所にムーブ構築して元をデストラクトする」のと、バイト列を写して元を忘れるのが同じ結果になる型。
+ * 自分自身のアドレスを持たない (SSO の std::string や SmallVector は該当しない) ことが条件。
+ * 既定ではトリビアルにコピーできる型と、メンバ型 is_trivially_relocatable = std::true_type を持つ型が該当し、
+ * それ以外の型はこのテンプレートを特殊化して宣言する。
+ */
+template <typename T>
+struct IsTriviallyRelocatable
+    : std::bool_constant<std::is_trivially_copyable_v<T> || requires { requires T::is_trivially_relocatable::value; }>
+{
+};
+
+// libstdc++ / libc++ の std::unique_ptr は (既定のデリータなら) ポインタ 1 つ
+template <typename T>
+struct IsTriviallyRelocatable<std::unique_ptr<T>> : std::true_type
+{
+};
+
+template <typename T>
+concept TriviallyRelocatable = IsTriviallyRelocatable<std::remove_cv_t<T>>::value;
+
+} // namespace cppreference
@@ -0,0 +1,820 @@
+#pragma once
+
+#include "cache_line.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cppreference
+{
+
+/**
+ * @brief 1 つのノードに複数の要素を並べて持つ単方向リスト (unrolled linked list)
+ *
+ * ノードは NodeBytes (既定はキャッシュライン 1 本) に収まるだけの要素を持ち、キャッシュラインに揃えて確保する。
+ * 走査で辿るポインタが要素数 / CAPACITY 回になるので、std::forward_list より走査が速い。
+ * insert_after は満杯のノードを半分に分け、erase_after で空になったノードは外す。
+ * 反復子は std::forward_list と違い、同じノードへの挿入・削除で無効になる (要素がノード内で動くので)。
+ */
+template <typename T, std::size_t NodeBytes = detail::CACHE_LINE>
+class UnrolledForwardList
+{
+    struct NodeBase
+    {
+        NodeBase*   next = nullptr;
+        std::size_t count = 0;
+    };
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+    /**
+     * @brief 1 つのノードに入る要素数 (少なくとも 1)
+     */
+    static constexpr size_type CAPACITY = std::max<size_type>(1, (NodeBytes - sizeof(NodeBase)) / sizeof(T));
+
+private:
+    struct alignas(detail::CACHE_LINE) Node : NodeBase
+    {
+        auto at(
+            size_type i
+        ) -> T*
+        {
+            return std::launder(reinterpret_cast<T*>(storage.data()) + i); // NOLINT
+        }
+
+        alignas(T) std::array<std::byte, sizeof(T) * CAPACITY> storage;
+    };
+
+    template <bool Const>
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        /**
+         * @brief ノードをブロックとして扱う SegmentedIteratorTraits (end() のブロックは nullptr で、要素を持たない)
+         */
+        struct segmented_iterator_traits
+        {
+            using is_segmented = std::true_type;
+            using segment_iterator = NodeBase*;
+            using local_iterator = pointer;
+
+            static auto segment(
+                const Iterator& it
+            ) -> NodeBase*
+            {
+                return it.node_;
+            }
+
+            static auto local(
+                const Iterator& it
+            ) -> pointer
+            {
+                return begin(it.node_) + it.i_;
+            }
+
+            static auto begin(
+                NodeBase* seg
+            ) -> pointer
+            {
+                return (seg != nullptr) ? static_cast<Node*>(seg)->at(0) : nullptr;
+            }
+
+            static auto end(
+                NodeBase* seg
+            ) -> pointer
+            {
+                return (seg != nullptr) ? begin(seg) + seg->count : nullptr;
+            }
+
+            static auto next(
+                NodeBase* seg
+            ) -> NodeBase*
+            {
+                return seg->next;
+            }
+
+            static auto compose(
+                NodeBase* seg,
+                pointer   p
+            ) -> Iterator
+            {
+                if (seg == nullptr)
+                {
+                    return {};
+                }
+                if (p == end(seg))
+                {
+                    return {seg->next, 0};
+                }
+                return {seg, static_cast<size_type>(p - begin(seg))};
+            }
+        };
+
+        Iterator() = default;
+
+        template <bool C>
+            requires(Const && !C)
+        Iterator( // NOLINT
+            const Iterator<C>& other
+        )
+            : node_(other.node_), i_(other.i_)
+        {
+        }
+
+        auto operator*() const -> reference { return *static_cast<Node*>(node_)->at(i_); }
+
+        auto operator->() const -> pointer { return static_cast<Node*>(node_)->at(i_); }
+
+        auto operator++() -> Iterator&
+        {
+            if (++i_ >= node_->count)
+            {
+                node_ = node_->next;
+                i_ = 0;
+            }
+            return *this;
+        }
+
+        auto operator++(int) -> Iterator
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        friend auto operator==(
+            const Iterator& a,
+            const Iterator& b
+        ) -> bool
+        {
+            return a.node_ == b.node_ && a.i_ == b.i_;
+        }
+
+    private:
+        friend class UnrolledForwardList;
+        template <bool C>
+        friend class Iterator;
+
+        Iterator(
+            NodeBase* node,
+            size_type i
+        )
+            : node_(node), i_(i)
+        {
+        }
+
+        NodeBase* node_ = nullptr;
+        size_type i_ = 0;
+    };
+
+public:
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    UnrolledForwardList() = default;
+
+    template <std::input_iterator It>
+    UnrolledForwardList(
+        It first,
+        It last
+    )
+    {
+        for (; first != last; ++first)
+        {
+            emplace_back(*first);
+        }
+    }
+
+    UnrolledForwardList(
+        std::initializer_list<T> values
+    )
+        : UnrolledForwardList(values.begin(), values.end())
+    {
+    }
+
+    UnrolledForwardList(
+        const UnrolledForwardList& other
+    )
+        : UnrolledForwardList(other.begin(), other.end())
+    {
+    }
+
+    UnrolledForwardList(
+        UnrolledForwardList&& other
+    ) noexcept
+    {
+        Adopt(other);
+    }
+
+    auto operator=(
+        const UnrolledForwardList& other
+    ) -> UnrolledForwardList&
+    {
+        if (this != &other)
+        {
+            auto copy = other;
+            clear();
+            Adopt(copy);
+        }
+        return *this;
+    }
+
+    auto operator=(
+        UnrolledForwardList&& other
+    ) noexcept -> UnrolledForwardList&
+    {
+        if (this != &other)
+        {
+            clear();
+            Adopt(other);
+        }
+        return *this;
+    }
+
+    ~UnrolledForwardList() { clear(); }
+
+    [[nodiscard]] auto before_begin() -> iterator { return {&header_, 0}; }
+
+    [[nodiscard]] auto before_begin() const -> const_iterator { return {const_cast<NodeBase*>(&header_), 0}; } // NOLINT
+
+    [[nodiscard]] auto begin() -> iterator { return {header_.next, 0}; }
+
+    [[nodiscard]] auto begin() const -> const_iterator { return {header_.next, 0}; }
+
+    [[nodiscard]] auto end() -> iterator { return {}; }
+
+    [[nodiscard]] auto end() const -> const_iterator { return {}; }
+
+    [[nodiscard]] auto cbegin() const -> const_iterator { return begin(); }
+
+    [[nodiscard]] auto cend() const -> const_iterator { return end(); }
+
+    [[nodiscard]] auto empty() const -> bool { return size_ == 0; }
+
+    [[nodiscard]] auto size() const -> size_type { return size_; }
+
+    /**
+     * @brief 確保しているノードの数 (充填率の確認用)
+     */
+    [[nodiscard]] auto node_count() const -> size_type
+    {
+        size_type n = 0;
+        for (const auto* node = header_.next; node != nullptr; node = node->next)
+        {
+            ++n;
+        }
+        return n;
+    }
+
+    [[nodiscard]] auto front() -> T& { return *begin(); }
+
+    [[nodiscard]] auto front() const -> const T& { return *begin(); }
+
+    void push_front(
+        const T& value
+    )
+    {
+        emplace_front(value);
+    }
+
+    void push_front(
+        T&& value
+    )
+    {
+        emplace_front(std::move(value));
+    }
+
+    template <typename... Args>
+    auto emplace_front(
+        Args&&... args
+    ) -> T&
+    {
+        return *emplace_after(before_begin(), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief 末尾への追加 (末尾のノードを持っているので O(1))
+     */
+    void push_back(
+        const T& value
+    )
+    {
+        emplace_back(value);
+    }
+
+    void push_back(
+        T&& value
+    )
+    {
+        emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    auto emplace_back(
+        Args&&... args
+    ) -> T&
+    {
+        if (tail_ == &header_ || tail_->count == CAPACITY)
+        {
+            LinkAfter(tail_, NewNode());
+        }
+        auto* node = static_cast<Node*>(tail_);
+        auto* p = std::construct_at(node->at(node->count), std::forward<Args>(args)...);
+        ++node->count;
+        ++size_;
+        return *p;
+    }
+
+    void pop_front() { erase_after(before_begin()); }
+
+    template <typename... Args>
+    auto emplace_after(
+        const_iterator pos,
+        Args&&... args
+    ) -> iterator
+    {
+        // args がこのリストの要素を指していても良いように、ノードを分けたりずらしたりする前に作っておく
+        auto value = T(std::forward<Args>(args)...);
+
+        // 新しい要素は node の k 番目になる
+        NodeBase* node = pos.node_;
+        size_type k = pos.i_ + 1;
+        if (node == &header_)
+        {
+            node = header_.next;
+            k = 0;
+            if (node == nullptr || node->count == CAPACITY)
+            {
+                node = LinkAfter(&header_, NewNode());
+            }
+        }
+        else if (node->count == CAPACITY)
+        {
+            if (k == CAPACITY)
+            {
+                // ノードの末尾への追加は新しいノードに置く (順に追加すると満杯のノードが並ぶ)
+                node = LinkAfter(node, NewNode());
+                k = 0;
+            }
+            else
+            {
+                auto* right = Split(static_cast<Node*>(node), CAPACITY / 2);
+                if (k > node->count)
+                {
+                    k -= node->count;
+                    node = right;
+                }
+            }
+        }
+
+        auto* n = static_cast<Node*>(node);
+        ShiftRight(n, k);
+        std::construct_at(n->at(k), std::move(value));
+        ++n->count;
+        ++size_;
+        return {node, k};
+    }
+
+    auto insert_after(
+        const_iterator pos,
+        const T&       value
+    ) -> iterator
+    {
+        return emplace_after(pos, value);
+    }
+
+    auto insert_after(
+        const_iterator pos,
+        T&&            value
+    ) -> iterator
+    {
+        return emplace_after(pos, std::move(value));
+    }
+
+    /**
+     * @brief pos の次の要素を消し、その次の要素を指す反復子を返す
+     */
+    auto erase_after(
+        const_iterator pos
+    ) -> iterator
+    {
+        NodeBase* prev = pos.node_;
+        NodeBase* node = pos.node_;
+        size_type k = pos.i_ + 1;
+        if (node == &header_ || k == node->count)
+        {
+            node = node->next;
+            k = 0;
+        }
+        else
+        {
+            prev = nullptr; // 同じノードの中なので、ノードは空にならない
+        }
+
+        auto* n = static_cast<Node*>(node);
+        std::destroy_at(n->at(k));
+        ShiftLeft(n, k);
+        --n->count;
+        --size_;
+        if (n->count == 0)
+        {
+            auto* next = n->next;
+            Unlink(prev, n);
+            return {next, 0};
+        }
+        if (k == n->count)
+        {
+            return {n->next, 0};
+        }
+        return {node, k};
+    }
+
+    void clear()
+    {
+        auto* node = header_.next;
+        while (node != nullptr)
+        {
+            auto* next = node->next;
+            auto* n = static_cast<Node*>(node);
+            std::destroy(n->at(0), n->at(n->count));
+            DeleteNode(n);
+            node = next;
+        }
+        header_.next = nullptr;
+        tail_ = &header_;
+        size_ = 0;
+    }
+
+    /**
+     * @brief other の要素を全て pos の後ろに移す (要素はムーブせず、pos のノードを分けてノードをつなぎ替える)
+     */
+    void splice_after(
+        const_iterator       pos,
+        UnrolledForwardList& other
+    )
+    {
+        if (this == &other || other.empty())
+        {
+            return;
+        }
+        NodeBase* node = pos.node_;
+        if (node != &header_ && pos.i_ + 1 < node->count)
+        {
+            Split(static_cast<Node*>(node), pos.i_ + 1);
+        }
+        other.tail_->next = node->next;
+        node->next = other.header_.next;
+        if (tail_ == node)
+        {
+            tail_ = other.tail_;
+        }
+        size_ += other.size_;
+        other.header_.next = nullptr;
+        other.tail_ = &other.header_;
+        other.size_ = 0;
+    }
+
+    void splice_after(
+        const_iterator        pos,
+        UnrolledForwardList&& other
+    )
+    {
+        splice_after(pos, other);
+    }
+
+    /**
+     * @brief 安定ソート
+     *
+     * 要素を連続した一時領域にムーブして std::stable_sort し、同じノードに書き戻す
+     * (std::forward_list::sort のようにノードを辿りながら比べるより、キャッシュミスが少ない)
+     */
+    template <typename Compare = std::less<>>
+    void sort(
+        Compare comp = {}
+    )
+    {
+        auto buffer = std::vector<T>();
+        buffer.reserve(size_);
+        for (auto& v : *this)
+        {
+            buffer.push_back(std::move(v));
+        }
+        std::ranges::stable_sort(buffer, comp);
+        std::ranges::move(buffer, begin());
+    }
+
+    /**
+     * @brief ソート済みの other をソート済みの *this に併合する (安定)
+     *
+     * 出力は先頭から詰めたノードに書き、読み終えたノードは出力に使い回す。
+     * 確保は併合を始める前に済ませるので、std::bad_alloc なら何も変わらない。
+     * 比較や要素のムーブが例外を投げたら、併合済みの要素と残りの要素を全て *this に入れ、other を空にする
+     */
+    template <typename Compare = std::less<>>
+    void merge(
+        UnrolledForwardList& other,
+        Compare              comp = {}
+    )
+    {
+        if (this == &other || other.empty())
+        {
+            return;
+        }
+
+        // 読み終えていないノードは a と b に 1 つずつなので、出力は読み終えたノードより高々 2 つ先に進む。
+        // その 2 つを先に確保しておけば、併合の途中で確保することはない
+        auto out = Writer{.tail = &header_, .spare = NewNode()};
+        try
+        {
+            out.spare->next = NewNode();
+        }
+        catch (...)
+        {
+            DeleteNode(out.spare);
+            throw;
+        }
+
+        auto a = Reader{.node = static_cast<Node*>(std::exchange(header_.next, nullptr))};
+        auto b = Reader{.node = static_cast<Node*>(other.header_.next)};
+        try
+        {
+            while (a.node != nullptr && b.node != nullptr)
+            {
+                if (std::invoke(comp, *b.node->at(b.i), *a.node->at(a.i)))
+                {
+                    Transfer(b, out);
+                }
+                else
+                {
+                    Transfer(a, out);
+                }
+            }
+            for (auto* rest : {&a, &b})
+            {
+                while (rest->node != nullptr)
+                {
+                    Transfer(*rest, out);
+                }
+            }
+        }
+        catch (...)
+        {
+            Reassemble(a, b, out, other);
+            throw;
+        }
+        Reassemble(a, b, out, other);
+    }
+
+    template <typename Compare = std::less<>>
+    void merge(
+        UnrolledForwardList&& other,
+        Compare               comp = {}
+    )
+    {
+        merge(other, comp);
+    }
+
+    friend auto operator==(
+        const UnrolledForwardList& a,
+        const UnrolledForwardList& b
+    ) -> bool
+    {
+        return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+    }
+
+private:
+    // merge で読んでいる位置
+    struct Reader
+    {
+        Node*     node = nullptr;
+        size_type i = 0;
+    };
+
+    // merge で書いている末尾のノードと、空いたノード (先に確保した分と読み終えた分) のスタック
+    struct Writer
+    {
+        NodeBase* tail = nullptr;
+        Node*     spare = nullptr;
+    };
+
+    /**
+     * @brief from の要素を 1 つ out の末尾にムーブする
+     *
+     * ムーブが例外を投げても、from の要素と out の末尾は元のまま (空のノードをつながない)
+     */
+    void Transfer(
+        Reader& from,
+        Writer& out
+    )
+    {
+        const bool fresh = out.tail == &header_ || out.tail->count == CAPACITY;
+        auto*      tail = fresh ? out.spare : static_cast<Node*>(out.tail);
+        if (fresh)
+        {
+            tail->count = 0;
+        }
+        std::construct_at(tail->at(tail->count), std::move(*from.node->at(from.i)));
+        if (fresh)
+        {
+            out.spare = static_cast<Node*>(tail->next);
+            out.tail->next = tail;
+            out.tail = tail;
+        }
+        ++tail->count;
+
+        std::destroy_at(from.node->at(from.i));
+        if (++from.i == from.node->count)
+        {
+            auto* done = from.node;
+            from.node = static_cast<Node*>(done->next);
+            from.i = 0;
+            done->next = out.spare;
+            out.spare = done;
+        }
+    }
+
+    /**
+     * @brief merge の出力、a と b の読み残しの順につないで *this とし、空きノードを解放して other を空にする
+     *
+     * 読みかけのノードは読み残しを先頭に詰める (ムーブが例外を投げる型では std::terminate になる)
+     */
+    void Reassemble(
+        Reader&              a,
+        Reader&              b,
+        Writer&              out,
+        UnrolledForwardList& other
+    ) noexcept
+    {
+        NodeBase* tail = out.tail;
+        for (auto* rest : {&a, &b})
+        {
+            if (rest->node == nullptr)
+            {
+                continue;
+            }
+            auto* node = rest->node;
+            for (size_type j = 0; rest->i != 0 && j + rest->i < node->count; ++j)
+            {
+                std::construct_at(node->at(j), std::move(*node->at(j + rest->i)));
+                std::destroy_at(node->at(j + rest->i));
+            }
+            node->count -= rest->i;
+            tail->next = node;
+            tail = node;
+            while (tail->next != nullptr)
+            {
+                tail = tail->next;
+            }
+        }
+        tail->next = nullptr;
+        tail_ = tail;
+
+        while (out.spare != nullptr)
+        {
+            auto* next = static_cast<Node*>(out.spare->next);
+            DeleteNode(out.spare);
+            out.spare = next;
+        }
+
+        size_ += other.size_;
+        other.header_.next = nullptr;
+        other.tail_ = &other.header_;
+        other.size_ = 0;
+    }
+
+    static auto NewNode() -> Node*
+    {
+        // 値初期化すると要素の領域まで 0 で埋めるので、既定初期化する
+        return ::new (std::allocator<Node>().allocate(1)) Node;
+    }
+
+    static void DeleteNode(
+        Node* node
+    )
+    {
+        std::allocator<Node>().deallocate(node, 1);
+    }
+
+    auto LinkAfter(
+        NodeBase* prev,
+        Node*     node
+    ) -> Node*
+    {
+        node->next = prev->next;
+        prev->next = node;
+        if (tail_ == prev)
+        {
+            tail_ = node;
+        }
+        return node;
+    }
+
+    /**
+     * @brief 空になった node を外す (prev が nullptr なら先頭から探す)
+     */
+    void Unlink(
+        NodeBase* prev,
+        Node*     node
+    )
+    {
+        if (prev == nullptr)
+        {
+            prev = &header_;
+            while (prev->next != node)
+            {
+                prev = prev->next;
+            }
+        }
+        prev->next = node->next;
+        if (tail_ == node)
+        {
+            tail_ = prev;
+        }
+        DeleteNode(node);
+    }
+
+    /**
+     * @brief node の [at, count) を新しいノードに移して node の次につなぎ、新しいノードを返す
+     */
+    auto Split(
+        Node*     node,
+        size_type at
+    ) -> Node*
+    {
+        auto* right = NewNode();
+        std::uninitialized_move(node->at(at), node->at(node->count), right->at(0));
+        std::destroy(node->at(at), node->at(node->count));
+        right->count = node->count - at;
+        node->count = at;
+        return LinkAfter(node, right);
+    }
+
+    /**
+     * @brief [k, count) を 1 つ後ろにずらし、k を未初期化にする
+     */
+    static void ShiftRight(
+        Node*     node,
+        size_type k
+    )
+    {
+        if (k == node->count)
+        {
+            return;
+        }
+        std::construct_at(node->at(node->count), std::move(*node->at(node->count - 1)));
+        std::move_backward(node->at(k), node->at(node->count - 1), node->at(node->count));
+        std::destroy_at(node->at(k));
+    }
+
+    /**
+     * @brief 破棄済みの k に [k + 1, count) を詰め、末尾を未初期化にする
+     */
+    static void ShiftLeft(
+        Node*     node,
+        size_type k
+    )
+    {
+        if (k + 1 == node->count)
+        {
+            return;
+        }
+        std::construct_at(node->at(k), std::move(*node->at(k + 1)));
+        std::move(node->at(k + 2), node->at(node->count), node->at(k + 1));
+        std::destroy_at(node->at(node->count - 1));
+    }
+
+    void Adopt(
+        UnrolledForwardList& other
+    )
+    {
+        header_.next = std::exchange(other.header_.next, nullptr);
+        tail_ = other.tail_ == &other.header_ ? &header_ : other.tail_;
+        size_ = std::exchange(other.size_, 0);
+        other.tail_ = &other.header_;
+    }
+
+    NodeBase  header_;
+    NodeBase* tail_ = &header_;
+    size_type size_ = 0;
+};
+
+} // namespace cppreference
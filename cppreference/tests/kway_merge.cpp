@@ -0,0 +1,153 @@
+#include "kway_merge.hpp"
+#include "thread_pool.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+TEST(
+    kway_merge, Merge_Merge
+)
+{
+    using std::begin, std::end;
+
+    {
+        const auto runs = std::vector<std::vector<int>>{{1, 4, 7}, {2, 5, 8}, {3, 6, 9, 10}}; // NOLINT
+
+        std::vector<int> v;
+        cppreference::kway_merge(runs, std::back_inserter(v));
+        EXPECT_EQ(10, v.size());                                                                // NOLINT
+        EXPECT_TRUE(std::ranges::equal(v, std::views::iota(1) | std::views::take(10)));         // NOLINT
+    }
+
+    {
+        // 列の型は問わない (list, 空の列, 1 本だけ)
+        const auto runs = std::vector<std::list<int>>{{}, {9, 5, 1}, {}, {10, 8, 6}, {7, 4, 3, 2}}; // NOLINT
+
+        std::vector<int> v;
+        cppreference::kway_merge(runs, std::back_inserter(v), std::greater{});
+        EXPECT_TRUE(std::ranges::equal(v, std::views::iota(1, 11) | std::views::reverse));     // NOLINT
+
+        std::vector<int> w;
+        cppreference::kway_merge(std::vector<std::vector<int>>{}, std::back_inserter(w));
+        EXPECT_TRUE(w.empty());
+        cppreference::kway_merge(std::vector<std::vector<int>>{{1, 2}}, std::back_inserter(w));
+        EXPECT_EQ((std::vector<int>{1, 2}), w);
+    }
+
+    {
+        // 尽きた列の番兵と同じ値 (最大値, 無限大) を含む列
+        constexpr auto max = std::numeric_limits<int>::max();
+        const auto     runs = std::vector<std::vector<int>>{{max}, {1, max, max}, {}, {2, 3}, {max}}; // NOLINT
+
+        std::vector<int> v;
+        cppreference::kway_merge(runs, std::back_inserter(v));
+        EXPECT_EQ((std::vector<int>{1, 2, 3, max, max, max, max}), v);
+
+        constexpr auto inf = std::numeric_limits<double>::infinity();
+        const auto     reals = std::vector<std::vector<double>>{{-inf, inf}, {0.5, inf}, {-1.0}}; // NOLINT
+
+        std::vector<double> d;
+        cppreference::kway_merge(reals, std::back_inserter(d));
+        EXPECT_EQ((std::vector<double>{-inf, -1.0, 0.5, inf, inf}), d);
+    }
+}
+
+TEST(
+    kway_merge, Stable
+)
+{
+    // 値が同じなら番号の小さい列が先
+    using Item = std::pair<int, int>; // {key, 列番号}
+    auto runs = std::vector<std::vector<Item>>(5);  // NOLINT
+    for (int i = 0; i < 5; ++i)                     // NOLINT
+    {
+        for (int key = 0; key < 100; key += 1 + i) // NOLINT
+        {
+            runs[i].emplace_back(key, i);
+        }
+    }
+    const auto by_key = [](const Item& a, const Item& b) { return a.first < b.first; };
+
+    auto expected = std::vector<Item>();
+    for (const auto& r : runs)
+    {
+        expected.insert(expected.end(), r.begin(), r.end());
+    }
+    std::ranges::stable_sort(expected, by_key);
+
+    auto serial = std::vector<Item>();
+    cppreference::kway_merge(runs, std::back_inserter(serial), by_key);
+    EXPECT_EQ(expected, serial);
+
+    auto pool = cppreference::ThreadPool(4); // NOLINT
+    auto par = cppreference::execution::par.on(pool).with_grain(7);
+    auto parallel = std::vector<Item>(expected.size());
+    cppreference::kway_merge(par, runs, parallel.begin(), by_key);
+    EXPECT_EQ(expected, parallel);
+}
+
+TEST(
+    kway_merge, Parallel
+)
+{
+    auto gen = std::mt19937{42}; // NOLINT
+    auto pool = cppreference::ThreadPool(4); // NOLINT
+
+    for (const int bound : {1, 10, 1'000'000}) // 重複だらけ〜ほぼ一意
+    {
+        auto dist = std::uniform_int_distribution<int>(0, bound - 1);
+        auto lengths = std::uniform_int_distribution<int>(0, 2'000); // NOLINT
+        auto runs = std::vector<std::vector<int>>(100);            // NOLINT
+        auto expected = std::vector<int>();
+        for (auto& r : runs)
+        {
+            r.resize(lengths(gen));
+            std::ranges::generate(r, [&]() { return dist(gen); });
+            std::ranges::sort(r);
+            expected.insert(expected.end(), r.begin(), r.end());
+        }
+        std::ranges::sort(expected);
+
+        for (const std::size_t grain : {333, 4'096, 1'000'000}) // NOLINT
+        {
+            auto actual = std::vector<int>(expected.size());
+            auto par = cppreference::execution::par.on(pool).with_grain(grain);
+            EXPECT_EQ(actual.end(), cppreference::kway_merge(par, runs, actual.begin()));
+            EXPECT_EQ(expected, actual);
+        }
+
+        // span の列、RandomAccess でない出力は逐次版
+        auto spans = std::vector<std::span<const int>>(runs.begin(), runs.end());
+        auto deq = std::deque<int>();
+        cppreference::kway_merge(cppreference::execution::par.on(pool), spans, std::back_inserter(deq));
+        EXPECT_TRUE(std::ranges::equal(expected, deq));
+    }
+
+    // 値の範囲が重ならない列 (最も広い区間の中央を pivot にするだけでは 1 回に 1 列しか狭まらない)
+    auto chunks = std::vector<std::vector<int>>(300); // NOLINT
+    for (std::size_t i = 0; i < chunks.size(); ++i)
+    {
+        chunks[i].resize(500);                                                    // NOLINT
+        std::iota(chunks[i].begin(), chunks[i].end(), static_cast<int>(i * 500)); // NOLINT
+    }
+    std::ranges::shuffle(chunks, gen);
+    auto actual = std::vector<int>(150'000); // NOLINT
+    auto par = cppreference::execution::par.on(pool).with_grain(1'000);
+    cppreference::kway_merge(par, chunks, actual.begin());
+    EXPECT_TRUE(std::ranges::equal(std::views::iota(0, 150'000), actual)); // NOLINT
+}
+
+} // namespace
@@ -0,0 +1,188 @@
+#include "allocation_budget.hpp"
+#include "node_pool.hpp"
+#include "gtest/gtest.h"
+#include <cstddef>
+#include <forward_list>
+#include <functional>
+#include <list>
+#include <semaphore>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+template <typename T>
+using PoolList = std::list<T, cppreference::NodePoolAllocator<T>>;
+
+template <typename T>
+using PoolForwardList = std::forward_list<T, cppreference::NodePoolAllocator<T>>;
+
+template <typename T>
+using PoolSet = std::unordered_set<T, std::hash<T>, std::equal_to<T>, cppreference::NodePoolAllocator<T>>;
+
+template <typename K, typename V>
+using PoolMap =
+    std::unordered_map<K, V, std::hash<K>, std::equal_to<K>, cppreference::NodePoolAllocator<std::pair<const K, V>>>;
+
+TEST(
+    node_pool, Containers
+)
+{
+    // forward_list.Operations と同じ sort / merge
+    auto fl1 = PoolForwardList<int>({3, 4, 5, 1, -1});   // NOLINT
+    auto fl1x = PoolForwardList<int>({6, 8, 10, 2, -2}); // NOLINT
+    fl1.sort();
+    fl1x.sort();
+    fl1.merge(fl1x);
+    EXPECT_EQ(fl1, (PoolForwardList<int>({-2, -1, 1, 2, 3, 4, 5, 6, 8, 10})));
+
+    // アロケータは全て等しいので splice はノードをつなぎ替えるだけ
+    auto l1 = PoolList<int>({1, 2, 3});
+    auto l2 = PoolList<int>({4, 5}); // NOLINT
+    l1.splice(l1.end(), l2);
+    EXPECT_EQ(l1, (PoolList<int>({1, 2, 3, 4, 5})));
+
+    // ノードの取り出し・移動
+    auto us1 = PoolSet<int>({1, 2, 3, 4, 5}); // NOLINT
+    auto us2 = PoolSet<int>({6, 7});          // NOLINT
+    auto node = us1.extract(1);
+    us2.insert(std::move(node));
+    us1.merge(us2);
+    EXPECT_EQ(us1, (PoolSet<int>({1, 2, 3, 4, 5, 6, 7})));
+
+    auto um1 = PoolMap<std::string, int>({{"one", 1}, {"two", 2}, {"three", 3}}); // NOLINT
+    um1.erase("two");
+    um1["four"] = 4; // NOLINT
+    EXPECT_EQ(3zU, um1.size());
+    EXPECT_EQ(4, um1.at("four"));
+}
+
+TEST(
+    node_pool, Reuse
+)
+{
+    auto l1 = PoolList<int>();
+    for (int i = 0; i < 1'000; ++i) // NOLINT
+    {
+        l1.push_back(i);
+    }
+
+    // 消したノードを使い回すので、入れ替えを繰り返してもスラブもヒープの確保も増えない
+    const auto slabs = cppreference::NodePoolSlabCount();
+    {
+        const auto budget = cppreference::AllocationBudget(0);
+        for (int i = 0; i < 100'000; ++i) // NOLINT
+        {
+            l1.pop_front();
+            l1.push_back(i);
+        }
+    }
+    EXPECT_EQ(slabs, cppreference::NodePoolSlabCount());
+    EXPECT_EQ(99'999, l1.back());
+}
+
+TEST(
+    node_pool, Threads
+)
+{
+    // 別のスレッドで確保したノードを解放しても良い。終了したスレッドの空きブロックは他のスレッドが使う
+    auto l1 = PoolList<int>();
+    auto producer = std::thread([&]() {
+        for (int i = 0; i < 10'000; ++i) // NOLINT
+        {
+            l1.push_back(i);
+        }
+    });
+    producer.join();
+    EXPECT_EQ(10'000zU, l1.size());
+    l1.clear();
+
+    const auto churn = []() {
+        auto l2 = PoolList<int>();
+        for (int i = 0; i < 10'000; ++i) // NOLINT
+        {
+            l2.push_back(i);
+        }
+    };
+    std::thread(churn).join();
+    const auto slabs = cppreference::NodePoolSlabCount();
+    std::thread(churn).join();
+    EXPECT_EQ(slabs, cppreference::NodePoolSlabCount());
+}
+
+TEST(
+    node_pool, CrossThreadFree
+)
+{
+    // スレッド A が確保したブロックをスレッド B が解放し続けても、B の空きリストは溜め込まずに
+    // NodePoolDepot に戻すので、A はそれを使い回してスラブは増え続けない
+    using Alloc = cppreference::NodePoolAllocator<std::pair<int, int>>;
+    constexpr int ROUNDS = 50;
+    constexpr int BLOCKS = 20'000;
+
+    auto blocks = std::vector<std::pair<int, int>*>();
+    auto allocated = std::binary_semaphore(0);
+    auto freed = std::binary_semaphore(0);
+    auto slabs = std::vector<std::size_t>();
+
+    auto producer = std::thread([&]() {
+        for (int r = 0; r < ROUNDS; ++r)
+        {
+            for (int i = 0; i < BLOCKS; ++i)
+            {
+                blocks.push_back(Alloc().allocate(1));
+            }
+            allocated.release();
+            freed.acquire();
+            slabs.push_back(cppreference::NodePoolSlabCount());
+        }
+    });
+    auto consumer = std::thread([&]() {
+        for (int r = 0; r < ROUNDS; ++r)
+        {
+            allocated.acquire();
+            for (auto* p : blocks)
+            {
+                Alloc().deallocate(p, 1);
+            }
+            blocks.clear();
+            freed.release();
+        }
+    });
+    producer.join();
+    consumer.join();
+
+    ASSERT_EQ(static_cast<std::size_t>(ROUNDS), slabs.size());
+    EXPECT_LE(slabs.back(), slabs.front() + 2);
+}
+
+TEST(
+    node_pool, ThreadExit
+)
+{
+    // thread_local のコンテナはスレッドの空きブロックを渡した後に破棄される。その解放も NodePoolDepot に戻る
+    std::thread([]() {
+        thread_local auto l1 = PoolList<int>();
+        for (int i = 0; i < 100'000; ++i) // NOLINT
+        {
+            l1.push_back(i);
+        }
+    }).join();
+
+    const auto slabs = cppreference::NodePoolSlabCount();
+    std::thread([]() {
+        auto l2 = PoolList<int>();
+        for (int i = 0; i < 100'000; ++i) // NOLINT
+        {
+            l2.push_back(i);
+        }
+    }).join();
+    EXPECT_EQ(slabs, cppreference::NodePoolSlabCount());
+}
+
+} // namespace
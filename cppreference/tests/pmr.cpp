@@ -0,0 +1,177 @@
+#include "arena.hpp"
+#include "gtest/gtest.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <forward_list>
+#include <functional>
+#include <memory_resource>
+#include <new>
+#include <queue>
+#include <stack>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+
+TEST(
+    pmr, Arena
+)
+{
+    // 最初のチャンクを使い切ると 2 倍の大きさのチャンクを足す
+    auto arena = cppreference::Arena(1024); // NOLINT
+    auto vec1 = std::pmr::vector<int>(&arena);
+    for (int i = 0; i < 1'000; ++i) // NOLINT
+    {
+        vec1.push_back(i);
+    }
+    EXPECT_GT(arena.used(), 1'000 * sizeof(int));
+    const auto reserved = arena.reserved();
+
+    // reset しても upstream に返さず、同じ大きさの確保ならチャンクを使い回す
+    vec1 = std::pmr::vector<int>(&arena);
+    arena.reset();
+    EXPECT_EQ(0zU, arena.used());
+    auto vec2 = std::pmr::vector<int>(&arena);
+    for (int i = 0; i < 1'000; ++i) // NOLINT
+    {
+        vec2.push_back(i);
+    }
+    EXPECT_EQ(reserved, arena.reserved());
+
+    // 境界合わせ
+    constexpr std::size_t ALIGN = 64;
+    for (std::size_t bytes : {1, 3, 100, 5'000}) // NOLINT
+    {
+        EXPECT_EQ(0zU, reinterpret_cast<std::uintptr_t>(arena.allocate(bytes, ALIGN)) % ALIGN); // NOLINT
+    }
+}
+
+TEST(
+    pmr, ArenaBuffer
+)
+{
+    // 手元のバッファを使い切ったら upstream (ここでは確保できないリソース) に頼む
+    alignas(std::max_align_t) auto buffer = std::array<std::byte, 4096>(); // NOLINT
+    auto arena = cppreference::Arena(buffer, std::pmr::null_memory_resource());
+
+    auto vec1 = std::pmr::vector<int>({1, 2, 3, 4, 5}, &arena); // NOLINT
+    EXPECT_GE(static_cast<const void*>(vec1.data()), static_cast<const void*>(buffer.data()));
+    EXPECT_LT(static_cast<const void*>(vec1.data()), static_cast<const void*>(buffer.data() + buffer.size()));
+    EXPECT_THROW(vec1.reserve(4096), std::bad_alloc); // NOLINT
+    EXPECT_EQ(0zU, arena.reserved());
+}
+
+// 以下は vector.cpp などのテストを、Arena から確保する std::pmr のコンテナで行う
+
+TEST(
+    pmr, Vector
+)
+{
+    auto arena = cppreference::Arena();
+
+    auto vec1 = std::pmr::vector<int>({1, 2, 3, 4, 5}, &arena); // NOLINT
+    vec1.assign(3, 42);                                         // NOLINT
+    EXPECT_EQ((std::pmr::vector<int>{42, 42, 42}), vec1);
+
+    // コピーしたコンテナは既定のリソースを使う (propagate しない)。明示すれば同じリソースから確保する
+    auto vec2 = vec1;
+    EXPECT_EQ(std::pmr::get_default_resource(), vec2.get_allocator().resource());
+    auto vec3 = std::pmr::vector<int>(vec1, &arena);
+    EXPECT_EQ(&arena, vec3.get_allocator().resource());
+
+    vec1.emplace_back(6); // NOLINT
+    vec1.resize(7);       // NOLINT
+    EXPECT_EQ(7zU, vec1.size());
+
+    auto vec4 = std::pmr::vector<int>({1, 2, 3, 4, 5, 1, 6, 7}, &arena); // NOLINT
+    EXPECT_EQ(2zU, std::erase(vec4, 1));
+    EXPECT_EQ(3zU, std::erase_if(vec4, [](int i) { return i % 2 == 0; })); // NOLINT
+    EXPECT_EQ((std::pmr::vector<int>{3, 5, 7}), vec4);
+}
+
+TEST(
+    pmr, ForwardList
+)
+{
+    auto arena = cppreference::Arena();
+
+    auto fl1 = std::pmr::forward_list<int>({3, 4, 5, 1, -1}, &arena);   // NOLINT
+    auto fl1x = std::pmr::forward_list<int>({6, 8, 10, 2, -2}, &arena); // NOLINT
+
+    // 同じリソースのリスト同士ならノードをつなぎ替えるだけ
+    fl1.sort();
+    fl1x.sort();
+    fl1.merge(fl1x);
+    EXPECT_EQ(fl1, (std::pmr::forward_list<int>({-2, -1, 1, 2, 3, 4, 5, 6, 8, 10})));
+    EXPECT_TRUE(fl1x.empty());
+}
+
+TEST(
+    pmr, ContainerAdaptors
+)
+{
+    auto arena = cppreference::Arena();
+
+    // アダプタは下のコンテナのアロケータを受け取る
+    auto stk1 = std::stack<int, std::pmr::vector<int>>(&arena);
+    stk1.push(1);
+    stk1.emplace(2);
+    EXPECT_EQ(2, stk1.top());
+
+    auto que1 = std::queue<int, std::pmr::deque<int>>(&arena);
+    que1.push(1);
+    que1.emplace(2);
+    EXPECT_EQ(1, que1.front());
+    EXPECT_EQ(2, que1.back());
+
+    auto pq1 = std::priority_queue<int, std::pmr::vector<int>>(std::less<int>(), &arena);
+    for (const auto i : {5, 4, 3, 2, 1}) // NOLINT
+    {
+        pq1.push(i);
+    }
+    pq1.pop();
+    EXPECT_EQ(4, pq1.top());
+    EXPECT_GT(arena.used(), 0zU);
+}
+
+TEST(
+    pmr, UnorderedAssociativeContainers
+)
+{
+    // 要素を消しては入れるので、解放したノードを使い回す pool を Arena の上に置く
+    auto arena = cppreference::Arena();
+    auto pool = std::pmr::unsynchronized_pool_resource(&arena);
+
+    auto us1 = std::pmr::unordered_set<int>({1, 2, 3, 4, 5}, 0, {}, {}, &pool); // NOLINT
+    EXPECT_EQ(1zU, us1.erase(1));
+    EXPECT_TRUE(us1.insert(6).second); // NOLINT
+
+    auto um1 = std::pmr::unordered_map<std::pmr::string, int>(&pool);
+    um1.emplace("one", 1);
+    um1.emplace("two", 2);
+    um1["three"] = 3; // NOLINT
+    EXPECT_EQ(3zU, um1.size());
+    // キーの std::pmr::string もコンテナのリソースから確保する
+    EXPECT_EQ(&pool, um1.begin()->first.get_allocator().resource());
+
+    // 同じリソースのコンテナ同士ならノードを移せる
+    auto us2 = std::pmr::unordered_set<int>({7, 8}, 0, {}, {}, &pool); // NOLINT
+    us1.merge(us2);
+    EXPECT_EQ(7zU, us1.size());
+
+    // 消して入れ直しても Arena から新しく切り出さない
+    const auto used = arena.used();
+    for (int i = 0; i < 100; ++i) // NOLINT
+    {
+        us1.erase(2);
+        us1.insert(2);
+    }
+    EXPECT_EQ(used, arena.used());
+}
+
+} // namespace
@@ -0,0 +1,96 @@
+#include "radix_heap.hpp"
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+TEST(
+    radix_heap, priority_queue
+)
+{
+    auto pq = cppreference::RadixHeap<std::uint32_t, std::string>();
+    EXPECT_TRUE(pq.empty());
+
+    pq.push(5, "five"); // NOLINT
+    pq.push(1, "one");
+    pq.emplace(3, 2, 'x'); // NOLINT
+    EXPECT_EQ(3, pq.size());
+    EXPECT_EQ(1, pq.top().first);
+    EXPECT_EQ("one", pq.top().second);
+    pq.pop();
+
+    // 最後に取り出したキー (1) 以上なら push できる
+    pq.push(1, "again");
+    EXPECT_EQ("again", pq.top().second);
+    pq.pop();
+    EXPECT_EQ("xx", pq.top().second);
+    pq.pop();
+    EXPECT_EQ(5, pq.top().first); // NOLINT
+    pq.pop();
+    EXPECT_TRUE(pq.empty());
+
+    // キーの最大値
+    auto small = cppreference::RadixHeap<std::uint8_t, int>();
+    small.push(255, 0); // NOLINT
+    small.push(0, 1);
+    small.push(128, 2); // NOLINT
+    EXPECT_EQ(0, small.top().first);
+    small.pop();
+    EXPECT_EQ(128, small.top().first); // NOLINT
+    small.pop();
+    EXPECT_EQ(255, small.top().first); // NOLINT
+    small.pop();
+    EXPECT_TRUE(small.empty());
+}
+
+TEST(
+    radix_heap, AgainstStd
+)
+{
+    // 取り出したキー + [0, range) を push し続ける (タイマー)
+    auto gen = std::mt19937_64{42}; // NOLINT
+
+    for (const std::uint64_t range : {1ULL, 10ULL, 1ULL << 20U, 1ULL << 40U}) // NOLINT
+    {
+        auto delay = std::uniform_int_distribution<std::uint64_t>(0, range - 1);
+        auto op = std::uniform_int_distribution<int>(0, 2);
+
+        auto pq = cppreference::RadixHeap<std::uint64_t, int>();
+        auto expected = std::priority_queue<std::uint64_t, std::vector<std::uint64_t>, std::greater<>>();
+        std::uint64_t now = 0;
+        for (int i = 0; i < 100'000; ++i) // NOLINT
+        {
+            if (op(gen) != 0 || expected.empty())
+            {
+                const auto key = now + delay(gen);
+                pq.push(key, i);
+                expected.push(key);
+            }
+            else
+            {
+                now = pq.top().first;
+                EXPECT_EQ(expected.top(), now);
+                pq.pop();
+                expected.pop();
+            }
+            ASSERT_EQ(expected.size(), pq.size());
+        }
+        while (!expected.empty())
+        {
+            EXPECT_EQ(expected.top(), pq.top().first);
+            pq.pop();
+            expected.pop();
+        }
+        EXPECT_TRUE(pq.empty());
+    }
+}
+
+} // namespace
@@ -0,0 +1,142 @@
+#include "radix_sort.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+TEST(
+    radix_sort, Sorting_sort
+)
+{
+    std::vector<int> vec1 = {1, 2, 3, 4, 5, 6}; // NOLINT
+
+    using std::begin, std::end;
+
+    std::shuffle(begin(vec1), end(vec1), std::mt19937{42});              // NOLINT
+    cppreference::radix_sort(begin(vec1), end(vec1));                    // NOLINT
+    EXPECT_TRUE(std::is_sorted(begin(vec1), end(vec1)));                 // NOLINT
+    cppreference::radix_sort(begin(vec1), end(vec1), std::greater{});    // NOLINT
+    EXPECT_TRUE(std::is_sorted(begin(vec1), end(vec1), std::greater{})); // NOLINT
+}
+
+// しきい値を超える長さで std::sort と突き合わせる
+template <typename T>
+void CheckAgainstStd(
+    std::mt19937& gen
+)
+{
+    auto v = std::vector<T>(10'000); // NOLINT
+    if constexpr (std::floating_point<T>)
+    {
+        auto dist = std::uniform_real_distribution<T>(-1e6, 1e6); // NOLINT
+        std::ranges::generate(v, [&]() { return dist(gen); });
+        v[0] = T{-0.0};
+        v[1] = std::numeric_limits<T>::infinity();
+        v[2] = -std::numeric_limits<T>::infinity();
+        v[3] = std::numeric_limits<T>::lowest();
+    }
+    else
+    {
+        auto dist = std::uniform_int_distribution<std::int64_t>(
+            std::numeric_limits<T>::min(), std::numeric_limits<T>::max()
+        );
+        std::ranges::generate(v, [&]() { return static_cast<T>(dist(gen)); });
+        v[0] = std::numeric_limits<T>::min();
+        v[1] = std::numeric_limits<T>::max();
+    }
+
+    auto expected = v;
+    auto actual = v;
+
+    std::ranges::sort(expected);
+    cppreference::radix_sort(actual);
+    EXPECT_EQ(expected, actual);
+
+    std::ranges::sort(expected, std::greater{});
+    cppreference::radix_sort(actual, std::greater<T>{});
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(
+    radix_sort, AgainstStd
+)
+{
+    auto gen = std::mt19937{42}; // NOLINT
+    CheckAgainstStd<std::int8_t>(gen);
+    CheckAgainstStd<std::uint8_t>(gen);
+    CheckAgainstStd<std::int16_t>(gen);
+    CheckAgainstStd<std::uint16_t>(gen);
+    CheckAgainstStd<std::int32_t>(gen);
+    CheckAgainstStd<std::uint32_t>(gen);
+    CheckAgainstStd<std::int64_t>(gen);
+    CheckAgainstStd<float>(gen);
+    CheckAgainstStd<double>(gen);
+
+    // 上位ビットしか違わない (下位の桁は全て飛ばされる)
+    auto v = std::vector<std::uint64_t>(1'000); // NOLINT
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+        v[i] = (v.size() - i) << 56; // NOLINT
+    }
+    cppreference::radix_sort(v);
+    EXPECT_TRUE(std::ranges::is_sorted(v));
+}
+
+TEST(
+    radix_sort, Projection
+)
+{
+    struct Item
+    {
+        std::uint32_t key;
+        std::string   name;
+    };
+
+    auto gen = std::mt19937{42}; // NOLINT
+    auto items = std::vector<Item>(1'000);
+    for (auto& item : items)
+    {
+        item.key = gen() % 100; // NOLINT
+        item.name = std::to_string(item.key);
+    }
+
+    cppreference::radix_sort(items, std::ranges::less{}, &Item::key);
+    EXPECT_TRUE(std::ranges::is_sorted(items, std::ranges::less{}, &Item::key));
+    EXPECT_TRUE(std::ranges::all_of(items, [](const Item& i) { return i.name == std::to_string(i.key); }));
+
+    cppreference::radix_sort(items, std::ranges::greater{}, [](const Item& i) { return -static_cast<double>(i.key); });
+    EXPECT_TRUE(std::ranges::is_sorted(items, std::ranges::less{}, &Item::key));
+}
+
+TEST(
+    radix_sort, Fallback
+)
+{
+    using std::begin, std::end;
+
+    // 基数ソートできないキー・比較・イテレータは std::sort に任せる
+    auto strs = std::vector<std::string>{"pear", "apple", "fig"};
+    cppreference::radix_sort(strs);
+    EXPECT_EQ((std::vector<std::string>{"apple", "fig", "pear"}), strs);
+
+    auto v = std::vector<int>(1'000); // NOLINT
+    std::iota(begin(v), end(v), 0);
+    std::ranges::shuffle(v, std::mt19937{42}); // NOLINT
+    cppreference::radix_sort(v, [](int a, int b) { return (a % 10) < (b % 10); }); // NOLINT
+    EXPECT_TRUE(std::ranges::is_sorted(v, {}, [](int a) { return a % 10; }));     // NOLINT
+
+    auto deq = std::deque<int>(begin(v), end(v));
+    EXPECT_EQ(end(deq), cppreference::radix_sort(begin(deq), end(deq)));
+    EXPECT_TRUE(std::ranges::is_sorted(deq));
+}
+
+} // namespace
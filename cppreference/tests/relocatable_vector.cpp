@@ -0,0 +1,199 @@
+#include "relocatable_vector.hpp"
+#include "trivially_relocatable.hpp"
+#include "gtest/gtest.h"
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+// ムーブ構築子は数を数えるが、メンバ型で再配置はバイト列のコピーで良いと宣言する
+struct Relocatable
+{
+    using is_trivially_relocatable = std::true_type;
+
+    explicit Relocatable(
+        int v
+    )
+        : value(std::make_unique<int>(v))
+    {
+    }
+
+    Relocatable(
+        Relocatable&& other
+    ) noexcept
+        : value(std::move(other.value))
+    {
+        ++moves;
+    }
+
+    auto operator=(Relocatable&&) -> Relocatable& = default;
+
+    ~Relocatable() = default;
+
+    Relocatable(const Relocatable&) = delete;
+    auto operator=(const Relocatable&) -> Relocatable& = delete;
+
+    std::unique_ptr<int> value;
+
+    static inline int moves = 0;
+};
+
+TEST(
+    relocatable_vector, TriviallyRelocatable
+)
+{
+    static_assert(cppreference::TriviallyRelocatable<int>);
+    static_assert(cppreference::TriviallyRelocatable<std::unique_ptr<int>>);
+    static_assert(cppreference::TriviallyRelocatable<Relocatable>);
+    // libstdc++ の std::string は SSO の領域を自分で指すので該当しない
+    static_assert(!cppreference::TriviallyRelocatable<std::string>);
+
+    // 容量を増やしても、途中に挿入・削除しても要素ごとのムーブ構築子は呼ばれない
+    Relocatable::moves = 0;
+    auto vec1 = cppreference::RelocatableVector<Relocatable>();
+    for (int i = 0; i < 1'000; ++i) // NOLINT
+    {
+        vec1.emplace_back(i);
+    }
+    vec1.emplace(vec1.begin(), -1);
+    vec1.erase(vec1.begin() + 1, vec1.begin() + 501); // NOLINT
+    EXPECT_EQ(0, Relocatable::moves);
+    ASSERT_EQ(501zU, vec1.size());
+    EXPECT_EQ(-1, *vec1[0].value);
+    EXPECT_EQ(500, *vec1[1].value);
+    EXPECT_EQ(999, *vec1.back().value);
+}
+
+TEST(
+    relocatable_vector, Modifiers
+)
+{
+    auto vec1 = cppreference::RelocatableVector<int>{1, 2, 3, 4, 5}; // NOLINT
+    vec1.emplace_back(6);                                            // NOLINT
+    EXPECT_EQ(6zU, vec1.size());
+    EXPECT_EQ(10zU, vec1.capacity());
+
+    vec1.resize(4);
+    vec1.resize(7, 9); // NOLINT
+    EXPECT_EQ((cppreference::RelocatableVector<int>{1, 2, 3, 4, 9, 9, 9}), vec1);
+
+    vec1.insert(vec1.begin() + 1, 0);
+    vec1.insert(vec1.begin(), 2, vec1[1]);
+    vec1.erase(vec1.begin() + 7, vec1.end()); // NOLINT
+    EXPECT_EQ((cppreference::RelocatableVector<int>{0, 0, 1, 0, 2, 3, 4}), vec1);
+
+    // 要素を指す引数で、容量を増やしながら追加する
+    auto vec2 = cppreference::RelocatableVector<std::unique_ptr<int>>();
+    vec2.push_back(std::make_unique<int>(1));
+    vec2.emplace(vec2.begin(), std::make_unique<int>(*vec2[0] + 1));
+    EXPECT_EQ(2, *vec2[0]);
+    EXPECT_EQ(1, *vec2[1]);
+
+    auto vec3 = cppreference::RelocatableVector<std::string>{"relocatable", "vector"};
+    vec3.push_back(vec3[0]);
+    vec3.emplace(vec3.begin(), vec3.back());
+    const auto expected = std::vector<std::string>{"relocatable", "relocatable", "vector", "relocatable"};
+    EXPECT_TRUE(std::ranges::equal(expected, vec3));
+
+    // 容量が足りていれば insert / resize で確保し直さない (std::string は memmove で動かさない経路)
+    auto vec4 = cppreference::RelocatableVector<std::string>();
+    vec4.reserve(16); // NOLINT
+    vec4.resize(4, "x");
+    vec4.insert(vec4.begin() + 1, 3, "y");
+    vec4.resize(9, "z"); // NOLINT
+    EXPECT_EQ(16zU, vec4.capacity());
+    EXPECT_EQ((cppreference::RelocatableVector<std::string>{"x", "y", "y", "y", "x", "x", "x", "z", "z"}), vec4);
+
+    // 足りなくなったときだけ倍に増やす
+    vec4.insert(vec4.end(), 8, "w"); // NOLINT
+    EXPECT_EQ(32zU, vec4.capacity());
+    EXPECT_EQ(17zU, vec4.size());
+    vec4.resize(33); // NOLINT
+    EXPECT_EQ(64zU, vec4.capacity());
+}
+
+TEST(
+    relocatable_vector, Mremap
+)
+{
+    // 大きな領域は mmap で確保し、mremap で伸ばす (容量はページ単位に切り上がる)
+    auto vec1 = cppreference::RelocatableVector<int>();
+    for (int i = 0; i < 1'000'000; ++i) // NOLINT
+    {
+        vec1.push_back(i);
+    }
+    EXPECT_GE(vec1.capacity() * sizeof(int), cppreference::detail::MREMAP_THRESHOLD);
+    for (int i = 0; i < 1'000'000; ++i) // NOLINT
+    {
+        ASSERT_EQ(i, vec1[i]);
+    }
+
+    // 途中への挿入と、小さな領域に戻す縮小
+    vec1.insert(vec1.begin(), -1);
+    EXPECT_EQ(-1, vec1[0]);
+    EXPECT_EQ(999'999, vec1.back());
+    vec1.resize(10); // NOLINT
+    vec1.shrink_to_fit();
+    EXPECT_EQ(10zU, vec1.capacity());
+    EXPECT_EQ((cppreference::RelocatableVector<int>{-1, 0, 1, 2, 3, 4, 5, 6, 7, 8}), vec1);
+}
+
+template <typename T, typename Make>
+void CompareWithStd(
+    Make make
+)
+{
+    auto gen = std::mt19937{42}; // NOLINT
+    auto op = std::uniform_int_distribution<int>(0, 5);
+
+    auto actual = cppreference::RelocatableVector<T>();
+    auto expected = std::vector<T>();
+    for (int i = 0; i < 20'000; ++i) // NOLINT
+    {
+        const auto pos = expected.empty() ? 0 : std::uniform_int_distribution<std::size_t>(0, expected.size())(gen);
+        const auto at = static_cast<std::ptrdiff_t>(pos);
+        switch (op(gen))
+        {
+        case 0:
+        case 1:
+            expected.push_back(make(i));
+            actual.push_back(make(i));
+            break;
+        case 2:
+            expected.insert(expected.begin() + at, make(i));
+            actual.insert(actual.begin() + at, make(i));
+            break;
+        case 3:
+            if (pos < expected.size())
+            {
+                expected.erase(expected.begin() + at);
+                actual.erase(actual.begin() + at);
+            }
+            break;
+        case 4:
+            expected.resize(pos / 2);
+            actual.resize(pos / 2);
+            break;
+        default:
+            actual.shrink_to_fit();
+            break;
+        }
+        ASSERT_TRUE(std::ranges::equal(expected, actual, [](const T& a, const T& b) { return *a == *b; }));
+    }
+}
+
+TEST(
+    relocatable_vector, AgainstStd
+)
+{
+    // memmove で動かす型と、要素ごとにムーブする型
+    CompareWithStd<std::unique_ptr<int>>([](int i) { return std::make_unique<int>(i); });
+    CompareWithStd<std::shared_ptr<int>>([](int i) { return std::make_shared<int>(i); });
+}
+
+} // namespace
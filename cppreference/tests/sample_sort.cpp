@@ -0,0 +1,100 @@
+#include "sample_sort.hpp"
+#include "thread_pool.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+TEST(
+    sample_sort, Sorting_sort
+)
+{
+    std::vector<int> vec1 = {1, 2, 3, 4, 5, 6}; // NOLINT
+
+    using std::begin, std::end;
+
+    auto pool = cppreference::ThreadPool(4); // NOLINT
+    auto par = cppreference::execution::par.on(pool);
+
+    std::shuffle(begin(vec1), end(vec1), std::mt19937{42});                   // NOLINT
+    cppreference::sort(par, begin(vec1), end(vec1));                     // NOLINT
+    EXPECT_TRUE(std::is_sorted(begin(vec1), end(vec1)));                 // NOLINT
+    cppreference::sort(par, begin(vec1), end(vec1), std::greater{});     // NOLINT
+    EXPECT_TRUE(std::is_sorted(begin(vec1), end(vec1), std::greater{})); // NOLINT
+}
+
+TEST(
+    sample_sort, AgainstStd
+)
+{
+    auto pool = cppreference::ThreadPool(4); // NOLINT
+    auto par = cppreference::execution::par.on(pool).with_grain(1'000);
+
+    auto gen = std::mt19937{42}; // NOLINT
+    for (const int bound : {1, 3, 1'000, 1'000'000'000}) // 重複だらけ〜ほぼ一意
+    {
+        auto dist = std::uniform_int_distribution<int>(0, bound - 1);
+        auto v = std::vector<int>(200'000); // NOLINT
+        std::ranges::generate(v, [&]() { return dist(gen); });
+
+        auto expected = v;
+        std::ranges::sort(expected);
+
+        // 作業領域: 無制限 / 一部だけ / なし
+        const auto scratches = {cppreference::UNBOUNDED_SCRATCH, sizeof(int) * 30'000, std::size_t{0}}; // NOLINT
+        for (const std::size_t scratch : scratches)
+        {
+            auto actual = v;
+            cppreference::sort(par, actual.begin(), actual.end(), std::less{}, scratch);
+            EXPECT_EQ(expected, actual);
+        }
+
+        std::ranges::sort(expected, std::greater{});
+        auto actual = v;
+        cppreference::sort(par, actual.begin(), actual.end(), std::greater{}, sizeof(int) * 30'000); // NOLINT
+        EXPECT_EQ(expected, actual);
+    }
+}
+
+TEST(
+    sample_sort, Elements
+)
+{
+    auto pool = cppreference::ThreadPool(4); // NOLINT
+    auto par = cppreference::execution::par.on(pool).with_grain(1'000);
+
+    auto gen = std::mt19937{42}; // NOLINT
+
+    // ムーブが意味を持つ要素
+    auto strs = std::vector<std::string>(50'000); // NOLINT
+    std::ranges::generate(strs, [&]() { return std::to_string(gen()); });
+    auto expected = strs;
+    std::ranges::sort(expected);
+
+    // 作業領域: 無制限 / 半分ずつに分割してから作業領域を使う / しきい値以下 (作業領域を使わない)
+    const auto scratches = {cppreference::UNBOUNDED_SCRATCH, sizeof(std::string) * 30'000, std::size_t{64 * 1'024}}; // NOLINT
+    for (const std::size_t scratch : scratches)
+    {
+        auto actual = strs;
+        cppreference::sort(par, actual.begin(), actual.end(), std::less{}, scratch);
+        EXPECT_EQ(expected, actual);
+    }
+
+    // コピーできない要素は std::sort
+    auto ptrs = std::vector<std::unique_ptr<int>>();
+    for (int i = 0; i < 100; ++i) // NOLINT
+    {
+        ptrs.push_back(std::make_unique<int>(100 - i)); // NOLINT
+    }
+    cppreference::sort(par, ptrs.begin(), ptrs.end(), [](const auto& a, const auto& b) { return *a < *b; });
+    EXPECT_TRUE(std::ranges::is_sorted(ptrs, std::less{}, [](const auto& p) { return *p; }));
+}
+
+} // namespace
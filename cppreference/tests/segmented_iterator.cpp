@@ -0,0 +1,150 @@
+#include "execution.hpp"
+#include "segmented_iterator.hpp"
+#include "thread_pool.hpp"
+#include "unrolled_list.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+
+static_assert(cppreference::SegmentedIterator<std::deque<int>::iterator>);
+static_assert(cppreference::SegmentedIterator<std::deque<int>::const_iterator>);
+static_assert(cppreference::SegmentedIterator<cppreference::UnrolledForwardList<int>::iterator>);
+static_assert(!cppreference::SegmentedIterator<std::vector<int>::iterator>);
+static_assert(!cppreference::SegmentedIterator<std::list<int>::iterator>);
+
+TEST(
+    segmented_iterator, Deque
+)
+{
+    using std::begin, std::end;
+
+    // ブロック (int なら 128 要素) をいくつもまたぐ大きさで、先頭・末尾がブロックの途中にある区間
+    auto deq = std::deque<int>(1'000); // NOLINT
+    std::iota(begin(deq), end(deq), 0);
+    deq.pop_front();
+    deq.push_front(-1);
+    auto       expected = std::vector<int>(begin(deq), end(deq));
+    const auto first = begin(deq) + 3;
+    const auto last = end(deq) - 5; // NOLINT
+
+    // for_each / reduce
+    cppreference::for_each(first, last, [](auto& v) { v *= 2; });
+    std::for_each(begin(expected) + 3, end(expected) - 5, [](auto& v) { v *= 2; }); // NOLINT
+    EXPECT_TRUE(std::ranges::equal(expected, deq));
+    EXPECT_EQ(std::reduce(begin(expected), end(expected)), cppreference::reduce(begin(deq), end(deq)));
+    EXPECT_EQ(std::int64_t{2} * (3 + 994) * 992 / 2, cppreference::reduce(first, last, std::int64_t{0})); // NOLINT
+
+    // find
+    EXPECT_EQ(begin(deq) + 500, cppreference::find(first, last, 1'000)); // NOLINT
+    EXPECT_EQ(last, cppreference::find(first, last, 1));
+    EXPECT_EQ(last, cppreference::find(first, last, 1'990)); // NOLINT
+    EXPECT_EQ(first, cppreference::find(first, first, 6));   // NOLINT
+
+    // fill / copy (deque -> vector と、ブロックの境界がずれた位置の deque -> deque)
+    cppreference::fill(first + 10, first + 300, 7); // NOLINT
+    EXPECT_EQ(290, std::ranges::count(deq, 7));     // NOLINT
+
+    auto vec = std::vector<int>(deq.size());
+    EXPECT_EQ(end(vec), cppreference::copy(begin(deq), end(deq), begin(vec)));
+    EXPECT_TRUE(std::ranges::equal(deq, vec));
+
+    auto       out = std::deque<int>(deq.size() + 50); // NOLINT
+    const auto d_last = cppreference::copy(first, last, begin(out) + 50);
+    EXPECT_EQ(begin(out) + 50 + (last - first), d_last);
+    EXPECT_TRUE(std::equal(first, last, begin(out) + 50));
+
+    // 出力の末尾がちょうどブロックの末尾
+    auto blocks = std::deque<int>(256, 1); // NOLINT
+    EXPECT_EQ(end(blocks), cppreference::copy(begin(deq), begin(deq) + 256, begin(blocks)));
+    EXPECT_TRUE(std::equal(begin(blocks), end(blocks), begin(deq)));
+}
+
+TEST(
+    segmented_iterator, UnrolledForwardList
+)
+{
+    auto fl1 = cppreference::UnrolledForwardList<int>();
+    for (int i = 0; i < 100; ++i) // NOLINT
+    {
+        fl1.push_back(i);
+    }
+    const auto first = std::next(fl1.begin(), 5);
+
+    cppreference::for_each(first, fl1.end(), [](auto& v) { v += 1; });
+    EXPECT_EQ(10 + (6 + 100) * 95 / 2, cppreference::reduce(fl1.begin(), fl1.end())); // NOLINT
+    EXPECT_EQ(std::next(fl1.begin(), 49), cppreference::find(first, fl1.end(), 50));     // NOLINT
+    EXPECT_EQ(fl1.end(), cppreference::find(first, fl1.end(), 0));
+
+    cppreference::fill(first, std::next(first, 20), 0); // NOLINT
+    EXPECT_EQ(21, std::ranges::count(fl1, 0));           // NOLINT
+
+    auto vec = std::vector<int>(100); // NOLINT
+    cppreference::copy(fl1.begin(), fl1.end(), begin(vec));
+    EXPECT_TRUE(std::ranges::equal(fl1, vec));
+
+    // 出力が UnrolledForwardList で、出力の末尾が end()
+    auto fl2 = cppreference::UnrolledForwardList<int>{0, 0, 0};
+    auto fl3 = cppreference::UnrolledForwardList<int>{1, 2, 3};
+    EXPECT_EQ(fl2.end(), cppreference::copy(fl3.begin(), fl3.end(), fl2.begin()));
+    EXPECT_TRUE(std::ranges::equal(fl3, fl2));
+
+    // ノードをいくつもまたぐ list -> list と、ブロックの末尾で終わる deque -> list (最後の空のブロックもたどる)
+    const auto zeros = std::vector<int>(256); // NOLINT
+    auto       fl4 = cppreference::UnrolledForwardList<int>(begin(zeros), begin(zeros) + 100); // NOLINT
+    EXPECT_EQ(fl4.end(), cppreference::copy(fl1.begin(), fl1.end(), fl4.begin()));
+    EXPECT_TRUE(std::ranges::equal(fl1, fl4));
+
+    const auto deq = std::deque<int>(256, 5); // NOLINT
+    auto       fl5 = cppreference::UnrolledForwardList<int>(begin(zeros), end(zeros));
+    EXPECT_EQ(fl5.end(), cppreference::copy(begin(deq), end(deq), fl5.begin()));
+    EXPECT_TRUE(std::ranges::equal(deq, fl5));
+
+    // 出力の途中まで
+    const auto mid = cppreference::copy(begin(deq), begin(deq) + 128, fl5.begin()); // NOLINT
+    EXPECT_EQ(std::next(fl5.begin(), 128), mid);                                     // NOLINT
+}
+
+TEST(
+    segmented_iterator, Pool
+)
+{
+    using std::begin, std::end;
+
+    // ブロックの途中で区切られるように grain を選ぶ
+    auto pool = cppreference::ThreadPool(4); // NOLINT
+    auto par = cppreference::execution::par.on(pool).with_grain(1'000);
+
+    auto deq = std::deque<int>(100'000); // NOLINT
+    cppreference::fill(par, begin(deq), end(deq), 1);
+    EXPECT_EQ(100'000, cppreference::reduce(par, begin(deq), end(deq)));
+
+    std::iota(begin(deq), end(deq), 0);
+    cppreference::for_each(par, begin(deq), end(deq), [](auto& v) { v *= 2; });
+    EXPECT_EQ(std::int64_t{99'999} * 100'000, cppreference::reduce(par, begin(deq), end(deq), std::int64_t{0}));
+
+    // 最初に見つかった位置を返す
+    deq[77'777] = 1; // NOLINT
+    deq[88'888] = 1; // NOLINT
+    EXPECT_EQ(begin(deq) + 77'777, cppreference::find(par, begin(deq), end(deq), 1)); // NOLINT
+    EXPECT_EQ(end(deq), cppreference::find(par, begin(deq), end(deq), -1));
+
+    auto out = std::deque<int>(deq.size());
+    EXPECT_EQ(end(out), cppreference::copy(par, begin(deq), end(deq), begin(out)));
+    EXPECT_EQ(deq, out);
+
+    // RandomAccessIterator でない UnrolledForwardList は逐次で実行する
+    auto fl1 = cppreference::UnrolledForwardList<int>(begin(deq), begin(deq) + 1'000); // NOLINT
+    cppreference::fill(par, fl1.begin(), fl1.end(), 3);
+    EXPECT_EQ(3'000, cppreference::reduce(par, fl1.begin(), fl1.end()));
+    EXPECT_EQ(fl1.begin(), cppreference::find(par, fl1.begin(), fl1.end(), 3));
+}
+
+} // namespace
@@ -0,0 +1,175 @@
+#include "set_operations.hpp"
+#include "simd_search.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+// [0, bound) から n 個選んでソートした列 (unique なら重複なし)
+auto SortedValues(
+    std::mt19937& gen,
+    std::size_t   n,
+    std::uint32_t bound,
+    bool          unique
+) -> std::vector<std::uint32_t>
+{
+    auto dist = std::uniform_int_distribution<std::uint32_t>(0, bound - 1);
+    auto v = std::vector<std::uint32_t>(n);
+    std::ranges::generate(v, [&]() { return dist(gen); });
+    std::ranges::sort(v);
+    if (unique)
+    {
+        v.erase(std::ranges::unique(v).begin(), v.end());
+    }
+    return v;
+}
+
+TEST(
+    set_operations, Set_Set
+)
+{
+    const std::vector<int> vec1 = {1, 2, 3, 4, 5, 6, 7, 8, 9}; // NOLINT
+    const std::vector<int> vec2 = {1, 2, 3, 4, 9, 10};         // NOLINT
+
+    using std::begin, std::end;
+
+    {
+        std::vector<int> v;
+        cppreference::set_union(begin(vec1), end(vec1), begin(vec2), end(vec2), std::back_inserter(v));    // NOLINT
+        EXPECT_TRUE(std::ranges::equal(v, std::initializer_list<int>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10})); // NOLINT
+    }
+
+    {
+        std::vector<int> v;
+        cppreference::set_intersection(begin(vec1), end(vec1), begin(vec2), end(vec2), std::back_inserter(v)); // NOLINT
+        EXPECT_TRUE(std::ranges::equal(v, std::initializer_list<int>{1, 2, 3, 4, 9}));                         // NOLINT
+    }
+
+    {
+        // 長さの比が大きいと指数探索になる
+        auto large = std::vector<int>(1'000); // NOLINT
+        std::iota(begin(large), end(large), 0);
+        const auto small = std::vector<int>{-1, 3, 500, 999, 1'000}; // NOLINT
+
+        std::vector<int> v;
+        cppreference::set_intersection(begin(small), end(small), begin(large), end(large), std::back_inserter(v));
+        EXPECT_EQ((std::vector<int>{3, 500, 999}), v); // NOLINT
+
+        std::vector<int> w;
+        cppreference::set_union(begin(large), end(large), begin(small), end(small), std::back_inserter(w));
+        EXPECT_EQ(1'002, w.size()); // NOLINT
+        EXPECT_EQ(-1, w.front());
+        EXPECT_EQ(1'000, w.back()); // NOLINT
+    }
+
+    {
+        // RandomAccess でなければ std と同じ
+        const auto l1 = std::list<int>(begin(vec1), end(vec1));
+        std::vector<int> v;
+        cppreference::set_intersection(begin(l1), end(l1), begin(vec2), end(vec2), std::back_inserter(v));
+        EXPECT_TRUE(std::ranges::equal(v, std::initializer_list<int>{1, 2, 3, 4, 9})); // NOLINT
+    }
+}
+
+TEST(
+    set_operations, AgainstStd
+)
+{
+    auto gen = std::mt19937{42}; // NOLINT
+
+    // 重複あり、比較関数は greater、出力は 1 つ目の列の要素 (std と同じ)
+    using Item = std::pair<std::uint32_t, int>; // {key, 列番号}
+    const auto by_key = [](const Item& a, const Item& b) { return a.first > b.first; };
+    const auto tagged = [](const std::vector<std::uint32_t>& keys, int id) {
+        auto v = std::vector<Item>();
+        for (const auto k : keys | std::views::reverse)
+        {
+            v.emplace_back(k, id);
+        }
+        return v;
+    };
+
+    for (const std::size_t n1 : {0, 1, 10, 100, 10'000}) // NOLINT
+    {
+        for (const std::size_t n2 : {0, 1, 7, 1'000, 10'000}) // NOLINT
+        {
+            const auto a = tagged(SortedValues(gen, n1, 1'000, false), 1); // NOLINT
+            const auto b = tagged(SortedValues(gen, n2, 1'000, false), 2); // NOLINT
+
+            auto expected = std::vector<Item>();
+            auto actual = std::vector<Item>();
+            std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected), by_key);
+            cppreference::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(actual), by_key);
+            EXPECT_EQ(expected, actual) << n1 << " " << n2;
+
+            expected.clear();
+            actual.clear();
+            std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected), by_key);
+            cppreference::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(actual), by_key);
+            EXPECT_EQ(expected, actual) << n1 << " " << n2;
+        }
+    }
+}
+
+TEST(
+    set_operations, SortedUnique
+)
+{
+    using cppreference::simd::Isa;
+
+    auto gen = std::mt19937{42}; // NOLINT
+
+    for (const auto isa : {Isa::Scalar, Isa::Sse42, Isa::Avx2})
+    {
+        cppreference::simd::SetIsa(isa);
+        for (const std::size_t n1 : {0, 3, 8, 100, 10'000}) // NOLINT
+        {
+            for (const std::size_t n2 : {0, 5, 16, 1'000, 100'000}) // NOLINT
+            {
+                // 符号付きと符号なしで順序が変わる 0x8000'0000 付近も試す
+                for (const std::uint32_t offset : {0U, 0x7FFF'0000U})
+                {
+                    const auto bound = static_cast<std::uint32_t>(4 * std::max(n1, n2)) + 16; // NOLINT
+                    auto       a = SortedValues(gen, n1, bound, true);
+                    auto       b = SortedValues(gen, n2, bound, true);
+                    std::ranges::for_each(a, [&](auto& x) { x += offset; });
+                    std::ranges::for_each(b, [&](auto& x) { x += offset; });
+
+                    auto expected = std::vector<std::uint32_t>();
+                    std::ranges::set_intersection(a, b, std::back_inserter(expected));
+                    auto       actual = std::vector<std::uint32_t>(std::min(a.size(), b.size()));
+                    const auto last = cppreference::set_intersection(
+                        cppreference::sorted_unique, a.begin(), a.end(), b.begin(), b.end(), actual.begin()
+                    );
+                    actual.erase(last, actual.end());
+                    EXPECT_EQ(expected, actual) << n1 << " " << n2;
+
+                    const auto sa = std::vector<std::int32_t>(a.begin(), a.end());
+                    const auto sb = std::vector<std::int32_t>(b.begin(), b.end());
+                    if (std::ranges::is_sorted(sa) && std::ranges::is_sorted(sb))
+                    {
+                        auto s = std::vector<std::int32_t>();
+                        cppreference::set_intersection(
+                            cppreference::sorted_unique, sb.begin(), sb.end(), sa.begin(), sa.end(),
+                            std::back_inserter(s)
+                        );
+                        EXPECT_TRUE(std::ranges::equal(expected, s));
+                    }
+                }
+            }
+        }
+    }
+    cppreference::simd::SetIsa(Isa::Avx2);
+}
+
+} // namespace
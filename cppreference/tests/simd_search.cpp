@@ -0,0 +1,162 @@
+#include "simd_search.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <list>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+namespace simd = cppreference::simd;
+
+// テスト中は命令セットを切り替えるので、終了時に元へ戻す
+class SimdSearch : public ::testing::TestWithParam<simd::Isa>
+{
+protected:
+    void SetUp() override { simd::SetIsa(GetParam()); }
+    void TearDown() override { simd::SetIsa(simd::Isa::Avx2); }
+};
+
+TEST_P(
+    SimdSearch, Search_AllAnyNone
+)
+{
+    std::array<int, 6> arr = {1, 2, 3, 4, 5, 6}; // NOLINT
+    std::vector<int>   vec = {1, 2, 3, 4, 5, 6}; // NOLINT
+    std::deque<int>    deq = {1, 2, 3, 4, 5, 6}; // NOLINT
+    std::list<int>     lst = {1, 2, 3, 4, 5, 6}; // NOLINT
+
+    using std::begin, std::end;
+
+    EXPECT_TRUE(simd::all_of(begin(arr), end(arr), simd::gt(0)));                              // NOLINT
+    EXPECT_TRUE(simd::all_of(begin(vec), end(vec), simd::gt(0)));                              // NOLINT
+    EXPECT_TRUE(simd::all_of(begin(deq), end(deq), simd::gt(0)));                              // NOLINT
+    EXPECT_TRUE(simd::all_of(begin(lst), end(lst), simd::gt(0)));                              // NOLINT
+    EXPECT_TRUE(simd::all_of(begin(vec), end(vec), [](const auto& v) { return v > 0; }));      // NOLINT
+
+    EXPECT_TRUE(simd::any_of(begin(arr), end(arr), simd::eq(3)));                              // NOLINT
+    EXPECT_TRUE(simd::any_of(begin(vec), end(vec), simd::eq(3)));                              // NOLINT
+    EXPECT_FALSE(simd::any_of(begin(vec), end(vec), simd::eq(7)));                             // NOLINT
+
+    EXPECT_TRUE(simd::none_of(begin(arr), end(arr), simd::lt(0)));                             // NOLINT
+    EXPECT_TRUE(simd::none_of(begin(vec), end(vec), simd::lt(0)));                             // NOLINT
+    EXPECT_FALSE(simd::none_of(begin(vec), end(vec), simd::le(1)));                            // NOLINT
+
+    EXPECT_EQ(begin(vec) + 2, simd::find(begin(vec), end(vec), 3));                            // NOLINT
+    EXPECT_EQ(end(vec), simd::find(begin(vec), end(vec), 9));                                 // NOLINT
+    EXPECT_EQ(std::next(begin(lst), 2), simd::find(begin(lst), end(lst), 3));                  // NOLINT
+}
+
+TEST_P(
+    SimdSearch, Search_Count
+)
+{
+    std::array<int, 5> arr = {1, 2, 2, 3, 5}; // NOLINT
+
+    using std::begin, std::end;
+
+    EXPECT_EQ(2, simd::count(begin(arr), end(arr), 2));                                       // NOLINT
+    EXPECT_EQ(3, simd::count_if(begin(arr), end(arr), [](const auto& v) { return (v % 2) == 1; })); // NOLINT
+    EXPECT_EQ(4, simd::count_if(begin(arr), end(arr), simd::ge(2)));                          // NOLINT
+}
+
+TEST_P(
+    SimdSearch, Search_Mismatch
+)
+{
+    std::array<int, 5> arr1 = {1, 2, 3, 4, 5}; // NOLINT
+    std::array<int, 2> arr2 = {1, 2};          // NOLINT
+    std::array<int, 2> arr3 = {8, 9};          // NOLINT
+
+    using std::begin, std::end;
+
+    EXPECT_EQ(std::make_pair(end(arr2), begin(arr1) + 2), simd::mismatch(begin(arr2), end(arr2), begin(arr1)));
+    EXPECT_EQ(std::make_pair(begin(arr3), begin(arr1)), simd::mismatch(begin(arr3), end(arr3), begin(arr1)));
+}
+
+// 端数処理・全要素型・全比較演算を std と突き合わせる
+template <typename T>
+void CheckAgainstStd(
+    std::mt19937& gen
+)
+{
+    auto dist = std::uniform_int_distribution<int>(0, 7); // NOLINT
+    for (std::size_t n : {0, 1, 7, 15, 16, 17, 31, 32, 33, 63, 64, 65, 257}) // NOLINT
+    {
+        auto v = std::vector<T>(n);
+        std::ranges::generate(v, [&]() { return static_cast<T>(dist(gen)); });
+        const auto key = static_cast<T>(dist(gen));
+
+        using std::begin, std::end;
+        EXPECT_EQ(std::find(begin(v), end(v), key), simd::find(begin(v), end(v), key));
+        EXPECT_EQ(std::count(begin(v), end(v), key), simd::count(begin(v), end(v), key));
+
+        const auto check = [&](auto pred) {
+            EXPECT_EQ(std::find_if(begin(v), end(v), pred), simd::find_if(begin(v), end(v), pred));
+            EXPECT_EQ(std::find_if_not(begin(v), end(v), pred), simd::find_if_not(begin(v), end(v), pred));
+            EXPECT_EQ(std::count_if(begin(v), end(v), pred), simd::count_if(begin(v), end(v), pred));
+            EXPECT_EQ(std::all_of(begin(v), end(v), pred), simd::all_of(begin(v), end(v), pred));
+        };
+        check(simd::eq(key));
+        check(simd::ne(key));
+        check(simd::lt(key));
+        check(simd::le(key));
+        check(simd::gt(key));
+        check(simd::ge(key));
+
+        auto w = v;
+        if (n > 0)
+        {
+            w[n / 2] = static_cast<T>(w[n / 2] + 1);
+        }
+        EXPECT_EQ(std::mismatch(begin(v), end(v), begin(w)), simd::mismatch(begin(v), end(v), begin(w)));
+    }
+}
+
+TEST_P(
+    SimdSearch, AgainstStd
+)
+{
+    auto gen = std::mt19937{42}; // NOLINT
+    CheckAgainstStd<std::int8_t>(gen);
+    CheckAgainstStd<std::uint8_t>(gen);
+    CheckAgainstStd<std::int16_t>(gen);
+    CheckAgainstStd<std::uint16_t>(gen);
+    CheckAgainstStd<std::int32_t>(gen);
+    CheckAgainstStd<std::uint32_t>(gen);
+    CheckAgainstStd<std::int64_t>(gen);
+    CheckAgainstStd<std::uint64_t>(gen);
+    CheckAgainstStd<float>(gen);
+    CheckAgainstStd<double>(gen);
+}
+
+TEST_P(
+    SimdSearch, Boundaries
+)
+{
+    // 符号なしの大小比較と NaN の扱い
+    auto u = std::vector<std::uint32_t>(40, std::numeric_limits<std::uint32_t>::max()); // NOLINT
+    u[33] = 1;                                                                             // NOLINT
+    EXPECT_EQ(begin(u) + 33, simd::find_if(begin(u), end(u), simd::lt(2U)));             // NOLINT
+    EXPECT_EQ(39, simd::count_if(begin(u), end(u), simd::gt(1U)));                        // NOLINT
+
+    auto d = std::vector<double>(40, 1.0);                                                 // NOLINT
+    d[20] = std::numeric_limits<double>::quiet_NaN();                                      // NOLINT
+    EXPECT_EQ(1, simd::count_if(begin(d), end(d), simd::ne(1.0)));                        // NOLINT
+    EXPECT_EQ(39, simd::count_if(begin(d), end(d), simd::le(1.0)));                       // NOLINT
+    EXPECT_EQ(begin(d) + 20, simd::mismatch(begin(d), end(d), begin(d)).first);           // NOLINT
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    simd,
+    SimdSearch,
+    ::testing::Values(simd::Isa::Scalar, simd::Isa::Sse42, simd::Isa::Avx2)
+);
+
+} // namespace
@@ -0,0 +1,167 @@
+#include "small_vector.hpp"
+#include "gtest/gtest.h"
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+TEST(
+    small_vector, MemberFunctions
+)
+{
+    // 要素数 3、値 42 の SmallVector
+    auto vec1 = cppreference::SmallVector<int, 4>(3, 42); // NOLINT
+    EXPECT_EQ(3zU, vec1.size());
+    EXPECT_EQ(42, vec1[2]);
+
+    // ムーブしかできない要素も持てる
+    auto vec2 = cppreference::SmallVector<std::unique_ptr<int>, 2>(3);
+    auto vec3 = std::move(vec2);
+    EXPECT_EQ(3zU, vec3.size());
+    EXPECT_TRUE(vec2.empty()); // NOLINT
+
+    auto vec4 = cppreference::SmallVector<int, 8>{1, 2, 3, 4, 5}; // NOLINT
+    vec4.assign(3, 42);                                           // NOLINT
+    EXPECT_EQ((cppreference::SmallVector<int, 8>{42, 42, 42}), vec4);
+
+    auto vec5 = cppreference::SmallVector<int, 2>{1, 2, 3, 4, 5}; // NOLINT
+    auto vec6 = std::vector<int>{6, 7, 8, 9, 10};                 // NOLINT
+    vec5.assign(vec6.begin(), vec6.end());
+    EXPECT_TRUE(std::ranges::equal(vec5, vec6));
+    EXPECT_THROW((void)vec5.at(5), std::out_of_range);
+}
+
+TEST(
+    small_vector, Capacity
+)
+{
+    // N 要素まではヒープを確保しない
+    auto vec1 = cppreference::SmallVector<int, 4>{1, 2, 3};
+    EXPECT_TRUE(vec1.is_inline());
+    EXPECT_EQ(4zU, vec1.capacity());
+    vec1.emplace_back(4); // NOLINT
+    EXPECT_TRUE(vec1.is_inline());
+
+    // 足りなくなったら元の容量の 2 倍に増やす
+    vec1.emplace_back(5); // NOLINT
+    EXPECT_FALSE(vec1.is_inline());
+    EXPECT_EQ(8zU, vec1.capacity());
+
+    // resize で 1 つずつ増やしても 2 倍ずつ増やす
+    vec1.resize(9); // NOLINT
+    EXPECT_EQ(16zU, vec1.capacity());
+    vec1.resize(10); // NOLINT
+    EXPECT_EQ(16zU, vec1.capacity());
+
+    // N 要素に収まればオブジェクト内に戻る
+    vec1.resize(2);
+    vec1.shrink_to_fit();
+    EXPECT_TRUE(vec1.is_inline());
+    EXPECT_EQ((cppreference::SmallVector<int, 4>{1, 2}), vec1);
+}
+
+TEST(
+    small_vector, Modifiers
+)
+{
+    auto vec1 = cppreference::SmallVector<int, 4>{1, 2, 3, 4, 5}; // NOLINT
+    vec1.emplace_back(6);                                         // NOLINT
+    EXPECT_EQ(6zU, vec1.size());
+    EXPECT_EQ(10zU, vec1.capacity());
+
+    vec1.resize(4);
+    EXPECT_EQ(4zU, vec1.size());
+    vec1.resize(7, 9); // NOLINT
+    EXPECT_EQ((cppreference::SmallVector<int, 4>{1, 2, 3, 4, 9, 9, 9}), vec1);
+
+    // 挿入・削除
+    vec1.insert(vec1.begin() + 1, 0);
+    vec1.insert(vec1.end(), 2, vec1[0]);
+    vec1.erase(vec1.begin() + 5, vec1.begin() + 8); // NOLINT
+    EXPECT_EQ((cppreference::SmallVector<int, 4>{1, 0, 2, 3, 4, 1, 1}), vec1);
+
+    // 要素を指す引数で、容量を増やしながら追加する
+    auto vec2 = cppreference::SmallVector<std::string, 2>{"small", "vector"};
+    vec2.push_back(vec2[0]);
+    vec2.emplace(vec2.begin(), vec2.back());
+    EXPECT_EQ((cppreference::SmallVector<std::string, 2>{"small", "small", "vector", "small"}), vec2);
+
+    vec2.clear();
+    EXPECT_EQ(0zU, vec2.size());
+}
+
+TEST(
+    small_vector, NonMemberFunctions
+)
+{
+    auto vec1 = cppreference::SmallVector<int, 4>{1, 2, 3, 4, 5, 1, 6, 7}; // NOLINT
+    EXPECT_EQ(2zU, erase(vec1, 1));
+    EXPECT_EQ(6zU, vec1.size());
+
+    auto vec2 = cppreference::SmallVector<int, 4>{1, 2, 3, 4, 5, 1, 6, 7}; // NOLINT
+    EXPECT_EQ(3zU, erase_if(vec2, [](int i) { return i % 2 == 0; }));     // NOLINT
+    EXPECT_EQ(5zU, vec2.size());
+
+    // オブジェクト内とヒープの組み合わせで交換する
+    auto vec3 = cppreference::SmallVector<int, 4>{1, 2};
+    swap(vec2, vec3);
+    EXPECT_EQ((cppreference::SmallVector<int, 4>{1, 2}), vec2);
+    EXPECT_EQ((cppreference::SmallVector<int, 4>{1, 3, 5, 1, 7}), vec3);
+    EXPECT_LT(vec2, vec3);
+}
+
+TEST(
+    small_vector, AgainstStd
+)
+{
+    auto gen = std::mt19937{42}; // NOLINT
+    auto op = std::uniform_int_distribution<int>(0, 5);
+
+    // 要素数が N をまたいで増減しても std::vector と同じ内容になること
+    auto actual = cppreference::SmallVector<std::string, 8>();
+    auto expected = std::vector<std::string>();
+    for (int i = 0; i < 20'000; ++i) // NOLINT
+    {
+        const auto value = std::to_string(i) + " is long enough to skip SSO";
+        const auto pos = expected.empty() ? 0 : std::uniform_int_distribution<std::size_t>(0, expected.size())(gen);
+        switch (op(gen))
+        {
+        case 0:
+        case 1:
+            expected.push_back(value);
+            actual.push_back(value);
+            break;
+        case 2:
+            expected.insert(expected.begin() + static_cast<std::ptrdiff_t>(pos), value);
+            actual.insert(actual.begin() + pos, value);
+            break;
+        case 3:
+            if (pos < expected.size())
+            {
+                expected.erase(expected.begin() + static_cast<std::ptrdiff_t>(pos));
+                actual.erase(actual.begin() + pos);
+            }
+            break;
+        case 4:
+            expected.resize(pos / 2);
+            actual.resize(pos / 2);
+            break;
+        default:
+            actual.shrink_to_fit();
+            break;
+        }
+        ASSERT_TRUE(std::ranges::equal(expected, actual));
+    }
+
+    // コピー・ムーブ
+    auto copy = actual;
+    EXPECT_EQ(actual, copy);
+    auto moved = std::move(copy);
+    EXPECT_EQ(actual, moved);
+}
+
+} // namespace
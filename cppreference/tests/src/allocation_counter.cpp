@@ -0,0 +1,86 @@
+#include "allocation_counter.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// ベンチマークとテストでメモリ確保の回数を数えるため、グローバルの operator new / delete を置き換える
+// (配列版・nothrow 版は既定の実装がこれらを呼ぶ)
+
+namespace
+{
+
+[[maybe_unused]] const bool installed = (cppreference::detail::allocation_hook_installed = true);
+
+auto Allocate(
+    std::size_t n,
+    std::size_t alignment
+) -> void*
+{
+    auto& stats = cppreference::detail::allocation_stats;
+    if (stats.count >= cppreference::detail::allocation_limit)
+    {
+        throw std::bad_alloc();
+    }
+    ++stats.count;
+    stats.bytes += n;
+
+    n = n == 0 ? 1 : n;
+    // aligned_alloc はサイズがアラインメントの倍数であること
+    void* p = alignment <= alignof(std::max_align_t)
+                  ? std::malloc(n)                                                         // NOLINT
+                  : std::aligned_alloc(alignment, (n + alignment - 1) / alignment * alignment); // NOLINT
+    if (p == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+} // namespace
+
+auto operator new(
+    std::size_t n
+) -> void*
+{
+    return Allocate(n, alignof(std::max_align_t));
+}
+
+auto operator new(
+    std::size_t      n,
+    std::align_val_t alignment
+) -> void*
+{
+    return Allocate(n, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(
+    void* p
+) noexcept
+{
+    std::free(p); // NOLINT
+}
+
+void operator delete(
+    void* p,
+    std::size_t /* n */
+) noexcept
+{
+    std::free(p); // NOLINT
+}
+
+void operator delete(
+    void* p,
+    std::align_val_t /* alignment */
+) noexcept
+{
+    std::free(p); // NOLINT
+}
+
+void operator delete(
+    void* p,
+    std::size_t /* n */,
+    std::align_val_t /* alignment */
+) noexcept
+{
+    std::free(p); // NOLINT
+}
@@ -0,0 +1,46 @@
+#include "flat_hash.hpp"
+#include "string_hash.hpp"
+#include "gtest/gtest.h"
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+
+TEST(
+    string_hash, StringMap
+)
+{
+    using namespace std::string_view_literals;
+
+    // std::string と std::string_view / const char* のハッシュ値は同じ
+    const auto hash = cppreference::StringHash();
+    EXPECT_EQ(hash(std::string("one")), hash("one"sv));
+    EXPECT_EQ(hash(std::string("one")), hash("one"));
+    EXPECT_EQ(std::hash<std::string>{}("one"), hash("one"));
+
+    // find / contains / count は std::string を作らずに検索できる
+    auto um1 = cppreference::StringMap<int>({{"one", 1}, {"two", 2}, {"three", 3}}); // NOLINT
+    static_assert(std::is_same_v<decltype(um1.find("one"sv)), cppreference::StringMap<int>::iterator>);
+    EXPECT_EQ(1, um1.find("one"sv)->second);
+    EXPECT_EQ(um1.end(), um1.find("four"sv));
+    EXPECT_TRUE(um1.contains("two"));
+    EXPECT_EQ(1, um1.count("three"sv));
+    EXPECT_EQ(0, um1.count(std::string_view("three", 2)));
+
+    auto us1 = cppreference::StringSet({"a", "b"});
+    EXPECT_TRUE(us1.contains("a"sv));
+
+    // FlatHashMap も同じ関数オブジェクトで透過的になる
+    auto fm1 = cppreference::FlatHashMap<std::string, int, cppreference::StringHash, cppreference::StringEqual>(
+        {{"one", 1}, {"two", 2}, {"three", 3}} // NOLINT
+    );
+    EXPECT_EQ(2, fm1.find("two"sv)->second);
+    EXPECT_TRUE(fm1.contains("three"));
+    EXPECT_EQ(0, fm1.count("four"sv));
+    EXPECT_EQ(fm1.end(), std::as_const(fm1).find("four"sv));
+}
+
+} // namespace
@@ -0,0 +1,290 @@
+#include "unrolled_list.hpp"
+#include "allocation_counter.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <new>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using List = cppreference::UnrolledForwardList<int>;
+
+TEST(
+    unrolled_list, Operations
+)
+{
+    // forward_list.Operations と同じ sort / merge
+    auto fl0 = List({3, 4, 5, 1, -1}); // NOLINT
+    auto fl1 = fl0;
+
+    auto fl0x = List({6, 8, 10, 2, -2}); // NOLINT
+    auto fl1x = fl0x;
+
+    // sort
+    fl1.sort();
+    EXPECT_EQ(fl1, (List({-1, 1, 3, 4, 5})));
+
+    fl1.sort(std::greater<>());
+    EXPECT_EQ(fl1, (List({5, 4, 3, 1, -1})));
+
+    // merge
+    fl1.sort();
+    fl1x.sort();
+    fl1.merge(fl1x);
+    EXPECT_EQ(fl1, (List({-2, -1, 1, 2, 3, 4, 5, 6, 8, 10})));
+    EXPECT_TRUE(fl1x.empty());
+
+    fl1 = fl0;
+    fl1x = fl0x;
+    fl1.sort(std::greater<>());
+    fl1x.sort(std::greater<>());
+    fl1.merge(fl1x, std::greater<>());
+    EXPECT_EQ(fl1, (List({10, 8, 6, 5, 4, 3, 2, 1, -1, -2})));
+
+    // 1 つのノードに CAPACITY 個まで入る
+    EXPECT_EQ(12zU, List::CAPACITY);
+    auto fl2 = List();
+    for (int i = 0; i < 100; ++i) // NOLINT
+    {
+        fl2.push_back(i);
+    }
+    EXPECT_EQ(9zU, fl2.node_count());
+    EXPECT_EQ(4950, std::accumulate(fl2.begin(), fl2.end(), 0));
+}
+
+TEST(
+    unrolled_list, Modifiers
+)
+{
+    auto fl1 = List({1, 2, 3});
+    fl1.push_front(0);
+    fl1.insert_after(std::next(fl1.begin(), 3), 4); // NOLINT
+    EXPECT_EQ(fl1, (List({0, 1, 2, 3, 4})));
+
+    auto it = fl1.erase_after(fl1.begin());
+    EXPECT_EQ(2, *it);
+    fl1.pop_front();
+    EXPECT_EQ(fl1, (List({2, 3, 4})));
+
+    // 満杯のノードの途中に挿入すると半分に分ける
+    auto fl2 = List();
+    for (int i = 0; i < 12; ++i) // NOLINT
+    {
+        fl2.push_back(i);
+    }
+    EXPECT_EQ(1zU, fl2.node_count());
+    it = fl2.insert_after(std::next(fl2.begin(), 8), 100); // NOLINT
+    EXPECT_EQ(100, *it);
+    EXPECT_EQ(2zU, fl2.node_count());
+    EXPECT_EQ(fl2, (List({0, 1, 2, 3, 4, 5, 6, 7, 8, 100, 9, 10, 11})));
+
+    // 分けられる後ろ半分の要素を写して挿入しても、分ける前の値が入る
+    auto fl5 = cppreference::UnrolledForwardList<std::string, 256>(); // NOLINT
+    for (int i = 0; i < 7; ++i)                                        // NOLINT
+    {
+        fl5.push_back(std::to_string(i) + " is long enough to skip SSO");
+    }
+    EXPECT_EQ(1zU, fl5.node_count());
+    fl5.emplace_after(fl5.begin(), *std::next(fl5.begin(), 6)); // NOLINT
+    EXPECT_EQ(2zU, fl5.node_count());
+    EXPECT_EQ("6 is long enough to skip SSO", *std::next(fl5.begin()));
+    EXPECT_EQ("6 is long enough to skip SSO", *std::next(fl5.begin(), 7)); // NOLINT
+
+    // splice_after は pos のノードを分けてノードをつなぎ替える
+    auto fl3 = List({1, 2, 5, 6});
+    auto fl4 = List({3, 4});
+    fl3.splice_after(std::next(fl3.begin()), fl4);
+    EXPECT_EQ(fl3, (List({1, 2, 3, 4, 5, 6})));
+    EXPECT_TRUE(fl4.empty());
+    fl3.splice_after(fl3.before_begin(), List({-1, 0}));
+    fl3.push_back(7); // NOLINT
+    EXPECT_EQ(fl3, (List({-1, 0, 1, 2, 3, 4, 5, 6, 7})));
+
+    fl3.clear();
+    EXPECT_TRUE(fl3.empty());
+    EXPECT_EQ(fl3.begin(), fl3.end());
+}
+
+TEST(
+    unrolled_list, AgainstStd
+)
+{
+    auto gen = std::mt19937{42}; // NOLINT
+    auto op = std::uniform_int_distribution<int>(0, 6);
+
+    // ノードの分割・削除をまたいで std::forward_list と同じ内容になること
+    auto actual = cppreference::UnrolledForwardList<std::string, 256>(); // NOLINT
+    auto expected = std::forward_list<std::string>();
+    std::size_t size = 0;
+    for (int i = 0; i < 5'000; ++i) // NOLINT
+    {
+        const auto value = std::to_string(i % 1'000) + " is long enough to skip SSO"; // NOLINT
+        const auto pos = std::uniform_int_distribution<std::size_t>(0, size)(gen);
+        auto       ei = std::next(expected.before_begin(), static_cast<std::ptrdiff_t>(pos));
+        auto       ai = std::next(actual.before_begin(), static_cast<std::ptrdiff_t>(pos));
+        switch (op(gen))
+        {
+        case 0:
+        case 1:
+            expected.insert_after(ei, value);
+            actual.insert_after(ai, value);
+            ++size;
+            break;
+        case 2:
+            if (pos < size)
+            {
+                expected.erase_after(ei);
+                actual.erase_after(ai);
+                --size;
+            }
+            break;
+        case 3:
+            expected.push_front(value);
+            actual.push_front(value);
+            ++size;
+            break;
+        case 4: {
+            auto other = std::forward_list<std::string>({value, value + "!"});
+            expected.splice_after(ei, other);
+            actual.splice_after(ai, cppreference::UnrolledForwardList<std::string, 256>({value, value + "!"}));
+            size += 2;
+            break;
+        }
+        case 5:
+            if (i % 100 == 0) // NOLINT
+            {
+                auto other = std::forward_list<std::string>({value, value + "?"});
+                expected.sort();
+                expected.merge(other);
+                actual.sort();
+                actual.merge(cppreference::UnrolledForwardList<std::string, 256>({value, value + "?"}));
+                size += 2;
+            }
+            break;
+        default:
+            if (!expected.empty())
+            {
+                expected.pop_front();
+                actual.pop_front();
+                --size;
+            }
+            break;
+        }
+        ASSERT_EQ(size, actual.size());
+        ASSERT_TRUE(std::ranges::equal(expected, actual));
+    }
+
+    // 安定ソート: 比較で等しい要素は元の順序のまま
+    auto pairs = cppreference::UnrolledForwardList<std::pair<int, int>>();
+    for (int i = 0; i < 1'000; ++i) // NOLINT
+    {
+        pairs.push_back({i % 7, i}); // NOLINT
+    }
+    pairs.sort([](const auto& a, const auto& b) { return a.first < b.first; });
+    EXPECT_TRUE(std::ranges::is_sorted(pairs));
+
+    // コピー・ムーブ
+    auto copy = actual;
+    EXPECT_EQ(actual, copy);
+    auto moved = std::move(copy);
+    EXPECT_EQ(actual, moved);
+    moved.push_back("tail");
+    EXPECT_EQ(actual.size() + 1, moved.size());
+}
+
+TEST(
+    unrolled_list, MergeExceptionSafety
+)
+{
+    using StringList = cppreference::UnrolledForwardList<std::string, 256>; // NOLINT
+    const auto make = [](int first, int step, int n) {
+        auto list = StringList();
+        for (int i = 0; i < n; ++i)
+        {
+            list.push_back(std::to_string(first + step * i) + " is long enough to skip SSO");
+        }
+        return list;
+    };
+    const auto sorted = [](const StringList& list) {
+        auto values = std::vector<std::string>(list.begin(), list.end());
+        std::ranges::sort(values);
+        return values;
+    };
+    const auto a0 = make(1000, 2, 50); // NOLINT
+    const auto b0 = make(1001, 2, 50); // NOLINT
+    auto       all = sorted(a0);
+    std::ranges::copy(b0, std::back_inserter(all));
+    std::ranges::sort(all);
+
+    // 確保に失敗したら何も変わらない
+    for (std::uint64_t n = 0; n < 2; ++n)
+    {
+        auto a = a0;
+        auto b = b0;
+        {
+            const auto limit = cppreference::AllocationLimit(n);
+            EXPECT_THROW(a.merge(b), std::bad_alloc);
+        }
+        EXPECT_EQ(a0, a);
+        EXPECT_EQ(b0, b);
+    }
+
+    // 始める前の 2 回の確保だけで併合できる
+    {
+        auto a = a0;
+        auto b = b0;
+        {
+            const auto limit = cppreference::AllocationLimit(2);
+            a.merge(b);
+        }
+        EXPECT_TRUE(std::ranges::equal(all, a));
+        EXPECT_TRUE(b.empty());
+    }
+
+    // 比較が途中で例外を投げても、全ての要素が *this に 1 つずつ残り、other は空になる
+    for (int throw_at : {0, 1, 7, 30, 80}) // NOLINT
+    {
+        auto a = a0;
+        auto b = b0;
+        int  calls = 0;
+        EXPECT_THROW(
+            a.merge(
+                b,
+                [&](const std::string& x, const std::string& y) {
+                    if (calls++ == throw_at)
+                    {
+                        throw std::runtime_error("compare");
+                    }
+                    return x < y;
+                }
+            ),
+            std::runtime_error
+        );
+        EXPECT_EQ(all.size(), a.size());
+        EXPECT_EQ(a.size(), static_cast<std::size_t>(std::distance(a.begin(), a.end())));
+        EXPECT_LE(a.node_count(), a.size());
+        EXPECT_EQ(all, sorted(a));
+        EXPECT_TRUE(b.empty());
+        EXPECT_EQ(b.begin(), b.end());
+
+        // どちらもそのまま使い続けられる
+        a.push_back("tail");
+        b.push_back("tail");
+        a.sort();
+        EXPECT_EQ(all.size() + 1, a.size());
+        EXPECT_EQ(1zU, b.size());
+    }
+}
+
+} // namespace